@@ -0,0 +1,308 @@
+#ifndef BATCH_PARSER_H
+#define BATCH_PARSER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "html_parser.h"
+
+// ============================================================================
+// BATCH PARSING (many HTML files in one process, across all cores)
+// ============================================================================
+
+struct BatchItem {
+    std::string input;
+    std::string output; // per-file mode only
+};
+
+struct BatchOptions {
+    int threads = 0;           // 0 = one per core
+    std::string outputDir;     // per-file outputs go here ...
+    std::string combinedFile;  // ... unless everything goes into this one file
+};
+
+struct BatchStats {
+    long files = 0;
+    long failed = 0;
+    long long bytes = 0;
+    double seconds = 0;
+    long steals = 0;
+    int threads = 0;
+};
+
+inline bool hasHtmlExtension(const std::filesystem::path& path) {
+    std::string ext = path.extension().string();
+    for (size_t i = 0; i < ext.size(); i++) {
+        ext[i] = static_cast<char>(tolower(static_cast<unsigned char>(ext[i])));
+    }
+    return ext == ".html" || ext == ".htm";
+}
+
+// Every .html/.htm file under dir, sorted so runs are repeatable. Outputs
+// mirror the folder layout under outputDir.
+inline bool listHtmlFiles(const std::string& dir, const std::string& outputDir, std::vector<BatchItem>& items,
+                          std::string& error) {
+    std::error_code ec;
+    std::filesystem::path root(dir);
+    std::vector<std::filesystem::path> found;
+    std::filesystem::recursive_directory_iterator it(root, ec), end;
+    if (ec) {
+        error = "cannot read directory " + dir + ": " + ec.message();
+        return false;
+    }
+    for (; it != end; it.increment(ec)) {
+        if (ec) break;
+        if (it->is_regular_file(ec) && hasHtmlExtension(it->path())) found.push_back(it->path());
+    }
+    std::sort(found.begin(), found.end());
+
+    for (size_t i = 0; i < found.size(); i++) {
+        BatchItem item;
+        item.input = found[i].string();
+        std::filesystem::path relative = found[i].lexically_relative(root);
+        item.output = (std::filesystem::path(outputDir) / relative).replace_extension(".txt").string();
+        items.push_back(item);
+    }
+    return true;
+}
+
+// Where a manifest line without an output column writes: a relative input
+// keeps its folders under outputDir, as in listHtmlFiles, so a/index.html and
+// b/index.html stay apart; absolute or ../ inputs keep only their name.
+inline std::string manifestOutputFor(const std::string& input, const std::string& outputDir) {
+    std::filesystem::path path = std::filesystem::path(input).lexically_normal();
+    if (path.is_absolute() || path.has_root_name() || path.empty() || *path.begin() == "..") {
+        path = path.filename();
+    }
+    return (std::filesystem::path(outputDir) / path).replace_extension(".txt").string();
+}
+
+// One file per line: "input.html" or "input.html<TAB>output.txt". Blank
+// lines and lines starting with # are skipped.
+inline bool loadManifest(const std::string& manifest, const std::string& outputDir, std::vector<BatchItem>& items,
+                         std::string& error) {
+    std::ifstream file(manifest);
+    if (!file.is_open()) {
+        error = "cannot open manifest " + manifest;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+
+        BatchItem item;
+        size_t tab = line.find('\t');
+        item.input = line.substr(0, tab);
+        if (tab != std::string::npos) {
+            item.output = line.substr(tab + 1);
+        } else {
+            item.output = manifestOutputFor(item.input, outputDir);
+        }
+        items.push_back(item);
+    }
+    return true;
+}
+
+// Per-file mode: two items writing the same file would leave only whichever
+// finished last, so that is an error before anything is parsed
+inline bool checkDistinctOutputs(const std::vector<BatchItem>& items, std::string& error) {
+    std::map<std::string, size_t> writers;
+    for (size_t i = 0; i < items.size(); i++) {
+        std::string output = std::filesystem::path(items[i].output).lexically_normal().string();
+        std::pair<std::map<std::string, size_t>::iterator, bool> added = writers.insert(std::make_pair(output, i));
+        if (!added.second) {
+            error = items[added.first->second].input + " and " + items[i].input + " would both write " + output;
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// WORK-STEALING QUEUES (one deque of job indices per worker)
+// ============================================================================
+// Each worker starts with a contiguous slice and takes from the front of its
+// own deque; an idle worker steals from the back of someone else's, so one
+// huge file only holds up the worker that got it.
+
+class WorkStealingQueues {
+private:
+    struct Lane {
+        std::mutex lock;
+        std::deque<size_t> jobs;
+    };
+
+    std::vector<Lane> lanes;
+    std::atomic<long> steals;
+
+public:
+    WorkStealingQueues(size_t jobCount, int workers) : lanes(workers), steals(0) {
+        for (int w = 0; w < workers; w++) {
+            size_t from = jobCount * w / workers;
+            size_t to = jobCount * (w + 1) / workers;
+            for (size_t j = from; j < to; j++) lanes[w].jobs.push_back(j);
+        }
+    }
+
+    bool next(int worker, size_t& job) {
+        {
+            Lane& own = lanes[worker];
+            std::lock_guard<std::mutex> guard(own.lock);
+            if (!own.jobs.empty()) {
+                job = own.jobs.front();
+                own.jobs.pop_front();
+                return true;
+            }
+        }
+        for (size_t k = 1; k < lanes.size(); k++) {
+            Lane& victim = lanes[(worker + k) % lanes.size()];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.jobs.empty()) {
+                job = victim.jobs.back();
+                victim.jobs.pop_back();
+                steals++;
+                return true;
+            }
+        }
+        return false; // nothing is ever added back, so empty everywhere means done
+    }
+
+    long getSteals() const { return steals.load(); }
+};
+
+// ============================================================================
+// ORDERED WRITER (combined output in input order, whatever order jobs finish)
+// ============================================================================
+
+class OrderedWriter {
+private:
+    std::ostream& out;
+    std::mutex lock;
+    std::vector<std::string> results;
+    std::vector<char> ready;
+    size_t nextToWrite;
+
+public:
+    OrderedWriter(std::ostream& stream, size_t count) : out(stream), results(count), ready(count, 0), nextToWrite(0) {}
+
+    void complete(size_t index, std::string& text) {
+        std::lock_guard<std::mutex> guard(lock);
+        results[index].swap(text);
+        ready[index] = 1;
+        while (nextToWrite < results.size() && ready[nextToWrite]) {
+            out << results[nextToWrite];
+            std::string().swap(results[nextToWrite]);
+            nextToWrite++;
+        }
+    }
+};
+
+// ============================================================================
+// BATCH RUN
+// ============================================================================
+
+inline bool writeTextFile(const std::string& path, const std::string& text) {
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file << text;
+    return static_cast<bool>(file);
+}
+
+// Parses every item; each worker reuses one parser of its own and all of them
+// share the tag registry. Failures are reported on stderr and counted.
+inline BatchStats runBatch(const std::vector<BatchItem>& items, const BatchOptions& options) {
+    BatchStats stats;
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    if (threads < 1) threads = 1;
+    if (static_cast<size_t>(threads) > items.size() && !items.empty()) threads = static_cast<int>(items.size());
+    stats.threads = threads;
+
+    std::ofstream combined;
+    bool combine = !options.combinedFile.empty();
+    if (combine) {
+        combined.open(options.combinedFile, std::ios::binary);
+        if (!combined.is_open()) {
+            std::cerr << "Error: Cannot open file " << options.combinedFile << " for writing" << std::endl;
+            stats.failed = static_cast<long>(items.size());
+            return stats;
+        }
+    }
+    OrderedWriter writer(combined, combine ? items.size() : 0);
+    WorkStealingQueues queues(items.size(), threads);
+    std::atomic<long> files(0);
+    std::atomic<long> failed(0);
+    std::atomic<long long> bytes(0);
+    std::mutex errorLock;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int w = 0; w < threads; w++) {
+        workers.push_back(std::thread([&, w] {
+            setTraceThreadName("batch worker");
+            HTMLParser parser;
+            std::string html;
+            std::string transcoded;
+            size_t job;
+            while (queues.next(w, job)) {
+                const BatchItem& item = items[job];
+                TRACE_SCOPE("batch", "document");
+                std::ostringstream text;
+                bool ok = readWholeFile(item.input, html);
+                if (ok) {
+                    parser.parse(decodeHtmlDocument(html.c_str(), html.size(), "", transcoded));
+                    if (combine) text << "==== " << item.input << " ====\n";
+                    writeRenderDocument(text, parser.buildRenderDocument());
+                    bytes += static_cast<long long>(html.size());
+                }
+
+                std::string result = text.str();
+                if (combine) {
+                    writer.complete(job, result);
+                } else if (ok && !writeTextFile(item.output, result)) {
+                    ok = false;
+                }
+                if (!ok) {
+                    failed++;
+                    std::lock_guard<std::mutex> guard(errorLock);
+                    std::cerr << "Error: Cannot process " << item.input << std::endl;
+                } else {
+                    files++;
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    stats.files = files.load();
+    stats.failed = failed.load();
+    stats.bytes = bytes.load();
+    stats.steals = queues.getSteals();
+    return stats;
+}
+
+inline void printBatchStats(std::ostream& out, const BatchStats& stats) {
+    double seconds = stats.seconds > 0 ? stats.seconds : 1e-9;
+    out << "Parsed " << stats.files << " files (" << stats.failed << " failed), " << stats.bytes << " bytes in "
+        << stats.seconds << " s on " << stats.threads << " threads" << std::endl;
+    out << "Throughput: " << stats.bytes / seconds / (1024.0 * 1024.0) << " MB/s, " << stats.files / seconds
+        << " docs/s, " << stats.steals << " jobs stolen" << std::endl;
+}
+
+#endif // BATCH_PARSER_H
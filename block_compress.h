@@ -0,0 +1,154 @@
+#ifndef BLOCK_COMPRESS_H
+#define BLOCK_COMPRESS_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// BLOCK COMPRESSION (LZ4 block format: fast greedy LZ77, byte-aligned output)
+// ============================================================================
+// Each sequence is a token byte (literal count << 4 | match length - 4), any
+// extra length bytes, the literals, then a 2-byte little-endian match offset.
+// The block ends with a literals-only sequence. Sizes are not stored; the
+// caller keeps the uncompressed length next to the block.
+
+inline uint32_t readU32(const char* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline void writeLengthExtra(std::string& out, size_t extra) {
+    while (extra >= 255) {
+        out += static_cast<char>(255);
+        extra -= 255;
+    }
+    out += static_cast<char>(extra);
+}
+
+inline void writeSequence(std::string& out, const char* literals, size_t literalCount, size_t offset, size_t matchLength) {
+    bool hasMatch = matchLength >= 4;
+    size_t matchCode = hasMatch ? matchLength - 4 : 0;
+    unsigned char token = static_cast<unsigned char>(((literalCount < 15 ? literalCount : 15) << 4) |
+                                                     (matchCode < 15 ? matchCode : 15));
+    out += static_cast<char>(token);
+    if (literalCount >= 15) writeLengthExtra(out, literalCount - 15);
+    out.append(literals, literalCount);
+    if (!hasMatch) return;
+    out += static_cast<char>(offset & 0xFF);
+    out += static_cast<char>((offset >> 8) & 0xFF);
+    if (matchCode >= 15) writeLengthExtra(out, matchCode - 15);
+}
+
+inline std::string compressBlock(const char* src, size_t size) {
+    const int HASH_LOG = 12;
+    const size_t LAST_LITERALS = 5;  // format rule: the block ends with >= 5 literals
+    const size_t MATCH_LIMIT = 12;   // and no match starts in the last 12 bytes
+
+    std::string out;
+    out.reserve(size / 2 + 16);
+    size_t anchor = 0;
+
+    if (size > MATCH_LIMIT) {
+        std::vector<uint32_t> table(static_cast<size_t>(1) << HASH_LOG, 0);
+        size_t i = 1;
+        size_t misses = 0;
+        size_t matchStartLimit = size - MATCH_LIMIT;
+        size_t matchEndLimit = size - LAST_LITERALS;
+
+        while (i < matchStartLimit) {
+            uint32_t sequence = readU32(src + i);
+            uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_LOG);
+            size_t candidate = table[hash];
+            table[hash] = static_cast<uint32_t>(i);
+
+            if (i - candidate > 65535 || readU32(src + candidate) != sequence) {
+                // Incompressible stretches are skipped over faster and faster
+                i += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Extend backwards over literals we were about to emit, then forwards
+            while (i > anchor && candidate > 0 && src[i - 1] == src[candidate - 1]) {
+                i--;
+                candidate--;
+            }
+            size_t length = 4;
+            while (i + length < matchEndLimit && src[candidate + length] == src[i + length]) length++;
+
+            writeSequence(out, src + anchor, i - anchor, i - candidate, length);
+            i += length;
+            anchor = i;
+            if (i >= 2 && i - 2 < matchStartLimit) {
+                table[(readU32(src + i - 2) * 2654435761u) >> (32 - HASH_LOG)] = static_cast<uint32_t>(i - 2);
+            }
+        }
+    }
+
+    writeSequence(out, src + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+inline std::string compressBlock(const std::string& data) {
+    return compressBlock(data.data(), data.size());
+}
+
+// Rebuilds exactly rawSize bytes; false if the block is damaged
+inline bool decompressBlock(const std::string& block, size_t rawSize, std::string& out) {
+    out.clear();
+    out.resize(rawSize);
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(block.data());
+    size_t inSize = block.size();
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < inSize) {
+        unsigned char token = in[ip++];
+        size_t literalCount = token >> 4;
+        if (literalCount == 15) {
+            unsigned char b;
+            do {
+                if (ip >= inSize) return false;
+                b = in[ip++];
+                literalCount += b;
+            } while (b == 255);
+        }
+        if (literalCount > inSize - ip || literalCount > rawSize - op) return false;
+        memcpy(&out[op], in + ip, literalCount);
+        ip += literalCount;
+        op += literalCount;
+        if (ip == inSize) break; // last sequence has no match
+
+        if (inSize - ip < 2) return false;
+        size_t offset = in[ip] | (static_cast<size_t>(in[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15) {
+            unsigned char b;
+            do {
+                if (ip >= inSize) return false;
+                b = in[ip++];
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += 4;
+        if (matchLength > rawSize - op) return false;
+
+        // Overlapping copies (offset < length) repeat the pattern, so go byte by byte
+        size_t from = op - offset;
+        if (offset >= matchLength) {
+            memcpy(&out[op], &out[from], matchLength);
+        } else {
+            for (size_t k = 0; k < matchLength; k++) out[op + k] = out[from + k];
+        }
+        op += matchLength;
+    }
+    return op == rawSize;
+}
+
+#endif // BLOCK_COMPRESS_H
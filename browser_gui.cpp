@@ -1,3 +1,5 @@
+#define _WIN32_WINNT 0x0600
+#include <winsock2.h> // must precede windows.h
 #include <windows.h>
 #include <commctrl.h>
 #include <windowsx.h>
@@ -5,11 +7,22 @@
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include <atomic>
+#include <map>
+#include "html_parser.h"
+#include "page_pipeline.h"
+#include "tab_history.h"
+#include "tab_render_store.h"
+#include "link_prefetcher.h"
+
+#define WM_PAGE_LOADED (WM_APP + 1)
 
 struct TabData {
+    int id = 0;
     std::string url;
-    std::string htmlFile;
-    std::string pageFile;
+    int pendingNavigation = 0;
+    bool showingPartial = false; // current view holds lines of the pending navigation
+    TabHistory history;
 };
 
 static std::vector<TabData> g_tabs;
@@ -17,77 +30,47 @@ static int g_currentTab = -1;
 static std::string g_exeDir;
 static int g_tabSerial = 0;
 
+static HWND g_mainWnd = nullptr;
+static PagePipeline* g_pipeline = nullptr;
+static LinkPrefetcher* g_prefetcher = nullptr; // null turns link prefetch off
+static std::string g_traceFile; // browser_gui.exe --trace FILE, written on exit
+static DocumentCache g_docCache(32 * 1024 * 1024); // parsed pages for instant back/forward
+static std::map<std::string, std::string> g_redirects; // url -> where it redirected, for prefetching cached pages
+// Each tab's current page; background tabs idle for 30 s (or past 16 MB) get compressed
+static TabRenderStore g_tabStore(16 * 1024 * 1024, 30000);
+
 static HWND g_tabCtrl = nullptr;
 static HWND g_urlEdit = nullptr;
 static HWND g_goBtn = nullptr;
+static HWND g_backBtn = nullptr;
+static HWND g_forwardBtn = nullptr;
 static HWND g_addTabBtn = nullptr;
 static HWND g_closeTabBtn = nullptr;
 static HWND g_contentWnd = nullptr;
 
-struct RenderLine {
-    std::string text;
-    int size = 16;
-    bool bold = false;
-    int spaceBefore = 6;
-    int spaceAfter = 6;
-};
-
 static std::vector<RenderLine> g_renderLines;
 static int g_contentHeight = 0;
 static int g_scrollY = 0;
 
-static bool startsWith(const std::string& s, const char* prefix) {
-    return s.rfind(prefix, 0) == 0;
-}
-
-static bool fileExists(const std::string& path) {
-    DWORD attrs = GetFileAttributesA(path.c_str());
-    return attrs != INVALID_FILE_ATTRIBUTES && !(attrs & FILE_ATTRIBUTE_DIRECTORY);
-}
-
-static std::string quote(const std::string& s) {
-    return std::string("\"") + s + "\"";
-}
-
-static std::string readFileToString(const std::string& path) {
-    std::ifstream in(path);
-    if (!in.is_open()) return "";
-    std::ostringstream ss;
-    ss << in.rdbuf();
-    return ss.str();
-}
-
 static void clearContent();
 
-static bool runCommand(const std::string& cmdLine) {
-    STARTUPINFOA si{};
-    si.cb = sizeof(si);
-    PROCESS_INFORMATION pi{};
-
-    std::string mutableCmd = cmdLine;
-    BOOL ok = CreateProcessA(
-        nullptr,
-        &mutableCmd[0],
-        nullptr,
-        nullptr,
-        FALSE,
-        0,
-        nullptr,
-        nullptr,
-        &si,
-        &pi
-    );
-
-    if (!ok) {
-        return false;
-    }
+// Page text and urls are UTF-8 (decoded references, converted charsets); the
+// ANSI calls would show them as code page characters, so text goes through
+// the W calls as UTF-16
+static std::wstring widenUtf8(const std::string& s) {
+    if (s.empty()) return std::wstring();
+    int len = MultiByteToWideChar(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), nullptr, 0);
+    std::wstring out(len, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), &out[0], len);
+    return out;
+}
 
-    WaitForSingleObject(pi.hProcess, INFINITE);
-    DWORD exitCode = 1;
-    GetExitCodeProcess(pi.hProcess, &exitCode);
-    CloseHandle(pi.hProcess);
-    CloseHandle(pi.hThread);
-    return exitCode == 0;
+static std::string narrowUtf8(const std::wstring& s) {
+    if (s.empty()) return std::string();
+    int len = WideCharToMultiByte(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), nullptr, 0, nullptr, nullptr);
+    std::string out(len, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), &out[0], len, nullptr, nullptr);
+    return out;
 }
 
 static void ensureExeDir() {
@@ -101,73 +84,78 @@ static void ensureExeDir() {
     }
 }
 
-static void loadRenderLines(const std::string& path) {
-    g_renderLines.clear();
+static void showRenderDocument(const RenderDocument& doc) {
+    g_renderLines = layoutRenderDocument(doc);
     g_contentHeight = 0;
     g_scrollY = 0;
-    std::ifstream in(path);
-    if (!in.is_open()) return;
-
-    std::string line;
-    while (std::getline(in, line)) {
-        if (!line.empty() && line.back() == '\r') line.pop_back();
-        if (line.empty()) continue;
-
-        RenderLine out{};
-        out.text = line;
-
-        if (startsWith(line, "TITLE:")) {
-            continue;
-        } else if (startsWith(line, "H1:")) {
-            out.size = 28;
-            out.bold = true;
-            out.spaceBefore = 10;
-            out.spaceAfter = 12;
-            out.text = line.substr(3);
-        } else if (startsWith(line, "H2:")) {
-            out.size = 22;
-            out.bold = true;
-            out.spaceBefore = 8;
-            out.spaceAfter = 10;
-            out.text = line.substr(3);
-        } else if (startsWith(line, "H3:")) {
-            out.size = 18;
-            out.bold = true;
-            out.spaceBefore = 6;
-            out.spaceAfter = 8;
-            out.text = line.substr(3);
-        } else if (startsWith(line, "P:")) {
-            out.size = 16;
-            out.bold = false;
-            out.spaceBefore = 4;
-            out.spaceAfter = 8;
-            out.text = line.substr(2);
-        } else {
-            out.size = 16;
-            out.bold = false;
-            out.spaceBefore = 4;
-            out.spaceAfter = 6;
-        }
+    InvalidateRect(g_contentWnd, nullptr, TRUE);
+}
 
-        if (!out.text.empty() && out.text[0] == ' ') {
-            out.text.erase(out.text.begin());
-        }
+// Runs on a pipeline worker: python fetch into a per-navigation temp file
+static bool fetchWithScript(const std::string& url, const HttpBodySink& onData, std::string& error,
+                            const CancelToken& cancel, std::string& contentType, std::string& finalUrl) {
+    TRACE_SCOPE("fetch", "python fetch");
+    static std::atomic<int> fetchSerial(0);
+    const std::string fetchScript = g_exeDir + "\\internet access & html in txt file\\html_fetching_URL.py";
+    const std::string htmlFile = g_exeDir + "\\output_fetch" + std::to_string(++fetchSerial) + ".html";
 
-        g_renderLines.push_back(out);
+    if (hasControlChars(url)) {
+        error = "Bad url: contains control characters";
+        return false;
+    }
+    // Each argument is quoted so python reads it back whole, quotes included.
+    // The command line is in the ANSI code page, so UTF-8 in the url goes
+    // over percent-encoded.
+    std::string body;
+    bool ok = runProcess({"python", fetchScript, normalizePercentEncoding(url), htmlFile}, &cancel) &&
+              readWholeFile(htmlFile, body);
+    DeleteFileA(htmlFile.c_str());
+    if (!ok) {
+        error = "Fetch failed. Check URL or python.";
+        return false;
     }
+    contentType = "text/html; charset=utf-8"; // the script saves response.text as UTF-8
+    finalUrl = url;
+    return onData(body.data(), body.size());
+}
 
-    InvalidateRect(g_contentWnd, nullptr, TRUE);
+static void updateNavButtons() {
+    bool valid = g_currentTab >= 0 && g_currentTab < static_cast<int>(g_tabs.size());
+    EnableWindow(g_backBtn, valid && g_tabs[g_currentTab].history.canGoBack());
+    EnableWindow(g_forwardBtn, valid && g_tabs[g_currentTab].history.canGoForward());
+}
+
+// Packs idle background tabs and shows the page memory in the title bar
+static void compressBackgroundTabs() {
+    int currentId = (g_currentTab >= 0 && g_currentTab < static_cast<int>(g_tabs.size())) ? g_tabs[g_currentTab].id : -1;
+    g_tabStore.compressBackground(currentId);
+
+    char title[160];
+    snprintf(title, sizeof(title), "Simple Browser - %d tabs, %.1f MB resident, %d compressed (%.1f MB)",
+             g_tabStore.getTabCount(), g_tabStore.getResidentBytes() / (1024.0 * 1024.0),
+             g_tabStore.getCompressedCount(), g_tabStore.getCompressedBytes() / (1024.0 * 1024.0));
+    SetWindowTextW(g_mainWnd, widenUtf8(title).c_str());
+}
+
+static int findTabById(int id) {
+    for (size_t i = 0; i < g_tabs.size(); i++) {
+        if (g_tabs[i].id == id) return static_cast<int>(i);
+    }
+    return -1;
 }
 
 static void selectTab(int index) {
     if (index < 0 || index >= static_cast<int>(g_tabs.size())) return;
     g_currentTab = index;
-    SetWindowTextA(g_urlEdit, g_tabs[index].url.c_str());
-    if (g_tabs[index].url.empty() || !fileExists(g_tabs[index].pageFile)) {
+    g_tabs[index].showingPartial = false;
+    SetWindowTextW(g_urlEdit, widenUtf8(g_tabs[index].url).c_str());
+    std::shared_ptr<const RenderDocument> page = g_tabStore.get(g_tabs[index].id);
+    if (g_tabs[index].url.empty() || !page || page->blocks.empty()) {
         clearContent();
     } else {
-        loadRenderLines(g_tabs[index].pageFile);
+        showRenderDocument(*page);
     }
+    updateNavButtons();
 }
 
 static void addTab(const std::string& url) {
@@ -175,11 +163,7 @@ static void addTab(const std::string& url) {
     tab.url = url;
 
     int idx = static_cast<int>(g_tabs.size());
-    int serial = ++g_tabSerial;
-    tab.htmlFile = g_exeDir + "\\output_tab" + std::to_string(serial) + ".html";
-    tab.pageFile = g_exeDir + "\\page_tab" + std::to_string(serial) + ".txt";
-    DeleteFileA(tab.htmlFile.c_str());
-    DeleteFileA(tab.pageFile.c_str());
+    tab.id = ++g_tabSerial;
     g_tabs.push_back(tab);
 
     TCITEMA item{};
@@ -191,8 +175,9 @@ static void addTab(const std::string& url) {
     TabCtrl_SetCurSel(g_tabCtrl, idx);
     if (url.empty()) {
         g_currentTab = idx;
-        SetWindowTextA(g_urlEdit, "");
+        SetWindowTextW(g_urlEdit, L"");
         clearContent();
+        updateNavButtons();
     } else {
         selectTab(idx);
     }
@@ -209,16 +194,17 @@ static void clearContent() {
 static void closeCurrentTab() {
     if (g_currentTab < 0 || g_currentTab >= static_cast<int>(g_tabs.size())) return;
 
-    DeleteFileA(g_tabs[g_currentTab].htmlFile.c_str());
-    DeleteFileA(g_tabs[g_currentTab].pageFile.c_str());
+    g_pipeline->cancelTab(g_tabs[g_currentTab].id);
+    g_tabStore.remove(g_tabs[g_currentTab].id);
 
     TabCtrl_DeleteItem(g_tabCtrl, g_currentTab);
     g_tabs.erase(g_tabs.begin() + g_currentTab);
 
     if (g_tabs.empty()) {
         g_currentTab = -1;
-        SetWindowTextA(g_urlEdit, "");
+        SetWindowTextW(g_urlEdit, L"");
         clearContent();
+        updateNavButtons();
         return;
     }
 
@@ -230,29 +216,105 @@ static void closeCurrentTab() {
     selectTab(newIndex);
 }
 
+// Pages already parsed (visited before or prefetched) are shown without a fetch or a parse
+static bool showCachedPage(TabData& tab) {
+    std::shared_ptr<const RenderDocument> cached = g_docCache.get(tab.url);
+    if (!cached) return false;
+    g_pipeline->cancelTab(tab.id);
+    tab.pendingNavigation = 0;
+    tab.showingPartial = false;
+    g_tabStore.set(tab.id, cached);
+    showRenderDocument(*cached);
+    if (g_prefetcher) {
+        std::map<std::string, std::string>::const_iterator redirect = g_redirects.find(tab.url);
+        g_prefetcher->prefetch(redirect != g_redirects.end() ? redirect->second : tab.url, cached->links);
+    }
+    return true;
+}
+
 static void handleGo() {
     if (g_currentTab < 0 || g_currentTab >= static_cast<int>(g_tabs.size())) return;
 
-    char urlBuf[2048]{};
-    GetWindowTextA(g_urlEdit, urlBuf, static_cast<int>(sizeof(urlBuf)));
-    g_tabs[g_currentTab].url = urlBuf;
+    wchar_t urlBuf[2048]{};
+    GetWindowTextW(g_urlEdit, urlBuf, static_cast<int>(sizeof(urlBuf) / sizeof(urlBuf[0])));
+    std::string url = narrowUtf8(urlBuf);
+    TabData& tab = g_tabs[g_currentTab];
+    bool reload = tab.url == url;
+    tab.url = url;
+    tab.history.visit(tab.url);
+    updateNavButtons();
 
-    const std::string fetchScript = g_exeDir + "\\internet access & html in txt file\\html_fetching_URL.py";
-    const std::string parserExe = g_exeDir + "\\html_parser.exe";
+    // Go on the page already shown is a reload and always loads it again
+    if (!reload && showCachedPage(tab)) return;
 
-    std::string fetchCmd = "python " + quote(fetchScript) + " " + quote(g_tabs[g_currentTab].url) + " " + quote(g_tabs[g_currentTab].htmlFile);
-    std::string parseCmd = quote(parserExe) + " " + quote(g_tabs[g_currentTab].htmlFile) + " " + quote(g_tabs[g_currentTab].pageFile);
+    // Load on the pipeline; the result comes back as WM_PAGE_LOADED
+    tab.pendingNavigation = g_pipeline->navigate(tab.id, tab.url);
+    tab.showingPartial = false;
+}
 
-    if (!runCommand(fetchCmd)) {
-        MessageBoxA(nullptr, "Fetch failed. Check URL or python.", "Error", MB_OK | MB_ICONERROR);
+static void handleHistory(bool forward) {
+    if (g_currentTab < 0 || g_currentTab >= static_cast<int>(g_tabs.size())) return;
+    TabData& tab = g_tabs[g_currentTab];
+    std::string url = forward ? tab.history.goForward() : tab.history.goBack();
+    if (url.empty()) return;
+    tab.url = url;
+    SetWindowTextW(g_urlEdit, widenUtf8(url).c_str());
+    updateNavButtons();
+
+    if (showCachedPage(tab)) return;
+    tab.pendingNavigation = g_pipeline->navigate(tab.id, url);
+    tab.showingPartial = false;
+}
+
+static void handlePageLoaded(PageResult* result) {
+    TRACE_SCOPE("ui", "page loaded");
+    int idx = findTabById(result->tabId);
+    // Ignore results for closed tabs or navigations that were superseded
+    if (idx < 0 || g_tabs[idx].pendingNavigation != result->navigationId) {
+        delete result;
         return;
     }
-    if (!runCommand(parseCmd)) {
-        MessageBoxA(nullptr, "Parse failed. Check html_parser.exe.", "Error", MB_OK | MB_ICONERROR);
+
+    TabData& tab = g_tabs[idx];
+    if (result->status == PAGE_PARTIAL) {
+        // Draw lines as soon as they are parsed instead of waiting for the whole page
+        if (idx == g_currentTab) {
+            if (result->firstLine == 0) {
+                g_renderLines.clear();
+                g_scrollY = 0;
+                tab.showingPartial = true;
+            }
+            if (tab.showingPartial && g_renderLines.size() == result->firstLine) {
+                g_renderLines.insert(g_renderLines.end(), result->lines.begin(), result->lines.end());
+                g_contentHeight = 0;
+                InvalidateRect(g_contentWnd, nullptr, TRUE);
+            }
+        }
+        delete result;
         return;
     }
 
-    loadRenderLines(g_tabs[g_currentTab].pageFile);
+    bool keepScroll = tab.showingPartial;
+    tab.pendingNavigation = 0;
+    tab.showingPartial = false;
+    if (result->status == PAGE_FAILED) {
+        MessageBoxW(nullptr, widenUtf8(result->error).c_str(), L"Error", MB_OK | MB_ICONERROR);
+    } else if (result->status == PAGE_OK) {
+        std::shared_ptr<const RenderDocument> doc = std::make_shared<RenderDocument>(std::move(result->doc));
+        g_tabStore.set(tab.id, doc);
+        g_docCache.put(result->url, doc);
+        // Links are relative to where the page came from after redirects
+        if (result->finalUrl != result->url) g_redirects[result->url] = result->finalUrl;
+        else g_redirects.erase(result->url);
+        if (g_prefetcher && idx == g_currentTab) g_prefetcher->prefetch(result->finalUrl, doc->links);
+        if (idx == g_currentTab) {
+            g_renderLines.swap(result->lines);
+            g_contentHeight = 0;
+            if (!keepScroll) g_scrollY = 0;
+            InvalidateRect(g_contentWnd, nullptr, TRUE);
+        }
+    }
+    delete result;
 }
 
 static void layoutControls(HWND hwnd) {
@@ -261,12 +323,15 @@ static void layoutControls(HWND hwnd) {
 
     int topBarH = 70;
     int pad = 8;
+    int navW = 40;
     int btnW = 70;
     int addW = 80;
     int closeW = 90;
 
     MoveWindow(g_tabCtrl, pad, pad, rc.right - pad * 2, 28, TRUE);
-    MoveWindow(g_urlEdit, pad, 40, rc.right - pad * 4 - btnW - addW - closeW, 24, TRUE);
+    MoveWindow(g_backBtn, pad, 40, navW, 24, TRUE);
+    MoveWindow(g_forwardBtn, pad * 2 + navW, 40, navW, 24, TRUE);
+    MoveWindow(g_urlEdit, pad * 3 + navW * 2, 40, rc.right - pad * 6 - navW * 2 - btnW - addW - closeW, 24, TRUE);
     MoveWindow(g_goBtn, rc.right - pad * 3 - addW - closeW - btnW, 40, btnW, 24, TRUE);
     MoveWindow(g_addTabBtn, rc.right - pad * 2 - closeW - addW, 40, addW, 24, TRUE);
     MoveWindow(g_closeTabBtn, rc.right - pad - closeW, 40, closeW, 24, TRUE);
@@ -274,6 +339,7 @@ static void layoutControls(HWND hwnd) {
 }
 
 static void drawContent(HDC hdc, const RECT& rc) {
+    TRACE_SCOPE("ui", "draw content");
     int x = rc.left + 10;
     int layoutY = 10;
     int maxW = rc.right - rc.left - 20;
@@ -289,11 +355,12 @@ static void drawContent(HDC hdc, const RECT& rc) {
         HFONT font = CreateFontIndirect(&lf);
         HFONT oldFont = (HFONT)SelectObject(hdc, font);
 
+        std::wstring text = widenUtf8(line.text);
         RECT calcRc{ x, layoutY, x + maxW, rc.bottom };
-        DrawTextA(hdc, line.text.c_str(), -1, &calcRc, DT_LEFT | DT_TOP | DT_WORDBREAK | DT_CALCRECT | DT_NOPREFIX);
+        DrawTextW(hdc, text.c_str(), -1, &calcRc, DT_LEFT | DT_TOP | DT_WORDBREAK | DT_CALCRECT | DT_NOPREFIX);
         int drawY = rc.top + layoutY - g_scrollY;
         RECT textRc{ x, drawY, x + maxW, rc.bottom };
-        DrawTextA(hdc, line.text.c_str(), -1, &textRc, DT_LEFT | DT_TOP | DT_WORDBREAK | DT_NOPREFIX);
+        DrawTextW(hdc, text.c_str(), -1, &textRc, DT_LEFT | DT_TOP | DT_WORDBREAK | DT_NOPREFIX);
 
         layoutY = (calcRc.bottom - rc.top) + line.spaceAfter;
         g_contentHeight = layoutY + 10;
@@ -400,7 +467,8 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         g_tabCtrl = CreateWindowExA(0, WC_TABCONTROLA, "", WS_CHILD | WS_VISIBLE,
             0, 0, 0, 0, hwnd, nullptr, nullptr, nullptr);
 
-        g_urlEdit = CreateWindowExA(WS_EX_CLIENTEDGE, "EDIT", "",
+        // A Unicode edit, so urls with non-ASCII characters survive the round trip
+        g_urlEdit = CreateWindowExW(WS_EX_CLIENTEDGE, L"EDIT", L"",
             WS_CHILD | WS_VISIBLE | ES_AUTOHSCROLL,
             0, 0, 0, 0, hwnd, (HMENU)1, nullptr, nullptr);
 
@@ -416,14 +484,26 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             WS_CHILD | WS_VISIBLE,
             0, 0, 0, 0, hwnd, (HMENU)4, nullptr, nullptr);
 
+        g_backBtn = CreateWindowExA(0, "BUTTON", "<",
+            WS_CHILD | WS_VISIBLE | WS_DISABLED,
+            0, 0, 0, 0, hwnd, (HMENU)5, nullptr, nullptr);
+
+        g_forwardBtn = CreateWindowExA(0, "BUTTON", ">",
+            WS_CHILD | WS_VISIBLE | WS_DISABLED,
+            0, 0, 0, 0, hwnd, (HMENU)6, nullptr, nullptr);
+
         g_contentWnd = CreateWindowExA(WS_EX_CLIENTEDGE, "STATIC", "",
             WS_CHILD | WS_VISIBLE | WS_VSCROLL | WS_CLIPSIBLINGS,
             0, 0, 0, 0, hwnd, nullptr, nullptr, nullptr);
         SetWindowLongPtrA(g_contentWnd, GWLP_WNDPROC, (LONG_PTR)ContentProc);
 
         layoutControls(hwnd);
+        SetTimer(hwnd, 1, 5000, nullptr);
         return 0;
     }
+    case WM_TIMER:
+        if (wParam == 1) compressBackgroundTabs();
+        return 0;
     case WM_SIZE:
         layoutControls(hwnd);
         return 0;
@@ -440,6 +520,14 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             closeCurrentTab();
             return 0;
         }
+        if (LOWORD(wParam) == 5) {
+            handleHistory(false);
+            return 0;
+        }
+        if (LOWORD(wParam) == 6) {
+            handleHistory(true);
+            return 0;
+        }
         return 0;
     case WM_NOTIFY:
         if (((LPNMHDR)lParam)->hwndFrom == g_tabCtrl && ((LPNMHDR)lParam)->code == TCN_SELCHANGE) {
@@ -458,7 +546,19 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         }
         return 0;
     }
+    case WM_PAGE_LOADED:
+        handlePageLoaded(reinterpret_cast<PageResult*>(lParam));
+        return 0;
     case WM_DESTROY:
+        KillTimer(hwnd, 1);
+        delete g_prefetcher;
+        g_prefetcher = nullptr;
+        delete g_pipeline;
+        g_pipeline = nullptr;
+        if (!g_traceFile.empty()) {
+            std::string error;
+            writeTraceFile(g_traceFile, error);
+        }
         PostQuitMessage(0);
         return 0;
     default:
@@ -466,8 +566,17 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     }
 }
 
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR cmdLine, int nCmdShow) {
     ensureExeDir();
+    std::string args = cmdLine ? cmdLine : "";
+    if (args.compare(0, 8, "--trace ") == 0) {
+        g_traceFile = args.substr(8);
+        if (g_traceFile.size() > 1 && g_traceFile.front() == '"' && g_traceFile.back() == '"') {
+            g_traceFile = g_traceFile.substr(1, g_traceFile.size() - 2);
+        }
+        enableTracing();
+        setTraceThreadName("ui");
+    }
 
     WNDCLASSA contentClass{};
     contentClass.lpfnWndProc = ContentProc;
@@ -497,6 +606,18 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
     );
 
     if (!hwnd) return 0;
+    g_mainWnd = hwnd;
+    // http:// is fetched natively over pooled connections, https:// still goes through python
+    std::shared_ptr<HttpClient> http = std::make_shared<HttpClient>();
+    std::shared_ptr<HttpCache> cache = std::make_shared<HttpCache>(g_exeDir + "\\http_cache", 64LL * 1024 * 1024);
+    PageFetcher fetcher = makeHttpFetcher(http, fetchWithScript, cache);
+    g_pipeline = new PagePipeline(2, fetcher, [](PageResult* result) {
+        if (!PostMessageA(g_mainWnd, WM_PAGE_LOADED, 0, reinterpret_cast<LPARAM>(result))) {
+            delete result;
+        }
+    });
+    g_pipeline->setPublishPartial(true);
+    g_prefetcher = new LinkPrefetcher(fetcher, g_docCache);
     ShowWindow(hwnd, nCmdShow);
 
     MSG msg;
@@ -0,0 +1,28 @@
+#ifndef CANCEL_TOKEN_H
+#define CANCEL_TOKEN_H
+
+#include <atomic>
+#include <memory>
+
+// ============================================================================
+// CANCELLATION TOKEN
+// ============================================================================
+
+// Copies share one flag, so the UI can keep a token and the worker can poll it
+class CancelToken {
+private:
+    std::shared_ptr<std::atomic<bool>> flag;
+
+public:
+    CancelToken() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() const {
+        flag->store(true);
+    }
+
+    bool isCancelled() const {
+        return flag->load();
+    }
+};
+
+#endif // CANCEL_TOKEN_H
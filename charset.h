@@ -0,0 +1,560 @@
+#ifndef CHARSET_H
+#define CHARSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CHARSET_SSE2 1
+#endif
+
+// ============================================================================
+// ENCODING LABELS (BOM, Content-Type charset, <meta charset>)
+// ============================================================================
+// Everything after decoding is UTF-8. ISO-8859-1 and ASCII labels mean
+// windows-1252, as they do in browsers. Labels for other legacy encodings
+// are not recognized and leave the choice to sniffing.
+
+enum TextEncoding {
+    ENCODING_UTF8,
+    ENCODING_WINDOWS_1252,
+    ENCODING_UTF16LE,
+    ENCODING_UTF16BE
+};
+
+inline const char* encodingName(TextEncoding encoding) {
+    switch (encoding) {
+    case ENCODING_WINDOWS_1252: return "windows-1252";
+    case ENCODING_UTF16LE: return "utf-16le";
+    case ENCODING_UTF16BE: return "utf-16be";
+    default: return "utf-8";
+    }
+}
+
+inline bool isCharsetSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+}
+
+inline bool encodingForLabel(const std::string& label, TextEncoding& out) {
+    static const char* const utf8[] = {"utf-8", "utf8", "unicode-1-1-utf-8", "unicode11utf8", "unicode20utf8",
+                                       "x-unicode20utf8"};
+    static const char* const windows1252[] = {"windows-1252", "cp1252", "x-cp1252", "iso-8859-1", "iso8859-1",
+                                              "iso88591", "iso_8859-1", "iso_8859-1:1987", "iso-ir-100", "latin1",
+                                              "l1", "cp819", "ibm819", "csisolatin1", "us-ascii", "ascii",
+                                              "ansi_x3.4-1968"};
+    static const char* const utf16le[] = {"utf-16", "utf-16le", "ucs-2", "unicode", "csunicode", "iso-10646-ucs-2",
+                                          "unicodefeff"};
+    static const char* const utf16be[] = {"utf-16be", "unicodefffe"};
+
+    size_t start = 0;
+    size_t end = label.size();
+    while (start < end && isCharsetSpace(label[start])) start++;
+    while (end > start && isCharsetSpace(label[end - 1])) end--;
+    std::string name;
+    for (size_t i = start; i < end; i++) {
+        char c = label[i];
+        name += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    struct LabelGroup {
+        const char* const* labels;
+        size_t count;
+        TextEncoding encoding;
+    };
+    static const LabelGroup groups[] = {
+        {utf8, sizeof(utf8) / sizeof(utf8[0]), ENCODING_UTF8},
+        {windows1252, sizeof(windows1252) / sizeof(windows1252[0]), ENCODING_WINDOWS_1252},
+        {utf16le, sizeof(utf16le) / sizeof(utf16le[0]), ENCODING_UTF16LE},
+        {utf16be, sizeof(utf16be) / sizeof(utf16be[0]), ENCODING_UTF16BE}
+    };
+    for (const LabelGroup& group : groups) {
+        for (size_t i = 0; i < group.count; i++) {
+            if (name == group.labels[i]) {
+                out = group.encoding;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Length of the byte order mark data starts with (0 if none), and what it says
+inline size_t detectByteOrderMark(const char* data, size_t len, TextEncoding& out) {
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(data);
+    if (len >= 3 && b[0] == 0xEF && b[1] == 0xBB && b[2] == 0xBF) {
+        out = ENCODING_UTF8;
+        return 3;
+    }
+    if (len >= 2 && (b[0] == 0xFF || b[0] == 0xFE) && b[1] == (b[0] ^ 1)) {
+        out = b[0] == 0xFF ? ENCODING_UTF16LE : ENCODING_UTF16BE;
+        return 2;
+    }
+    return 0;
+}
+
+// The charset parameter of a Content-Type value ("text/html; charset=utf-8"),
+// or of a <meta http-equiv> content attribute, which uses the same syntax
+inline bool charsetFromContentType(const std::string& contentType, TextEncoding& out) {
+    std::string lower(contentType);
+    for (size_t i = 0; i < lower.size(); i++) {
+        if (lower[i] >= 'A' && lower[i] <= 'Z') lower[i] = static_cast<char>(lower[i] - 'A' + 'a');
+    }
+    for (size_t found = lower.find("charset"); found != std::string::npos; found = lower.find("charset", found + 7)) {
+        size_t i = found + 7;
+        while (i < lower.size() && isCharsetSpace(lower[i])) i++;
+        if (i >= lower.size() || lower[i] != '=') continue;
+        i++;
+        while (i < lower.size() && isCharsetSpace(lower[i])) i++;
+        std::string label;
+        if (i < lower.size() && (lower[i] == '"' || lower[i] == '\'')) {
+            size_t close = lower.find(lower[i], i + 1);
+            if (close == std::string::npos) return false;
+            label = lower.substr(i + 1, close - i - 1);
+        } else {
+            size_t stop = i;
+            while (stop < lower.size() && lower[stop] != ';' && !isCharsetSpace(lower[stop])) stop++;
+            label = lower.substr(i, stop - i);
+        }
+        return encodingForLabel(label, out);
+    }
+    return false;
+}
+
+// One name="value" pair of a tag in the prescan; false at the '>' or the end
+inline bool readPrescanAttribute(const char*& p, const char* end, std::string& name, std::string& value) {
+    while (p < end && (isCharsetSpace(*p) || *p == '/')) p++;
+    if (p >= end || *p == '>') return false;
+    name.clear();
+    value.clear();
+    while (p < end && *p != '=' && *p != '>' && *p != '/' && !isCharsetSpace(*p)) {
+        char c = *p++;
+        name += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    while (p < end && isCharsetSpace(*p)) p++;
+    if (p >= end || *p != '=') return true;
+    p++;
+    while (p < end && isCharsetSpace(*p)) p++;
+    if (p < end && (*p == '"' || *p == '\'')) {
+        char quote = *p++;
+        const char* start = p;
+        while (p < end && *p != quote) p++;
+        value.assign(start, p);
+        if (p < end) p++;
+    } else {
+        const char* start = p;
+        while (p < end && *p != '>' && !isCharsetSpace(*p)) p++;
+        value.assign(start, p);
+    }
+    return true;
+}
+
+inline bool startsWithNoCase(const char* p, const char* end, const char* prefix) {
+    for (; *prefix; p++, prefix++) {
+        if (p >= end) return false;
+        char c = (*p >= 'A' && *p <= 'Z') ? static_cast<char>(*p - 'A' + 'a') : *p;
+        if (c != *prefix) return false;
+    }
+    return true;
+}
+
+// The encoding a <meta charset> or <meta http-equiv="Content-Type"> in the
+// first 1024 bytes declares. Comments and other tags are stepped over whole.
+// A UTF-16 declaration can only be wrong for bytes read as ASCII, so it means UTF-8.
+inline bool prescanMetaCharset(const char* data, size_t len, TextEncoding& out) {
+    const char* p = data;
+    const char* end = data + (len < 1024 ? len : 1024);
+    std::string name;
+    std::string value;
+    while (p < end) {
+        const void* lt = memchr(p, '<', static_cast<size_t>(end - p));
+        if (!lt) break;
+        p = static_cast<const char*>(lt);
+        if (startsWithNoCase(p, end, "<!--")) {
+            const char* close = p + 4;
+            while (close + 3 <= end && memcmp(close, "-->", 3) != 0) close++;
+            if (close + 3 > end) break;
+            p = close + 3;
+            continue;
+        }
+        if (startsWithNoCase(p, end, "<meta") && p + 5 < end && (isCharsetSpace(p[5]) || p[5] == '/')) {
+            p += 5;
+            bool pragma = false;
+            bool found = false;
+            TextEncoding declared = ENCODING_UTF8;
+            TextEncoding fromContent = ENCODING_UTF8;
+            bool haveContent = false;
+            while (readPrescanAttribute(p, end, name, value)) {
+                if (name == "charset" && !found) {
+                    found = encodingForLabel(value, declared);
+                } else if (name == "http-equiv") {
+                    pragma = pragma || startsWithNoCase(value.c_str(), value.c_str() + value.size(), "content-type");
+                } else if (name == "content" && !haveContent) {
+                    haveContent = charsetFromContentType(value, fromContent);
+                }
+            }
+            if (!found && pragma && haveContent) {
+                declared = fromContent;
+                found = true;
+            }
+            if (found) {
+                out = declared == ENCODING_UTF16LE || declared == ENCODING_UTF16BE ? ENCODING_UTF8 : declared;
+                return true;
+            }
+            continue;
+        }
+        const void* gt = memchr(p + 1, '>', static_cast<size_t>(end - p - 1));
+        if (!gt) break;
+        p = static_cast<const char*>(gt) + 1;
+    }
+    return false;
+}
+
+// ============================================================================
+// VALIDATION AND TRANSCODING TO UTF-8
+// ============================================================================
+
+// Index of the lowest set bit of a non-zero SSE2 movemask
+inline int lowestSetBit(int mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(static_cast<unsigned>(mask));
+#else
+    int bit = 0;
+    while (!(mask & (1 << bit))) bit++;
+    return bit;
+#endif
+}
+
+// First byte >= 0x80 in [p, end), or end. Sixteen bytes are tested at once,
+// so pure ASCII input is checked at memory speed.
+inline const char* findNonAscii(const char* p, const char* end) {
+#ifdef CHARSET_SSE2
+    while (end - p >= 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        if (mask) return p + lowestSetBit(mask);
+        p += 16;
+    }
+#endif
+    while (p < end && static_cast<unsigned char>(*p) < 0x80) p++;
+    return p;
+}
+
+inline char* appendUtf8(char* out, uint32_t cp) {
+    if (cp < 0x80) {
+        *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (cp >> 6));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (cp >> 12));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (cp >> 18));
+        *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+inline void appendUtf8(std::string& out, uint32_t cp) {
+    char buffer[4];
+    out.append(buffer, static_cast<size_t>(appendUtf8(buffer, cp) - buffer));
+}
+
+// Unicode for a windows-1252 byte; 0x80-0x9F are where it differs from Latin-1
+inline uint32_t windows1252CodePoint(unsigned char b) {
+    static const uint16_t high[32] = {
+        0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+        0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+        0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+        0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+    };
+    return b >= 0x80 && b <= 0x9F ? high[b - 0x80] : b;
+}
+
+// The multi-byte sequence at p (lead byte >= 0x80): its length when it is
+// well-formed, 0 when it is well-formed so far but cut off by end, or minus
+// the length of the ill-formed part that one U+FFFD replaces
+inline int checkUtf8Sequence(const unsigned char* p, const unsigned char* end) {
+    unsigned char lead = p[0];
+    int need;
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        need = 1;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        need = 2;
+        if (lead == 0xE0) low = 0xA0;       // overlong
+        if (lead == 0xED) high = 0x9F;      // surrogates
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        need = 3;
+        if (lead == 0xF0) low = 0x90;       // overlong
+        if (lead == 0xF4) high = 0x8F;      // past U+10FFFF
+    } else {
+        return -1;
+    }
+    for (int k = 1; k <= need; k++) {
+        if (p + k >= end) return 0;
+        unsigned char c = p[k];
+        unsigned char lo = k == 1 ? low : 0x80;
+        unsigned char hi = k == 1 ? high : 0xBF;
+        if (c < lo || c > hi) return -k;
+    }
+    return need + 1;
+}
+
+enum Utf8Check {
+    UTF8_VALID,
+    UTF8_TRUNCATED,   // valid, but the last sequence is cut off
+    UTF8_INVALID
+};
+
+// valid is set to how many leading bytes are whole, well-formed UTF-8
+inline Utf8Check checkUtf8(const char* data, size_t len, size_t& valid) {
+    const char* p = data;
+    const char* end = data + len;
+    while (p < end) {
+        if (static_cast<unsigned char>(*p) < 0x80) {
+            p = findNonAscii(p, end);
+            continue;
+        }
+        int n = checkUtf8Sequence(reinterpret_cast<const unsigned char*>(p),
+                                  reinterpret_cast<const unsigned char*>(end));
+        if (n <= 0) {
+            valid = static_cast<size_t>(p - data);
+            return n == 0 ? UTF8_TRUNCATED : UTF8_INVALID;
+        }
+        p += n;
+    }
+    valid = len;
+    return UTF8_VALID;
+}
+
+// Appends data as UTF-8, with every ill-formed part replaced by U+FFFD. A
+// sequence cut off by the end is left out and its length returned, unless
+// final says no more input follows.
+inline size_t appendRepairedUtf8(const char* data, size_t len, bool final, std::string& out) {
+    const char* p = data;
+    const char* end = data + len;
+    while (p < end) {
+        size_t valid;
+        Utf8Check check = checkUtf8(p, static_cast<size_t>(end - p), valid);
+        out.append(p, valid);
+        p += valid;
+        if (check == UTF8_VALID) break;
+        if (check == UTF8_TRUNCATED) {
+            if (!final) return static_cast<size_t>(end - p);
+            appendUtf8(out, 0xFFFD);
+            break;
+        }
+        int n = checkUtf8Sequence(reinterpret_cast<const unsigned char*>(p),
+                                  reinterpret_cast<const unsigned char*>(end));
+        appendUtf8(out, 0xFFFD);
+        p += -n;
+    }
+    return 0;
+}
+
+// ASCII runs are found with findNonAscii and copied in bulk
+inline void appendWindows1252AsUtf8(const char* data, size_t len, std::string& out) {
+    const char* p = data;
+    const char* end = data + len;
+    out.reserve(out.size() + len + len / 8);
+    while (p < end) {
+        const char* high = findNonAscii(p, end);
+        out.append(p, static_cast<size_t>(high - p));
+        if (high == end) break;
+        appendUtf8(out, windows1252CodePoint(static_cast<unsigned char>(*high)));
+        p = high + 1;
+    }
+}
+
+// Appends the UTF-16 code units of data (an even number of bytes) as UTF-8.
+// A high surrogate at the very end is handed back in pendingHigh, not written.
+inline void appendUtf16AsUtf8(const char* data, size_t len, bool bigEndian, uint32_t& pendingHigh,
+                              std::string& out) {
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(data);
+    for (size_t i = 0; i + 1 < len; i += 2) {
+        uint32_t unit = bigEndian ? (b[i] << 8 | b[i + 1]) : (b[i + 1] << 8 | b[i]);
+        if (pendingHigh) {
+            if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                appendUtf8(out, 0x10000 + ((pendingHigh - 0xD800) << 10) + (unit - 0xDC00));
+                pendingHigh = 0;
+                continue;
+            }
+            appendUtf8(out, 0xFFFD);
+            pendingHigh = 0;
+        }
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            pendingHigh = unit;
+        } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            appendUtf8(out, 0xFFFD);
+        } else {
+            appendUtf8(out, unit);
+        }
+    }
+}
+
+// ============================================================================
+// BODY DECODER (raw page bytes -> UTF-8, chunk by chunk)
+// ============================================================================
+
+// Normalizes raw fetched bytes before tokenizing, chunk by chunk. The encoding
+// is settled once, from the first of: a byte order mark, the Content-Type
+// charset, a <meta> charset in the first 1024 bytes, and finally the bytes
+// themselves (UTF-8 if they are valid UTF-8, else windows-1252). Until then up
+// to 1024 bytes are held back. ASCII and valid UTF-8 pass through uncopied.
+class BodyDecoder {
+private:
+    static const size_t SNIFF_BYTES = 1024;
+
+    const std::string* contentType; // read when the first bytes arrive
+    std::string head;               // held back until the encoding is settled
+    std::string carry;              // a sequence or code unit cut off by the last chunk
+    std::string joined;
+    uint32_t pendingHigh = 0;
+    bool settled = false;
+    TextEncoding encoding = ENCODING_UTF8;
+
+    // Picks the encoding from the start of the body; returns the BOM length
+    size_t settle(const char* data, size_t len) {
+        settled = true;
+        size_t bom = detectByteOrderMark(data, len, encoding);
+        if (bom) return bom;
+        if (contentType && charsetFromContentType(*contentType, encoding)) return 0;
+        if (prescanMetaCharset(data, len, encoding)) return 0;
+        size_t valid;
+        encoding = checkUtf8(data, len, valid) == UTF8_INVALID ? ENCODING_WINDOWS_1252 : ENCODING_UTF8;
+        return 0;
+    }
+
+    std::string_view convert(const char* data, size_t len, bool final, std::string& scratch) {
+        // Bytes passed through must outlive this call, so a chunk joined to
+        // the carry is handed out from scratch rather than from joined
+        bool usedJoined = !carry.empty();
+        if (usedJoined) {
+            joined.assign(carry);
+            joined.append(data, len);
+            carry.clear();
+            data = joined.data();
+            len = joined.size();
+        }
+
+        if (encoding == ENCODING_UTF8) {
+            size_t valid;
+            Utf8Check check = checkUtf8(data, len, valid);
+            if (check == UTF8_VALID || (check == UTF8_TRUNCATED && !final)) {
+                carry.assign(data + valid, len - valid);
+                return usedJoined ? std::string_view(scratch.assign(data, valid)) : std::string_view(data, valid);
+            }
+            scratch.clear();
+            size_t cut = appendRepairedUtf8(data, len, final, scratch);
+            carry.assign(data + len - cut, cut);
+            return scratch;
+        }
+        if (encoding == ENCODING_WINDOWS_1252) {
+            if (findNonAscii(data, data + len) == data + len) {
+                return usedJoined ? std::string_view(scratch.assign(data, len)) : std::string_view(data, len);
+            }
+            scratch.clear();
+            appendWindows1252AsUtf8(data, len, scratch);
+            return scratch;
+        }
+
+        scratch.clear();
+        size_t even = len & ~static_cast<size_t>(1);
+        appendUtf16AsUtf8(data, even, encoding == ENCODING_UTF16BE, pendingHigh, scratch);
+        if (even < len) carry.assign(data + even, 1);
+        if (final && (pendingHigh || !carry.empty())) {
+            appendUtf8(scratch, 0xFFFD);
+            pendingHigh = 0;
+            carry.clear();
+        }
+        return scratch;
+    }
+
+public:
+    // contentType (may be null) is read when the first bytes arrive, so a
+    // fetcher can fill it in after the decoder is made
+    explicit BodyDecoder(const std::string* type = nullptr) : contentType(type) {}
+
+    // The decoded form of data. It points into data itself when the bytes need
+    // no conversion, otherwise into scratch; valid until the next call.
+    std::string_view decodeChunk(const char* data, size_t len, std::string& scratch) {
+        if (settled) return convert(data, len, false, scratch);
+        head.append(data, len);
+        // With a charset in the header only a byte order mark can still overrule it
+        TextEncoding declared;
+        bool typed = contentType && charsetFromContentType(*contentType, declared);
+        if (head.size() < (typed ? 3 : SNIFF_BYTES)) return std::string_view();
+        std::string start;
+        start.swap(head);
+        size_t bom = settle(start.data(), start.size());
+        std::string_view out = convert(start.data() + bom, start.size() - bom, false, scratch);
+        if (out.data() != scratch.data()) out = scratch.assign(out.data(), out.size());
+        return out;
+    }
+
+    // Whatever was held back, once the body is complete
+    std::string_view finishChunk(std::string& scratch) {
+        std::string start;
+        start.swap(head);
+        size_t bom = settled ? 0 : settle(start.data(), start.size());
+        std::string_view out = convert(start.data() + bom, start.size() - bom, true, scratch);
+        if (out.data() != scratch.data()) out = scratch.assign(out.data(), out.size());
+        return out;
+    }
+
+    // Appends the decoded form of data to out
+    void decode(const char* data, size_t len, std::string& out) {
+        std::string scratch;
+        std::string_view text = decodeChunk(data, len, scratch);
+        out.append(text.data(), text.size());
+    }
+
+    void finish(std::string& out) {
+        std::string scratch;
+        std::string_view text = finishChunk(scratch);
+        out.append(text.data(), text.size());
+    }
+
+    TextEncoding getEncoding() const {
+        return encoding;
+    }
+};
+
+// A whole document at once: returns data itself (past any BOM) when it needs
+// no conversion, otherwise the UTF-8 in scratch. data must be NUL-terminated.
+inline const char* decodeHtmlDocument(const char* data, size_t len, const std::string& contentType,
+                                      std::string& scratch, TextEncoding* encoding = nullptr) {
+    TextEncoding found = ENCODING_UTF8;
+    size_t bom = detectByteOrderMark(data, len, found);
+    if (!bom && !charsetFromContentType(contentType, found) && !prescanMetaCharset(data, len, found)) {
+        size_t valid;
+        found = checkUtf8(data, len, valid) == UTF8_INVALID ? ENCODING_WINDOWS_1252 : ENCODING_UTF8;
+    }
+    if (encoding) *encoding = found;
+
+    const char* text = data + bom;
+    size_t textLen = len - bom;
+    scratch.clear();
+    if (found == ENCODING_UTF8) {
+        size_t valid;
+        if (checkUtf8(text, textLen, valid) == UTF8_VALID) return text;
+        appendRepairedUtf8(text, textLen, true, scratch);
+    } else if (found == ENCODING_WINDOWS_1252) {
+        if (findNonAscii(text, text + textLen) == text + textLen) return text;
+        appendWindows1252AsUtf8(text, textLen, scratch);
+    } else {
+        uint32_t pendingHigh = 0;
+        appendUtf16AsUtf8(text, textLen, found == ENCODING_UTF16BE, pendingHigh, scratch);
+        if (pendingHigh || (textLen & 1)) appendUtf8(scratch, 0xFFFD);
+    }
+    return scratch.c_str();
+}
+
+#endif // CHARSET_H
@@ -0,0 +1,253 @@
+#ifndef CRAWLER_H
+#define CRAWLER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "page_pipeline.h"
+#include "http_cache.h"
+#include "url_canon.h"
+
+// ============================================================================
+// CRAWLER (breadth-first over links, polite per host, parsed on a worker pool)
+// ============================================================================
+// run() is the dispatcher: it hands the shallowest waiting page of any host
+// that is idle and past its delay to the pool, and delivers finished pages to
+// the caller's sink on the calling thread. Every url seen gets a vertex in the
+// link graph; every page-to-page link an edge.
+
+struct CrawlOptions {
+    int maxDepth = 2;           // seeds are depth 0
+    int maxPages = 100;         // pages fetched, seeds included
+    int workers = 4;
+    int hostDelayMs = 250;      // pause after each request before the same host is asked again
+    bool sameHostOnly = true;   // only follow links to the seeds' hosts
+};
+
+struct CrawlPage {
+    int id = -1;                // vertex in the link graph
+    std::string url;
+    int depth = 0;
+    bool ok = false;
+    std::string title;
+    size_t bytes = 0;
+    int links = 0;              // distinct pages it links to
+    double ms = 0;
+    std::string error;
+};
+
+typedef std::function<void(const CrawlPage& page)> CrawlPageSink;
+
+class Crawler {
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct CrawlTask {
+        int id = -1;
+        int depth = 0;
+    };
+
+    // One politeness queue per scheme://host:port, at most one request in flight
+    struct HostQueue {
+        Queue<CrawlTask> pending;
+        bool busy = false;
+        Clock::time_point nextAllowed;
+    };
+
+    PageFetcher fetcher;
+    CrawlOptions options;
+    CancelToken cancelled;
+
+    std::mutex lock;
+    std::condition_variable changed;
+    UrlSeenIndex<int> urlIds;            // canonical url -> vertex
+    std::vector<std::string> urls;       // vertex -> canonical url
+    std::vector<char> queued;            // vertex -> ever scheduled
+    std::map<std::string, HostQueue> hosts;
+    std::set<std::string> allowedHosts;
+    Graph linkGraph;
+    int graphCapacity;
+    int scheduled;
+    int inFlight;
+    Queue<CrawlPage*> finished;
+
+    WorkerPool pool; // declared last so workers stop before the members above go away
+
+    static std::string hostKey(const ParsedUrl& url) {
+        return url.scheme + "://" + url.host + ":" + std::to_string(url.port);
+    }
+
+    // Caller holds the lock
+    int idFor(const std::string& canonical) {
+        int* known = urlIds.find(canonical);
+        if (known) return *known;
+        int id = static_cast<int>(urls.size());
+        urlIds.add(canonical, id);
+        urls.push_back(canonical);
+        queued.push_back(0);
+        if (id >= graphCapacity) {
+            graphCapacity *= 2;
+            linkGraph.ensureCapacity(graphCapacity);
+        }
+        linkGraph.addVertex(id);
+        return id;
+    }
+
+    // Caller holds the lock
+    void schedule(int id, int depth) {
+        if (queued[id] || scheduled >= options.maxPages || depth > options.maxDepth) return;
+        ParsedUrl parsed;
+        if (!parseUrl(urls[id], parsed)) return;
+        std::string key = hostKey(parsed);
+        if (options.sameHostOnly && allowedHosts.count(key) == 0) return;
+
+        CrawlTask task;
+        task.id = id;
+        task.depth = depth;
+        hosts[key].pending.enqueue(task);
+        queued[id] = 1;
+        scheduled++;
+    }
+
+    void fetchAndParse(CrawlTask task, std::string url, std::string key) {
+        CrawlPage* page = new CrawlPage();
+        page->id = task.id;
+        page->url = url;
+        page->depth = task.depth;
+        Clock::time_point start = Clock::now();
+
+        std::string body;
+        std::string contentType;
+        std::string finalUrl;
+        BodyDecoder decoder(&contentType);
+        HttpBodySink onData = [&](const char* data, size_t len) {
+            if (cancelled.isCancelled()) return false;
+            decoder.decode(data, len, body);
+            return true;
+        };
+        page->ok = fetcher(url, onData, page->error, cancelled, contentType, finalUrl) && !cancelled.isCancelled();
+
+        std::vector<std::string> targets;
+        if (page->ok) {
+            decoder.finish(body);
+            page->bytes = body.size();
+            HTMLParser parser;
+            parser.parse(body.c_str());
+            RenderDocument doc = parser.buildRenderDocument();
+            page->title = doc.title;
+            for (size_t i = 0; i < doc.links.size(); i++) {
+                if (doc.links[i].href.empty() || doc.links[i].href[0] == '#') continue;
+                // After /dir -> /dir/ the links are relative to /dir/, not to what was asked for
+                std::string target = resolveUrl(finalUrl.empty() ? url : finalUrl, doc.links[i].href);
+                ParsedUrl parsed;
+                if (!parseUrl(target, parsed) || (parsed.scheme != "http" && parsed.scheme != "https")) continue;
+                targets.push_back(canonicalizeUrl(target));
+            }
+        }
+        page->ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            std::set<int> linked;
+            for (size_t i = 0; i < targets.size(); i++) {
+                int target = idFor(targets[i]);
+                if (target == task.id || !linked.insert(target).second) continue;
+                linkGraph.addEdge(task.id, target);
+                schedule(target, task.depth + 1);
+            }
+            page->links = static_cast<int>(linked.size());
+
+            HostQueue& host = hosts[key];
+            host.busy = false;
+            host.nextAllowed = Clock::now() + std::chrono::milliseconds(options.hostDelayMs);
+            inFlight--;
+            finished.enqueue(page);
+        }
+        changed.notify_all();
+    }
+
+public:
+    Crawler(const PageFetcher& fetch, const CrawlOptions& opts)
+        : fetcher(fetch), options(opts), urlIds(4096), linkGraph(1024), graphCapacity(1024), scheduled(0), inFlight(0),
+          pool(opts.workers) {}
+
+    ~Crawler() {
+        cancel();
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait(guard, [this] { return inFlight == 0; });
+        while (!finished.isEmpty()) delete finished.dequeue();
+    }
+
+    // Crawls from seeds until the frontier is empty, maxPages were fetched or
+    // cancel() is called. Returns the number of pages fetched successfully.
+    int run(const std::vector<std::string>& seeds, const CrawlPageSink& sink) {
+        std::unique_lock<std::mutex> guard(lock);
+        for (size_t i = 0; i < seeds.size(); i++) {
+            ParsedUrl parsed;
+            std::string url = canonicalizeUrl(seeds[i]);
+            if (!parseUrl(url, parsed)) continue;
+            allowedHosts.insert(hostKey(parsed));
+            schedule(idFor(url), 0);
+        }
+
+        int succeeded = 0;
+        while (true) {
+            while (!finished.isEmpty()) {
+                CrawlPage* page = finished.dequeue();
+                if (page->ok) succeeded++;
+                guard.unlock();
+                sink(*page);
+                delete page;
+                guard.lock();
+            }
+
+            Clock::time_point now = Clock::now();
+            Clock::time_point wakeAt = Clock::time_point::max();
+            std::map<std::string, HostQueue>::iterator best = hosts.end();
+            for (std::map<std::string, HostQueue>::iterator it = hosts.begin(); it != hosts.end(); ++it) {
+                HostQueue& host = it->second;
+                if (host.busy || host.pending.isEmpty() || cancelled.isCancelled()) continue;
+                if (host.nextAllowed > now) {
+                    if (host.nextAllowed < wakeAt) wakeAt = host.nextAllowed;
+                    continue;
+                }
+                if (best == hosts.end() || host.pending.peek().depth < best->second.pending.peek().depth) best = it;
+            }
+
+            if (best != hosts.end()) {
+                CrawlTask task = best->second.pending.dequeue();
+                best->second.busy = true;
+                inFlight++;
+                std::string url = urls[task.id];
+                std::string key = best->first;
+                pool.submit([this, task, url, key] { fetchAndParse(task, url, key); });
+                continue;
+            }
+            if (inFlight == 0 && finished.isEmpty() && wakeAt == Clock::time_point::max()) break;
+
+            if (wakeAt == Clock::time_point::max()) {
+                changed.wait(guard);
+            } else {
+                changed.wait_until(guard, wakeAt);
+            }
+        }
+        return succeeded;
+    }
+
+    void cancel() {
+        cancelled.cancel();
+        changed.notify_all();
+    }
+
+    // The graph and url table are complete once run() returns
+    const Graph& getLinkGraph() const { return linkGraph; }
+    const std::string& getUrl(int id) const { return urls[id]; }
+    int getUrlCount() const { return static_cast<int>(urls.size()); }
+    const UrlSeenIndex<int>& getUrlIndex() const { return urlIds; }
+};
+
+#endif // CRAWLER_H
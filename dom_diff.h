@@ -0,0 +1,199 @@
+#ifndef DOM_DIFF_H
+#define DOM_DIFF_H
+
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+#include "html_parser.h"
+
+// ============================================================================
+// RELOAD RENDERING (a changed page only re-renders the subtrees that changed)
+// ============================================================================
+//
+// Blocks and links are collected in document order, so the blocks of any
+// subtree are one run of the block list, and the same goes for its links.
+// Each render remembers where every subtree's runs went, keyed by subtree
+// hash. The next render copies the runs of any subtree it has seen before
+// and only walks the rest. Subtrees are matched by content, not position,
+// so a paragraph that moved or a section that was duplicated is reused too.
+
+struct ReloadStats {
+    long nodes = 0;          // in the new tree
+    long renderedNodes = 0;  // walked again: new or changed
+    long reusedSubtrees = 0; // copied whole from the previous render
+    long reusedNodes = 0;    // ... and the nodes inside them
+};
+
+class ReloadRenderer {
+private:
+    // Where a subtree's blocks and links sit in the document of render
+    // number round; the node's own block and link, if any, come first
+    struct SubtreeRuns {
+        size_t firstBlock;
+        size_t blocks;
+        size_t firstLink;
+        size_t links;
+        bool ownBlock;
+        bool ownLink;
+        unsigned round;
+    };
+    typedef std::unordered_map<uint64_t, SubtreeRuns> RunIndex;
+
+    LiveDom liveDom;
+    RenderWalker<LiveDom> render;
+    RenderDocument previous;
+    // One index for every render, updated in place: an entry is usable if
+    // it is from the previous render or already from this one. Older
+    // entries are dropped once they outnumber the rest.
+    RunIndex runs;
+    unsigned round;
+    size_t liveRuns; // entries written by the last render
+
+    bool usable(const SubtreeRuns& at) const {
+        return at.round + 1 == round || at.round == round;
+    }
+
+    // Appends from[first, first + count) to to; from may be to itself
+    template <typename T>
+    static void copyRun(std::vector<T>& to, const std::vector<T>& from, size_t first, size_t count) {
+        to.reserve(to.size() + count);
+        for (size_t i = first; i < first + count; i++) to.push_back(from[i]);
+    }
+
+    // Walks root and everything under it in document order on a Stack (pages
+    // nest deeper than the call stack allows), copying the runs of subtrees
+    // seen before and rendering the rest. A rendered node's runs are stored
+    // once its children are done.
+    void renderSubtree(HTMLNode* root, RenderDocument& doc, ReloadStats& stats) {
+        struct Visit {
+            HTMLNode* node;
+            bool leaving;
+            SubtreeRuns at;
+        };
+        Stack<Visit> pending;
+        pending.push({root, false, SubtreeRuns()});
+        while (!pending.isEmpty()) {
+            Visit visit = pending.pop();
+            HTMLNode* node = visit.node;
+            if (visit.leaving) {
+                SubtreeRuns at = visit.at;
+                at.blocks = doc.blocks.size() - at.firstBlock;
+                at.links = doc.links.size() - at.firstLink;
+                runs[node->subtreeHash] = at;
+                liveRuns++;
+                continue;
+            }
+            // Later siblings come after everything inside node
+            if (node != root && node->nextSibling) pending.push({node->nextSibling, false, SubtreeRuns()});
+
+            SubtreeRuns at = {doc.blocks.size(), 0, doc.links.size(), 0, false, false, round};
+            RunIndex::iterator seen = runs.find(node->subtreeHash);
+            if (seen != runs.end() && usable(seen->second)) {
+                const SubtreeRuns& from = seen->second;
+                const RenderDocument& source = from.round == round ? doc : previous;
+                copyRun(doc.blocks, source.blocks, from.firstBlock, from.blocks);
+                copyRun(doc.links, source.links, from.firstLink, from.links);
+                stats.reusedSubtrees++;
+                carryRuns(node, at.firstBlock, at.firstLink, stats);
+                continue;
+            }
+
+            // Both walks put a node's own block and link before its children's
+            stats.renderedNodes++;
+            render.collectRenderNode(doc, node);
+            RenderLink link;
+            if (render.readLink(node, link)) doc.links.push_back(link);
+            at.ownBlock = doc.blocks.size() > at.firstBlock;
+            at.ownLink = doc.links.size() > at.firstLink;
+            pending.push({node, true, at});
+            if (node->firstChild) pending.push({node->firstChild, false, SubtreeRuns()});
+        }
+    }
+
+    // A reused subtree was not walked, so the runs of everything inside it
+    // are moved to where the copy landed. Every node in it was in the tree
+    // the runs came from, so the index has all of them; a subtree already
+    // placed by this render stays where it is.
+    void carryRuns(HTMLNode* root, size_t firstBlock, size_t firstLink, ReloadStats& stats) {
+        struct Carry {
+            HTMLNode* node;
+            size_t firstBlock;
+            size_t firstLink;
+        };
+        Stack<Carry> pending;
+        pending.push({root, firstBlock, firstLink});
+        while (!pending.isEmpty()) {
+            Carry carry = pending.pop();
+            SubtreeRuns& at = runs.find(carry.node->subtreeHash)->second;
+            // The next sibling's runs start where this subtree's end
+            if (carry.node != root && carry.node->nextSibling) {
+                pending.push({carry.node->nextSibling, carry.firstBlock + at.blocks, carry.firstLink + at.links});
+            }
+            stats.reusedNodes++;
+            if (at.round == round) {
+                stats.reusedNodes += countNodes(carry.node) - 1;
+                continue;
+            }
+            at.firstBlock = carry.firstBlock;
+            at.firstLink = carry.firstLink;
+            at.round = round;
+            liveRuns++;
+
+            if (carry.node->firstChild) {
+                pending.push({carry.node->firstChild, carry.firstBlock + (at.ownBlock ? 1 : 0),
+                              carry.firstLink + (at.ownLink ? 1 : 0)});
+            }
+        }
+    }
+
+    static long countNodes(HTMLNode* root) {
+        long count = 0;
+        Stack<HTMLNode*> pending;
+        pending.push(root);
+        while (!pending.isEmpty()) {
+            HTMLNode* node = pending.pop();
+            count++;
+            for (HTMLNode* child = node->firstChild; child; child = child->nextSibling) pending.push(child);
+        }
+        return count;
+    }
+
+public:
+    ReloadRenderer() : render(liveDom), round(1), liveRuns(0) {}
+
+    // The render document of the tree under root, the same one
+    // HTMLParser::buildRenderDocument gives. Hashes the tree first; the
+    // first call (or the first after clear) walks all of it.
+    const RenderDocument& renderTree(HTMLNode* root, ReloadStats* stats = nullptr) {
+        TRACE_SCOPE("render", "reload render");
+        ReloadStats counted;
+        RenderDocument doc;
+        round++;
+        liveRuns = 0;
+        if (root) {
+            hashSubtree(root);
+            render.findTitle(root, doc.title);
+            renderSubtree(root, doc, counted);
+        }
+        counted.nodes = counted.renderedNodes + counted.reusedNodes;
+        if (stats) *stats = counted;
+
+        if (runs.size() > 2 * liveRuns + 1024) {
+            for (RunIndex::iterator it = runs.begin(); it != runs.end();) {
+                it = it->second.round == round ? std::next(it) : runs.erase(it);
+            }
+        }
+        previous = std::move(doc);
+        return previous;
+    }
+
+    // Forget the previous render, e.g. before a different page
+    void clear() {
+        previous = RenderDocument();
+        runs.clear();
+        liveRuns = 0;
+    }
+};
+
+#endif // DOM_DIFF_H
@@ -0,0 +1,455 @@
+#ifndef DOM_SNAPSHOT_H
+#define DOM_SNAPSHOT_H
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "html_parser.h"
+
+// ============================================================================
+// DOM SNAPSHOT FILE FORMAT
+// ============================================================================
+//
+//   header | nodes | attributes | edges | strings
+//
+// Nodes are in document order (pre-order), so node 0 is the root and a
+// node's subtree is the run of nodes after it. Everything refers to nodes
+// by index and to strings by byte offset into the string table, never by
+// address, so the mapped file is used where it lands. Numbers are stored in
+// the writer's byte order; byteOrder tells a reader with the other one to
+// refuse the file. Every section starts 4-byte aligned.
+
+static const char DOM_SNAPSHOT_MAGIC[8] = {'H', 'T', 'M', 'L', 'D', 'O', 'M', '\0'};
+static const uint32_t DOM_SNAPSHOT_VERSION = 1;
+static const uint32_t DOM_SNAPSHOT_BYTE_ORDER = 0x01020304;
+static const uint32_t SNAPSHOT_NO_STRING = 0xFFFFFFFF;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t nodeCount;
+    uint32_t attributeCount;
+    uint32_t edgeCount;
+    uint32_t vertexCount;      // element graph vertices
+    uint64_t nodesOffset;      // byte offsets from the start of the file
+    uint64_t attributesOffset;
+    uint64_t edgesOffset;
+    uint64_t stringsOffset;
+    uint64_t stringBytes;
+    uint64_t fileBytes;
+};
+
+struct SnapshotNode {
+    uint32_t tag;              // string offsets, SNAPSHOT_NO_STRING when absent
+    uint32_t text;
+    int32_t parent;            // node indexes, -1 when absent
+    int32_t firstChild;
+    int32_t nextSibling;
+    uint32_t firstAttribute;   // attributeCount entries from here
+    uint32_t attributeCount;
+    int32_t depth;
+    int32_t nodeId;            // the parser's id, also the element graph vertex
+};
+
+struct SnapshotAttribute {
+    uint32_t name;
+    uint32_t value;
+};
+
+struct SnapshotEdge {
+    int32_t from;              // element graph vertices (node ids)
+    int32_t to;
+};
+
+static_assert(sizeof(SnapshotHeader) == 80, "snapshot header layout");
+static_assert(sizeof(SnapshotNode) == 36, "snapshot node layout");
+static_assert(sizeof(SnapshotAttribute) == 8 && sizeof(SnapshotEdge) == 8, "snapshot record layout");
+
+// ============================================================================
+// SNAPSHOT WRITER
+// ============================================================================
+
+// Lays the tree out once to learn the section sizes, then writes the file
+// front to back. Tag and attribute names are stored once each; text and
+// attribute values follow in document order.
+class DomSnapshotWriter {
+private:
+    struct NodeLayout {
+        HTMLNode* node;
+        int32_t parent;
+        int32_t firstChild;
+        int32_t nextSibling;
+        uint32_t firstAttribute;
+    };
+
+    std::vector<NodeLayout> nodes;            // document order
+    std::vector<std::string> names;           // interned tag and attribute names
+    std::unordered_map<std::string, uint32_t> nameOffsets;
+    uint64_t nameBytes = 0;
+    uint64_t stringBytes = 0;
+    uint32_t attributeCount = 0;
+
+    uint32_t internName(const char* name) {
+        auto found = nameOffsets.find(name);
+        if (found != nameOffsets.end()) return found->second;
+        uint32_t offset = static_cast<uint32_t>(nameBytes);
+        nameOffsets.emplace(name, offset);
+        names.push_back(name);
+        nameBytes += strlen(name) + 1;
+        return offset;
+    }
+
+    // Iterative, so deep tag soup can't run the stack out
+    void layOut(HTMLNode* root) {
+        std::vector<std::pair<HTMLNode*, int32_t>> pending; // node, parent index
+        if (root) pending.push_back(std::make_pair(root, -1));
+        std::vector<int32_t> lastChild;
+        while (!pending.empty()) {
+            HTMLNode* node = pending.back().first;
+            int32_t parent = pending.back().second;
+            pending.pop_back();
+
+            int32_t index = static_cast<int32_t>(nodes.size());
+            NodeLayout layout = {node, parent, -1, -1, attributeCount};
+            nodes.push_back(layout);
+            lastChild.push_back(-1);
+            if (parent >= 0) {
+                if (lastChild[parent] < 0) nodes[parent].firstChild = index;
+                else nodes[lastChild[parent]].nextSibling = index;
+                lastChild[parent] = index;
+            }
+
+            if (node->tagName) internName(node->tagName);
+            if (node->textContent) stringBytes += strlen(node->textContent) + 1;
+            if (node->attributes) {
+                node->attributes->forEach([this](const char* key, const char* value) {
+                    internName(key);
+                    if (value) stringBytes += strlen(value) + 1;
+                    attributeCount++;
+                });
+            }
+
+            // Children go on reversed so they come off in document order
+            size_t mark = pending.size();
+            for (HTMLNode* child = node->firstChild; child; child = child->nextSibling) {
+                pending.push_back(std::make_pair(child, index));
+            }
+            std::reverse(pending.begin() + mark, pending.end());
+        }
+        stringBytes += nameBytes;
+    }
+
+public:
+    // Writes root's tree and graph to path. False with error set on failure.
+    bool write(const char* path, HTMLNode* root, const Graph* graph, std::string& error) {
+        TRACE_SCOPE("snapshot", "write snapshot");
+        nodes.clear();
+        names.clear();
+        nameOffsets.clear();
+        nameBytes = stringBytes = 0;
+        attributeCount = 0;
+        layOut(root);
+        if (stringBytes >= SNAPSHOT_NO_STRING) {
+            error = "document text is too large for a snapshot (4 GB string table limit)";
+            return false;
+        }
+
+        std::vector<SnapshotEdge> edges;
+        if (graph) {
+            for (int v = 0; v < graph->getNumVertices(); v++) {
+                std::vector<int> targets = graph->getNeighbors(v);
+                for (size_t i = 0; i < targets.size(); i++) {
+                    SnapshotEdge edge = {v, targets[i]};
+                    edges.push_back(edge);
+                }
+            }
+        }
+
+        SnapshotHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, DOM_SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = DOM_SNAPSHOT_VERSION;
+        header.byteOrder = DOM_SNAPSHOT_BYTE_ORDER;
+        header.nodeCount = static_cast<uint32_t>(nodes.size());
+        header.attributeCount = attributeCount;
+        header.edgeCount = static_cast<uint32_t>(edges.size());
+        header.vertexCount = graph ? static_cast<uint32_t>(graph->getNumVertices()) : 0;
+        header.nodesOffset = sizeof(SnapshotHeader);
+        header.attributesOffset = header.nodesOffset + nodes.size() * sizeof(SnapshotNode);
+        header.edgesOffset = header.attributesOffset + attributeCount * sizeof(SnapshotAttribute);
+        header.stringsOffset = header.edgesOffset + edges.size() * sizeof(SnapshotEdge);
+        header.stringBytes = stringBytes;
+        header.fileBytes = header.stringsOffset + stringBytes;
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            error = std::string("cannot open ") + path + " for writing";
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // Text and values take their offsets in the order the string pass writes them
+        uint32_t cursor = static_cast<uint32_t>(nameBytes);
+        auto place = [&cursor](const char* str) {
+            if (!str) return SNAPSHOT_NO_STRING;
+            uint32_t offset = cursor;
+            cursor += static_cast<uint32_t>(strlen(str) + 1);
+            return offset;
+        };
+        std::vector<SnapshotAttribute> attributes;
+        attributes.reserve(attributeCount);
+        for (size_t i = 0; i < nodes.size(); i++) {
+            HTMLNode* node = nodes[i].node;
+            SnapshotNode out;
+            out.tag = node->tagName ? nameOffsets[node->tagName] : SNAPSHOT_NO_STRING;
+            out.text = place(node->textContent);
+            out.parent = nodes[i].parent;
+            out.firstChild = nodes[i].firstChild;
+            out.nextSibling = nodes[i].nextSibling;
+            out.firstAttribute = nodes[i].firstAttribute;
+            out.attributeCount = node->attributes ? static_cast<uint32_t>(node->attributes->getSize()) : 0;
+            out.depth = node->depth;
+            out.nodeId = node->nodeId;
+            if (node->attributes) {
+                node->attributes->forEach([&](const char* key, const char* value) {
+                    SnapshotAttribute attribute = {nameOffsets[key], place(value)};
+                    attributes.push_back(attribute);
+                });
+            }
+            file.write(reinterpret_cast<const char*>(&out), sizeof(out));
+        }
+        file.write(reinterpret_cast<const char*>(attributes.data()), attributes.size() * sizeof(SnapshotAttribute));
+        file.write(reinterpret_cast<const char*>(edges.data()), edges.size() * sizeof(SnapshotEdge));
+
+        for (size_t i = 0; i < names.size(); i++) {
+            file.write(names[i].c_str(), names[i].size() + 1);
+        }
+        auto writeString = [&file](const char* str) {
+            if (str) file.write(str, strlen(str) + 1);
+        };
+        for (size_t i = 0; i < nodes.size(); i++) {
+            HTMLNode* node = nodes[i].node;
+            writeString(node->textContent);
+            if (node->attributes) {
+                node->attributes->forEach([&](const char*, const char* value) { writeString(value); });
+            }
+        }
+
+        file.close();
+        if (!file) {
+            error = std::string("write to ") + path + " failed";
+            return false;
+        }
+        return true;
+    }
+};
+
+// Parses nothing: writes what parser already holds
+inline bool writeDomSnapshot(const char* path, HTMLParser& parser, std::string& error) {
+    DomSnapshotWriter writer;
+    return writer.write(path, parser.getRoot(), parser.getElementGraph(), error);
+}
+
+// ============================================================================
+// SNAPSHOT READER (memory mapped, read in place)
+// ============================================================================
+
+// Maps a snapshot and answers queries straight from the mapped bytes; open
+// only checks the header and that every section lies inside the file.
+// Doubles as the tree a RenderWalker reads, so a stored page renders with
+// the same rules as a freshly parsed one.
+class DomSnapshot {
+public:
+    typedef const SnapshotNode* Node;
+
+private:
+    const char* base = nullptr;
+    size_t length = 0;
+    const SnapshotHeader* header = nullptr;
+    const SnapshotNode* nodeArray = nullptr;
+    const SnapshotAttribute* attributeArray = nullptr;
+    const SnapshotEdge* edgeArray = nullptr;
+    const char* strings = nullptr;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+    bool mapFile(const char* path, std::string& error) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            error = std::string("cannot open ") + path;
+            return false;
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart == 0) {
+            error = std::string(path) + " is empty";
+            return false;
+        }
+        length = static_cast<size_t>(size.QuadPart);
+        mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) base = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            error = std::string("cannot open ") + path;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            error = std::string(path) + " is empty";
+            return false;
+        }
+        length = static_cast<size_t>(info.st_size);
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file
+        if (mapped != MAP_FAILED) base = static_cast<const char*>(mapped);
+#endif
+        if (!base) {
+            error = std::string("cannot map ") + path;
+            return false;
+        }
+        return true;
+    }
+
+    bool sectionFits(uint64_t offset, uint64_t bytes) const {
+        return offset % 4 == 0 && offset <= length && bytes <= length - offset;
+    }
+
+public:
+    DomSnapshot() = default;
+    DomSnapshot(const DomSnapshot&) = delete;
+    DomSnapshot& operator=(const DomSnapshot&) = delete;
+
+    ~DomSnapshot() {
+        close();
+    }
+
+    bool open(const char* path, std::string& error) {
+        TRACE_SCOPE("snapshot", "map snapshot");
+        close();
+        if (!mapFile(path, error)) {
+            close();
+            return false;
+        }
+        const SnapshotHeader* h = reinterpret_cast<const SnapshotHeader*>(base);
+        if (length < sizeof(SnapshotHeader) || memcmp(h->magic, DOM_SNAPSHOT_MAGIC, sizeof(h->magic)) != 0) {
+            error = std::string(path) + " is not a DOM snapshot";
+        } else if (h->version != DOM_SNAPSHOT_VERSION) {
+            error = std::string(path) + " has snapshot version " + std::to_string(h->version) + ", expected " +
+                    std::to_string(DOM_SNAPSHOT_VERSION);
+        } else if (h->byteOrder != DOM_SNAPSHOT_BYTE_ORDER) {
+            error = std::string(path) + " was written on a machine with the other byte order";
+        } else if (h->fileBytes != length || !sectionFits(h->nodesOffset, uint64_t(h->nodeCount) * sizeof(SnapshotNode)) ||
+                   !sectionFits(h->attributesOffset, uint64_t(h->attributeCount) * sizeof(SnapshotAttribute)) ||
+                   !sectionFits(h->edgesOffset, uint64_t(h->edgeCount) * sizeof(SnapshotEdge)) ||
+                   h->stringsOffset > length || h->stringBytes != length - h->stringsOffset ||
+                   (h->stringBytes > 0 && base[length - 1] != '\0')) {
+            error = std::string(path) + " is truncated or damaged";
+        } else {
+            header = h;
+            nodeArray = reinterpret_cast<const SnapshotNode*>(base + h->nodesOffset);
+            attributeArray = reinterpret_cast<const SnapshotAttribute*>(base + h->attributesOffset);
+            edgeArray = reinterpret_cast<const SnapshotEdge*>(base + h->edgesOffset);
+            strings = base + h->stringsOffset;
+            return true;
+        }
+        close();
+        return false;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (base) UnmapViewOfFile(base);
+        if (mapping) CloseHandle(mapping);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mapping = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (base) munmap(const_cast<char*>(base), length);
+#endif
+        base = nullptr;
+        length = 0;
+        header = nullptr;
+        nodeArray = nullptr;
+        attributeArray = nullptr;
+        edgeArray = nullptr;
+        strings = nullptr;
+    }
+
+    bool isOpen() const { return header != nullptr; }
+    size_t fileBytes() const { return length; }
+    uint32_t nodeCount() const { return header ? header->nodeCount : 0; }
+    uint32_t attributeCount() const { return header ? header->attributeCount : 0; }
+    uint32_t edgeCount() const { return header ? header->edgeCount : 0; }
+    uint32_t vertexCount() const { return header ? header->vertexCount : 0; }
+
+    // Index i, or nullptr past the end (and for -1)
+    Node node(int64_t i) const {
+        return i >= 0 && i < static_cast<int64_t>(nodeCount()) ? nodeArray + i : nullptr;
+    }
+    Node root() const { return node(0); }
+    int64_t indexOf(Node n) const { return n - nodeArray; }
+
+    const char* string(uint32_t offset) const {
+        return header && offset < header->stringBytes ? strings + offset : nullptr;
+    }
+
+    const SnapshotAttribute* attributesOf(Node n, uint32_t& count) const {
+        count = 0;
+        if (n->firstAttribute > attributeCount() || n->attributeCount > attributeCount() - n->firstAttribute) {
+            return nullptr;
+        }
+        count = n->attributeCount;
+        return attributeArray + n->firstAttribute;
+    }
+
+    const SnapshotEdge* edges() const { return edgeArray; }
+
+    // What RenderWalker reads
+    const char* tag(Node n) const { return string(n->tag); }
+    const char* text(Node n) const { return string(n->text); }
+    Node parent(Node n) const { return node(n->parent); }
+    // Children and siblings always come later in document order; a damaged
+    // file that points backwards just ends the walk instead of looping
+    Node firstChild(Node n) const { return n->firstChild > indexOf(n) ? node(n->firstChild) : nullptr; }
+    Node nextSibling(Node n) const { return n->nextSibling > indexOf(n) ? node(n->nextSibling) : nullptr; }
+    const char* attribute(Node n, const char* name) const {
+        uint32_t count;
+        const SnapshotAttribute* list = attributesOf(n, count);
+        for (uint32_t i = 0; i < count; i++) {
+            const char* key = string(list[i].name);
+            if (key && strcmp(key, name) == 0) return string(list[i].value);
+        }
+        return nullptr;
+    }
+
+    // Same title, blocks and links buildRenderDocument gave before the save
+    RenderDocument buildRenderDocument(int threads = 1) const {
+        TRACE_SCOPE("snapshot", "render snapshot");
+        RenderWalker<DomSnapshot> walker(*this);
+        return walker.buildRenderDocument(root(), threads);
+    }
+};
+
+#endif // DOM_SNAPSHOT_H
@@ -0,0 +1,132 @@
+#ifndef FILE_WATCH_H
+#define FILE_WATCH_H
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <thread>
+
+// ============================================================================
+// FILE WATCHING (wait until a file is saved again)
+// ============================================================================
+//
+// On linux the file's folder is watched with inotify, because editors often
+// save by writing a new file and renaming it over the old one, which a
+// watch on the file itself would lose. Elsewhere the file's time and size
+// are polled.
+
+class FileWatcher {
+private:
+    std::filesystem::path path;
+#ifdef __linux__
+    int fd;
+    int watch;
+
+    // True if the events in buf include a finished write or a rename onto our file
+    bool touchesFile(const char* buf, ssize_t len) const {
+        std::string name = path.filename().string();
+        for (ssize_t i = 0; i < len;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buf + i);
+            if (event->len > 0 && name == event->name) return true;
+            i += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+        return false;
+    }
+#else
+    std::filesystem::file_time_type lastTime;
+    uintmax_t lastSize = 0;
+
+    bool readStamp(std::filesystem::file_time_type& time, uintmax_t& size) const {
+        std::error_code ec;
+        time = std::filesystem::last_write_time(path, ec);
+        if (ec) return false;
+        size = std::filesystem::file_size(path, ec);
+        return !ec;
+    }
+#endif
+
+public:
+    explicit FileWatcher(const std::string& file) : path(file) {
+#ifdef __linux__
+        fd = -1;
+        watch = -1;
+#endif
+    }
+
+    ~FileWatcher() {
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Starts watching; saves made before this are not reported
+    bool start(std::string& error) {
+#ifdef __linux__
+        fd = inotify_init1(IN_CLOEXEC);
+        if (fd < 0) {
+            error = "Cannot start inotify";
+            return false;
+        }
+        std::filesystem::path folder = path.parent_path();
+        if (folder.empty()) folder = ".";
+        watch = inotify_add_watch(fd, folder.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch < 0) {
+            error = "Cannot watch folder " + folder.string();
+            return false;
+        }
+#else
+        if (!readStamp(lastTime, lastSize)) {
+            error = "Cannot open file " + path.string();
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    // Blocks until the file has been saved again. Saves that come in quick
+    // succession (an editor writing in several steps) are reported once.
+    bool waitForChange(std::string& error) {
+#ifdef __linux__
+        alignas(inotify_event) char buf[4096];
+        bool changed = false;
+        while (!changed) {
+            ssize_t len = read(fd, buf, sizeof(buf));
+            if (len <= 0) {
+                error = "Lost the inotify watch on " + path.string();
+                return false;
+            }
+            changed = touchesFile(buf, len);
+        }
+        pollfd more = {fd, POLLIN, 0};
+        while (poll(&more, 1, 50) > 0) {
+            if (read(fd, buf, sizeof(buf)) <= 0) break;
+        }
+        return true;
+#else
+        (void)error;
+        for (;;) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            std::filesystem::file_time_type time;
+            uintmax_t size;
+            if (!readStamp(time, size)) continue; // in the middle of being replaced
+            if (time == lastTime && size == lastSize) continue;
+            lastTime = time;
+            lastSize = size;
+            return true;
+        }
+#endif
+    }
+};
+
+#endif // FILE_WATCH_H
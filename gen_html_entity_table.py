@@ -0,0 +1,94 @@
+# Writes html_entity_table.h: the HTML named character references (the WHATWG
+# entities.json list, which python ships as html.entities.html5) laid out as a
+# minimal perfect hash that html_entities.h looks names up in.
+#
+#   python3 gen_html_entity_table.py > html_entity_table.h
+
+from html.entities import html5
+
+
+def fnv1a(seed, name):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode("ascii"):
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def c_string(data):
+    out = []
+    for b in data:
+        if 0x20 <= b < 0x7F and chr(b) not in '"\\?':
+            out.append(chr(b))
+        else:
+            out.append("\\%03o" % b)
+    return '"' + "".join(out) + '"'
+
+
+def build(names):
+    # Hash and displace: the biggest buckets pick a seed first. A bucket of
+    # one takes any free slot directly, stored as -(slot + 1).
+    n = len(names)
+    buckets = [[] for _ in range(n)]
+    for name in names:
+        buckets[fnv1a(0, name) % n].append(name)
+    order = sorted(range(n), key=lambda b: -len(buckets[b]))
+    displacement = [0] * n
+    slots = [None] * n
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            placed = [fnv1a(seed, name) % n for name in bucket]
+            if len(set(placed)) == len(placed) and all(slots[s] is None for s in placed):
+                break
+            seed += 1
+        displacement[b] = seed
+        for name, s in zip(bucket, placed):
+            slots[s] = name
+    free = [s for s in range(n) if slots[s] is None]
+    for b in order:
+        if len(buckets[b]) == 1:
+            s = free.pop()
+            displacement[b] = -(s + 1)
+            slots[s] = buckets[b][0]
+    return displacement, slots
+
+
+def main():
+    names = sorted(html5)
+    displacement, slots = build(names)
+    print("// Generated by gen_html_entity_table.py, do not edit")
+    print("#ifndef HTML_ENTITY_TABLE_H")
+    print("#define HTML_ENTITY_TABLE_H")
+    print()
+    print("#include <cstdint>")
+    print()
+    print("// Name as written after '&' (with its ';' when the reference needs one), then its UTF-8")
+    print("struct HtmlEntity {")
+    print("    const char* name;")
+    print("    const char* utf8;")
+    print("};")
+    print()
+    print("static const int HTML_ENTITY_COUNT = %d;" % len(names))
+    print("static const int HTML_ENTITY_MAX_NAME = %d;" % max(len(n) for n in names))
+    print("static const int HTML_ENTITY_MAX_LEGACY_NAME = %d; // longest name usable without ';'"
+          % max(len(n) for n in names if not n.endswith(";")))
+    print()
+    print("static const int32_t htmlEntityDisplacement[HTML_ENTITY_COUNT] = {")
+    for i in range(0, len(displacement), 12):
+        print("    " + ", ".join(str(d) for d in displacement[i:i + 12]) + ",")
+    print("};")
+    print()
+    print("static const HtmlEntity htmlEntityTable[HTML_ENTITY_COUNT] = {")
+    for name in slots:
+        print("    {%s, %s}," % (c_string(name.encode("ascii")), c_string(html5[name].encode("utf-8"))))
+    print("};")
+    print()
+    print("#endif // HTML_ENTITY_TABLE_H")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,395 @@
+#include <chrono>
+#include <iostream>
+#include <map>
+#include "page_pipeline.h"
+#include "tab_history.h"
+#include "tab_render_store.h"
+#include "link_prefetcher.h"
+#include "crawler.h"
+
+// ============================================================================
+// HEADLESS DRIVER
+// Runs the same fetch -> decode -> parse -> layout pipeline as browser_gui,
+// with the window message loop replaced by a queue drained on main().
+// ============================================================================
+
+struct UiQueue {
+    std::mutex lock;
+    std::condition_variable ready;
+    Queue<PageResult*> results;
+
+    void post(PageResult* result) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            results.enqueue(result);
+        }
+        ready.notify_one();
+    }
+
+    PageResult* waitNext() {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait(guard, [this] { return !results.isEmpty(); });
+        return results.dequeue();
+    }
+};
+
+static const char* statusName(PageStatus status) {
+    switch (status) {
+    case PAGE_OK: return "OK";
+    case PAGE_CANCELLED: return "CANCELLED";
+    case PAGE_PARTIAL: return "PARTIAL";
+    default: return "FAILED";
+    }
+}
+
+static double msSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Visits every url in one tab, then walks back to the first and forward to
+// the last again, the way the GUI's < and > buttons do
+static int runHistoryWalk(PagePipeline& pipeline, UiQueue& ui, DocumentCache& documents,
+                          LinkPrefetcher* prefetcher, int thinkMs, const std::vector<std::string>& urls) {
+    TabHistory history;
+    int failures = 0;
+    std::map<std::string, std::string> redirects; // url -> where it redirected; its links are relative to that
+
+    // Cached documents are shown directly; anything else goes through the pipeline
+    std::function<void(const char*, const std::string&)> show = [&](const char* step, const std::string& url) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::shared_ptr<const RenderDocument> doc = documents.get(url);
+        const char* source = "document cache";
+        if (!doc) {
+            source = "pipeline";
+            int navigationId = pipeline.navigate(1, url);
+            while (true) {
+                PageResult* result = ui.waitNext();
+                bool final = result->navigationId == navigationId && result->status != PAGE_PARTIAL;
+                if (final && result->status == PAGE_OK) {
+                    doc = std::make_shared<RenderDocument>(std::move(result->doc));
+                    documents.put(url, doc);
+                    if (result->finalUrl != url) redirects[url] = result->finalUrl;
+                } else if (final) {
+                    failures++;
+                    std::cout << "[" << step << "] " << statusName(result->status) << " " << url << " ("
+                              << result->error << ")" << std::endl;
+                }
+                delete result;
+                if (final) break;
+            }
+        }
+        std::vector<RenderLine> lines;
+        if (doc) lines = layoutRenderDocument(*doc);
+        if (doc) {
+            std::cout << "[" << step << "] " << url << " from " << source << " in " << msSince(start)
+                      << " ms, " << lines.size() << " lines";
+            if (prefetcher) {
+                std::map<std::string, std::string>::const_iterator redirect = redirects.find(url);
+                const std::string& pageUrl = redirect != redirects.end() ? redirect->second : url;
+                std::cout << ", prefetching " << prefetcher->prefetch(pageUrl, doc->links) << " links";
+            }
+            std::cout << std::endl;
+        }
+        // The user reading the page is what gives prefetch its head start
+        if (thinkMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(thinkMs));
+    };
+
+    for (size_t i = 0; i < urls.size(); i++) {
+        history.visit(urls[i]);
+        show("visit", urls[i]);
+    }
+    while (history.canGoBack()) {
+        std::string url = history.goBack();
+        show("back", url);
+    }
+    while (history.canGoForward()) {
+        std::string url = history.goForward();
+        show("forward", url);
+    }
+
+    std::cout << "document cache hits: " << documents.getHits() << ", misses: " << documents.getMisses()
+              << " (hit rate " << static_cast<int>(documents.getHitRate() * 100 + 0.5) << "%), evicted: "
+              << documents.getEvictions() << ", " << documents.getEntryCount() << " pages, "
+              << documents.getBytes() << " bytes" << std::endl;
+    if (prefetcher) {
+        std::cout << "prefetched: " << prefetcher->getCompleted() << " of " << prefetcher->getStarted()
+                  << " started, over budget: " << prefetcher->getOverBudget() << ", failed: "
+                  << prefetcher->getFailed() << ", " << prefetcher->getBytesFetched() << " bytes" << std::endl;
+    }
+    return failures;
+}
+
+// Crawls breadth-first from the urls and prints every page as it finishes,
+// then the link graph size; --graph writes its edges as "from<TAB>to" lines
+static int runCrawl(const PageFetcher& fetcher, const CrawlOptions& options, const std::string& graphFile,
+                    const std::vector<std::string>& seeds) {
+    Crawler crawler(fetcher, options);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int fetched = 0;
+    long long bytes = 0;
+    int succeeded = crawler.run(seeds, [&](const CrawlPage& page) {
+        fetched++;
+        bytes += static_cast<long long>(page.bytes);
+        std::cout << "[depth " << page.depth << "] " << (page.ok ? "OK " : "FAILED ") << page.url << " in "
+                  << page.ms << " ms";
+        if (page.ok) std::cout << ", " << page.links << " links";
+        if (!page.title.empty()) std::cout << ", \"" << page.title << "\"";
+        if (!page.error.empty()) std::cout << " (" << page.error << ")";
+        std::cout << std::endl;
+    });
+    double ms = msSince(start);
+
+    const Graph& graph = crawler.getLinkGraph();
+    std::cout << "crawled " << succeeded << " of " << fetched << " pages (" << bytes << " bytes) in "
+              << static_cast<long>(ms) << " ms; link graph: " << graph.getNumVertices() << " urls, "
+              << graph.getNumEdges() << " links" << std::endl;
+    const UrlSeenIndex<int>& seen = crawler.getUrlIndex();
+    std::cout << "url index: " << seen.size() << " urls, prefilter " << seen.getPrefilterBytes() << " bytes ("
+              << seen.getPrefilterBitsPerUrl() << " bits/url), exact map ~" << seen.getExactBytes() << " bytes; "
+              << seen.getPrefilterSkips() << " of " << seen.getLookups() << " lookups answered by the prefilter, "
+              << seen.getFalsePositives() << " false positives" << std::endl;
+
+    if (!graphFile.empty()) {
+        std::ofstream out(graphFile);
+        if (!out.is_open()) {
+            std::cerr << "Error: Cannot open file " << graphFile << " for writing" << std::endl;
+            return 1;
+        }
+        for (int v = 0; v < graph.getNumVertices(); v++) {
+            std::vector<int> targets = graph.getNeighbors(v);
+            for (size_t i = 0; i < targets.size(); i++) {
+                out << crawler.getUrl(v) << "\t" << crawler.getUrl(targets[i]) << "\n";
+            }
+        }
+    }
+    return succeeded == fetched ? 0 : 1;
+}
+
+// Writes the trace when main returns, after the pipeline's workers have stopped
+struct TraceFileWriter {
+    std::string path;
+
+    ~TraceFileWriter() {
+        std::string error;
+        if (!path.empty() && !writeTraceFile(path, error)) {
+            std::cerr << "Error: " << error << std::endl;
+        }
+    }
+};
+
+static void printUsage() {
+    std::cout << "Usage: headless_browser [options] url [url ...]" << std::endl;
+    std::cout << "  --workers N          pipeline worker threads (default 2)" << std::endl;
+    std::cout << "  --python CMD         interpreter for the https:// fetch script" << std::endl;
+    std::cout << "  --fetch-script PATH  path to html_fetching_URL.py (used for https://)" << std::endl;
+    std::cout << "  --renavigate URL     send tab 1 to URL after --delay ms, aborting its first load" << std::endl;
+    std::cout << "  --close-after MS     cancel every tab after MS ms, as if they were closed" << std::endl;
+    std::cout << "  --delay MS           delay before --renavigate (default 0)" << std::endl;
+    std::cout << "  --print              print the laid out render lines" << std::endl;
+    std::cout << "  --cache DIR          keep an on-disk HTTP cache in DIR" << std::endl;
+    std::cout << "  --cache-size MB      cache size limit (default 64)" << std::endl;
+    std::cout << "  --history            visit the urls in one tab, then go back and forward through them" << std::endl;
+    std::cout << "  --prefetch N         with --history, prefetch up to N same-origin links of each page" << std::endl;
+    std::cout << "  --prefetch-budget KB bytes all prefetches of one page may download (default 2048)" << std::endl;
+    std::cout << "  --think MS           with --history, pause MS ms on every page before moving on" << std::endl;
+    std::cout << "  --doc-cache MB       parsed page budget for --history (default 32)" << std::endl;
+    std::cout << "  --compress-tabs      after loading, compress every tab as a background tab and time switching back" << std::endl;
+    std::cout << "  --progressive        render while downloading; report time to first line" << std::endl;
+    std::cout << "  --crawl              crawl breadth-first from the urls (their hosts only)" << std::endl;
+    std::cout << "  --max-depth N        with --crawl, link depth to follow (default 2)" << std::endl;
+    std::cout << "  --max-pages N        with --crawl, pages to fetch at most (default 100)" << std::endl;
+    std::cout << "  --crawl-delay MS     with --crawl, pause between requests to one host (default 250)" << std::endl;
+    std::cout << "  --graph FILE         with --crawl, write the link graph as from<TAB>to lines" << std::endl;
+    std::cout << "  --trace FILE         record fetch/parse/layout spans as Chrome trace JSON in FILE" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int workers = 2;
+#ifdef _WIN32
+    std::string python = "python";
+#else
+    std::string python = "python3";
+#endif
+    std::string fetchScript = "internet access & html in txt file/html_fetching_URL.py";
+    std::string renavigateUrl;
+    int delayMs = 0;
+    int closeAfterMs = -1;
+    bool printLines = false;
+    bool progressive = false;
+    std::string cacheDir;
+    bool historyWalk = false;
+    bool compressTabs = false;
+    double docCacheMb = 32;
+    int prefetchLinks = 0;
+    long long prefetchBudgetKb = 2048;
+    int thinkMs = 0;
+    long long cacheMb = 64;
+    bool crawl = false;
+    CrawlOptions crawlOptions;
+    std::string graphFile;
+    TraceFileWriter trace;
+    std::vector<std::string> urls;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--workers" && hasValue) workers = atoi(argv[++i]);
+        else if (arg == "--python" && hasValue) python = argv[++i];
+        else if (arg == "--fetch-script" && hasValue) fetchScript = argv[++i];
+        else if (arg == "--renavigate" && hasValue) renavigateUrl = argv[++i];
+        else if (arg == "--delay" && hasValue) delayMs = atoi(argv[++i]);
+        else if (arg == "--close-after" && hasValue) closeAfterMs = atoi(argv[++i]);
+        else if (arg == "--print") printLines = true;
+        else if (arg == "--progressive") progressive = true;
+        else if (arg == "--history") historyWalk = true;
+        else if (arg == "--compress-tabs") compressTabs = true;
+        else if (arg == "--doc-cache" && hasValue) docCacheMb = atof(argv[++i]);
+        else if (arg == "--prefetch" && hasValue) prefetchLinks = atoi(argv[++i]);
+        else if (arg == "--prefetch-budget" && hasValue) prefetchBudgetKb = atoll(argv[++i]);
+        else if (arg == "--think" && hasValue) thinkMs = atoi(argv[++i]);
+        else if (arg == "--cache" && hasValue) cacheDir = argv[++i];
+        else if (arg == "--cache-size" && hasValue) cacheMb = atoll(argv[++i]);
+        else if (arg == "--crawl") crawl = true;
+        else if (arg == "--max-depth" && hasValue) crawlOptions.maxDepth = atoi(argv[++i]);
+        else if (arg == "--max-pages" && hasValue) crawlOptions.maxPages = atoi(argv[++i]);
+        else if (arg == "--crawl-delay" && hasValue) crawlOptions.hostDelayMs = atoi(argv[++i]);
+        else if (arg == "--graph" && hasValue) graphFile = argv[++i];
+        else if (arg == "--trace" && hasValue) trace.path = argv[++i];
+        else if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+        else if (!arg.empty() && arg[0] == '-') { printUsage(); return 1; }
+        else urls.push_back(arg);
+    }
+    if (urls.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    if (!trace.path.empty()) {
+        enableTracing();
+        setTraceThreadName("main");
+    }
+
+    UiQueue ui;
+    std::shared_ptr<HttpClient> http = std::make_shared<HttpClient>();
+    std::shared_ptr<HttpCache> cache;
+    if (!cacheDir.empty()) cache = std::make_shared<HttpCache>(cacheDir, cacheMb * 1024 * 1024);
+    PageFetcher fetcher = makeHttpFetcher(http, makeScriptFetcher(python, fetchScript), cache);
+    PagePipeline pipeline(workers, fetcher, [&ui](PageResult* result) { ui.post(result); });
+    pipeline.setPublishPartial(progressive);
+
+    if (crawl) {
+        crawlOptions.workers = workers;
+        int status = runCrawl(fetcher, crawlOptions, graphFile, urls);
+        std::cout << "connections opened: " << http->getConnectionsOpened()
+                  << ", reused: " << http->getConnectionsReused() << std::endl;
+        return status;
+    }
+
+    if (historyWalk) {
+        DocumentCache documents(static_cast<size_t>(docCacheMb * 1024 * 1024));
+        std::unique_ptr<LinkPrefetcher> prefetcher;
+        if (prefetchLinks > 0) {
+            PrefetchOptions options;
+            options.maxLinks = prefetchLinks;
+            options.byteBudget = prefetchBudgetKb * 1024;
+            prefetcher.reset(new LinkPrefetcher(fetcher, documents, options));
+        }
+        return runHistoryWalk(pipeline, ui, documents, prefetcher.get(), thinkMs, urls) == 0 ? 0 : 1;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::map<int, int> latestNavigation;
+    int expected = 0;
+    for (size_t i = 0; i < urls.size(); i++) {
+        int tabId = static_cast<int>(i) + 1;
+        latestNavigation[tabId] = pipeline.navigate(tabId, urls[i]);
+        expected++;
+    }
+
+    if (!renavigateUrl.empty()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        latestNavigation[1] = pipeline.navigate(1, renavigateUrl);
+        expected++;
+    }
+    if (closeAfterMs >= 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(closeAfterMs));
+        for (size_t i = 0; i < urls.size(); i++) {
+            pipeline.cancelTab(static_cast<int>(i) + 1);
+        }
+    }
+
+    int failures = 0;
+    std::map<int, double> firstLineMs;
+    TabRenderStore tabStore(0, 0);
+    for (int done = 0; done < expected;) {
+        PageResult* result = ui.waitNext();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        bool current = latestNavigation[result->tabId] == result->navigationId;
+
+        if (result->status == PAGE_PARTIAL) {
+            if (firstLineMs.find(result->navigationId) == firstLineMs.end()) {
+                firstLineMs[result->navigationId] = ms;
+            }
+            delete result;
+            continue;
+        }
+        done++;
+
+        std::cout << "[tab " << result->tabId << "] " << statusName(result->status) << " " << result->url
+                  << " after " << static_cast<long>(ms) << " ms";
+        if (result->status == PAGE_OK) std::cout << ", " << result->lines.size() << " lines";
+        if (firstLineMs.find(result->navigationId) != firstLineMs.end()) {
+            std::cout << ", first line after " << static_cast<long>(firstLineMs[result->navigationId]) << " ms";
+        }
+        if (!result->error.empty()) std::cout << " (" << result->error << ")";
+        if (!current) std::cout << " [superseded]";
+        std::cout << std::endl;
+
+        if (current && result->status == PAGE_FAILED) failures++;
+        if (printLines && result->status == PAGE_OK && current) {
+            if (!result->doc.title.empty()) std::cout << "  TITLE: " << result->doc.title << std::endl;
+            for (size_t i = 0; i < result->lines.size(); i++) {
+                std::cout << "  [" << result->lines[i].size << (result->lines[i].bold ? "b" : "")
+                          << "] " << result->lines[i].text << std::endl;
+            }
+        }
+        if (compressTabs && result->status == PAGE_OK && current) {
+            tabStore.set(result->tabId, std::make_shared<RenderDocument>(std::move(result->doc)));
+        }
+        delete result;
+    }
+
+    if (compressTabs) {
+        size_t residentBefore = tabStore.getResidentBytes();
+        std::chrono::steady_clock::time_point packStart = std::chrono::steady_clock::now();
+        int packed = tabStore.compressBackground(-1);
+        double packMs = msSince(packStart);
+        std::cout << "tabs: " << tabStore.getTabCount() << ", resident " << residentBefore << " bytes -> "
+                  << tabStore.getResidentBytes() << " resident + " << tabStore.getCompressedBytes()
+                  << " compressed (" << packed << " tabs packed in " << packMs << " ms)" << std::endl;
+
+        double slowest = 0;
+        double total = 0;
+        for (size_t i = 0; i < urls.size(); i++) {
+            std::chrono::steady_clock::time_point switchStart = std::chrono::steady_clock::now();
+            std::shared_ptr<const RenderDocument> doc = tabStore.get(static_cast<int>(i) + 1);
+            double ms = msSince(switchStart);
+            if (doc) {
+                total += ms;
+                if (ms > slowest) slowest = ms;
+            }
+        }
+        std::cout << "tab switch with decompression: " << (urls.empty() ? 0 : total / urls.size())
+                  << " ms average, " << slowest << " ms slowest" << std::endl;
+    }
+
+    std::cout << "connections opened: " << http->getConnectionsOpened()
+              << ", reused: " << http->getConnectionsReused() << std::endl;
+    if (cache) {
+        std::cout << "cache hits: " << cache->getHits() << ", revalidated: " << cache->getRevalidated()
+                  << ", misses: " << cache->getMisses() << ", stored: " << cache->getStores()
+                  << ", evicted: " << cache->getEvictions() << ", " << cache->getEntryCount() << " entries, "
+                  << cache->getSizeBytes() << " bytes" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "html_corpus_gen.h"
+
+// ============================================================================
+// MAIN FUNCTION
+// ============================================================================
+
+// "64K", "10M", "2G" or plain bytes
+static bool parseSize(const char* text, uint64_t& size) {
+    char* end = nullptr;
+    double value = strtod(text, &end);
+    if (end == text || value <= 0) return false;
+    uint64_t unit = 1;
+    if (*end == 'k' || *end == 'K') unit = 1024ull;
+    else if (*end == 'm' || *end == 'M') unit = 1024ull * 1024;
+    else if (*end == 'g' || *end == 'G') unit = 1024ull * 1024 * 1024;
+    else if (*end != '\0') return false;
+    size = static_cast<uint64_t>(value * static_cast<double>(unit));
+    return true;
+}
+
+static void printUsage() {
+    std::cout << "Usage: html_corpus_gen [options]" << std::endl;
+    std::cout << "  --shape NAME   mixed, deep, wide, attrs, text, unclosed, script, unicode or all (default mixed)"
+              << std::endl;
+    std::cout << "  --size N       bytes per document, with optional K/M/G suffix (default 64K)" << std::endl;
+    std::cout << "  --seed N       generator seed (default 1); same seed, same bytes" << std::endl;
+    std::cout << "  --out FILE     write one document to FILE (- for stdout)" << std::endl;
+    std::cout << "  --dir DIR      write --count documents into DIR plus a manifest.txt for html_parser --batch"
+              << std::endl;
+    std::cout << "  --count N      documents for --dir (default 10); document i uses seed + i" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::string shapeName = "mixed";
+    uint64_t size = 64 * 1024;
+    uint64_t seed = 1;
+    std::string outFile;
+    std::string outDir;
+    int count = 10;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--shape" && hasValue) shapeName = argv[++i];
+        else if (arg == "--size" && hasValue) {
+            if (!parseSize(argv[++i], size)) {
+                std::cerr << "Bad size " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--seed" && hasValue) seed = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--out" && hasValue) outFile = argv[++i];
+        else if (arg == "--dir" && hasValue) outDir = argv[++i];
+        else if (arg == "--count" && hasValue) count = atoi(argv[++i]);
+        else if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+        else { printUsage(); return 1; }
+    }
+
+    std::vector<CorpusShape> shapes;
+    for (int s = 0; s < kShapeCount; s++) {
+        if (shapeName == "all" || shapeName == kShapeNames[s]) shapes.push_back(static_cast<CorpusShape>(s));
+    }
+    if (shapes.empty() || (outFile.empty() == outDir.empty())) {
+        printUsage();
+        return 1;
+    }
+
+    if (!outFile.empty()) {
+        FILE* file = outFile == "-" ? stdout : fopen(outFile.c_str(), "wb");
+        if (!file) {
+            std::cerr << "Error: Cannot open file " << outFile << " for writing" << std::endl;
+            return 1;
+        }
+        writeDocument(shapes[0], seed, size, file);
+        if (file != stdout) fclose(file);
+        return 0;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(outDir, ec);
+    std::string manifestPath = (std::filesystem::path(outDir) / "manifest.txt").string();
+    FILE* manifest = fopen(manifestPath.c_str(), "wb");
+    if (!manifest) {
+        std::cerr << "Error: Cannot open file " << manifestPath << " for writing" << std::endl;
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        CorpusShape shape = shapes[i % shapes.size()];
+        std::string name = std::string(kShapeNames[shape]) + "_" + std::to_string(seed + i) + ".html";
+        std::string path = (std::filesystem::path(outDir) / name).string();
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file) {
+            std::cerr << "Error: Cannot open file " << path << " for writing" << std::endl;
+            fclose(manifest);
+            return 1;
+        }
+        writeDocument(shape, seed + i, size, file);
+        fclose(file);
+        fprintf(manifest, "%s\n", path.c_str());
+    }
+    fclose(manifest);
+    std::cout << "Wrote " << count << " documents of about " << size << " bytes to " << outDir << std::endl;
+    return 0;
+}
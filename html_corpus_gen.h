@@ -0,0 +1,341 @@
+#ifndef HTML_CORPUS_GEN_H
+#define HTML_CORPUS_GEN_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// ============================================================================
+// SYNTHETIC HTML CORPUS GENERATOR
+// Same seed, shape and size -> same bytes on every platform. Documents are
+// written as they are generated, so size is bounded by the disk, not memory.
+// html_corpus_gen.cpp is the command line around it; parser_tests.cpp uses
+// the shapes directly.
+// ============================================================================
+
+// splitmix64: tiny, and unlike <random> distributions identical everywhere
+class CorpusRng {
+private:
+    uint64_t state;
+
+public:
+    explicit CorpusRng(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [low, high]
+    int range(int low, int high) {
+        return low + static_cast<int>(next() % static_cast<uint64_t>(high - low + 1));
+    }
+
+    bool chance(int percent) {
+        return range(1, 100) <= percent;
+    }
+};
+
+class CorpusWriter {
+private:
+    FILE* file;
+    std::string buffer;
+    uint64_t written;
+
+public:
+    explicit CorpusWriter(FILE* out) : file(out), written(0) {
+        buffer.reserve(1 << 16);
+    }
+
+    ~CorpusWriter() {
+        flush();
+    }
+
+    void put(const std::string& s) {
+        buffer += s;
+        written += s.size();
+        if (buffer.size() >= (1 << 16)) flush();
+    }
+
+    void put(const char* s) {
+        put(std::string(s));
+    }
+
+    void flush() {
+        if (!buffer.empty()) fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+
+    uint64_t getWritten() const {
+        return written;
+    }
+};
+
+// ============================================================================
+// BUILDING BLOCKS
+// ============================================================================
+
+static const char* const kWords[] = {
+    "the", "parser", "reads", "every", "token", "and", "builds", "a", "tree", "of", "nodes", "browser",
+    "window", "renders", "text", "with", "links", "to", "other", "pages", "over", "network", "cache",
+    "history", "stack", "queue", "graph", "layout", "style", "script"};
+static const int kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+
+// UTF-8 samples: accented latin, greek, cyrillic, CJK, arabic (RTL), emoji
+static const char* const kUnicodeWords[] = {
+    "caf\xC3\xA9", "na\xC3\xAFve", "\xCE\xB1\xCE\xBB\xCF\x86\xCE\xB1", "\xD0\xBC\xD0\xB8\xD1\x80",
+    "\xE6\x96\x87\xE5\xAD\x97", "\xE6\xB5\x8F\xE8\xA7\x88\xE5\x99\xA8", "\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7",
+    "\xF0\x9F\x98\x80", "\xF0\x9F\x8C\x8D", "Stra\xC3\x9F" "e", "&amp;", "&lt;tag&gt;", "&copy;", "&#8364;"};
+static const int kUnicodeWordCount = sizeof(kUnicodeWords) / sizeof(kUnicodeWords[0]);
+
+static const char* const kBlockTags[] = {"div", "section", "article", "p", "ul", "li", "span", "table", "td"};
+static const char* const kInlineTags[] = {"b", "i", "em", "strong", "a", "span", "small", "code", "u"};
+
+inline std::string sentence(CorpusRng& rng, int words) {
+    std::string s;
+    for (int i = 0; i < words; i++) {
+        if (i) s += ' ';
+        s += kWords[rng.range(0, kWordCount - 1)];
+    }
+    return s;
+}
+
+inline std::string unicodeSentence(CorpusRng& rng, int words) {
+    std::string s;
+    for (int i = 0; i < words; i++) {
+        if (i) s += ' ';
+        s += rng.chance(60) ? kUnicodeWords[rng.range(0, kUnicodeWordCount - 1)] : kWords[rng.range(0, kWordCount - 1)];
+    }
+    return s;
+}
+
+// One ordinary paragraph with some inline markup and a link
+inline std::string paragraph(CorpusRng& rng) {
+    std::string s = "<p>" + sentence(rng, rng.range(5, 30));
+    int inlineCount = rng.range(0, 3);
+    for (int i = 0; i < inlineCount; i++) {
+        const char* tag = kInlineTags[rng.range(0, 8)];
+        if (strcmp(tag, "a") == 0) {
+            s += " <a href=\"/page" + std::to_string(rng.range(1, 5000)) + ".html\">" + sentence(rng, 3) + "</a>";
+        } else {
+            s += std::string(" <") + tag + ">" + sentence(rng, rng.range(1, 4)) + "</" + tag + ">";
+        }
+        s += " " + sentence(rng, rng.range(2, 12));
+    }
+    return s + "</p>\n";
+}
+
+inline std::string attributeValue(CorpusRng& rng) {
+    switch (rng.range(0, 3)) {
+    case 0: return "\"" + sentence(rng, rng.range(1, 4)) + "\"";
+    case 1: return "'" + sentence(rng, rng.range(1, 3)) + "'";
+    case 2: return std::string(kWords[rng.range(0, kWordCount - 1)]) + std::to_string(rng.range(0, 999));
+    default: return "\"" + std::to_string(rng.range(0, 1 << 30)) + "\"";
+    }
+}
+
+// ============================================================================
+// SHAPES
+// ============================================================================
+// Each shape writes body content until about target bytes are out; the
+// caller adds the document skeleton around it.
+
+enum CorpusShape {
+    SHAPE_MIXED,
+    SHAPE_DEEP,
+    SHAPE_WIDE,
+    SHAPE_ATTRS,
+    SHAPE_TEXT,
+    SHAPE_UNCLOSED,
+    SHAPE_SCRIPT,
+    SHAPE_UNICODE
+};
+
+static const char* const kShapeNames[] = {"mixed", "deep", "wide", "attrs", "text", "unclosed", "script", "unicode"};
+static const int kShapeCount = sizeof(kShapeNames) / sizeof(kShapeNames[0]);
+
+// Nesting to (almost) the whole budget: a chain of opens, some text, then
+// the matching closes. Tag names follow the level, so no stack is kept.
+inline void writeDeep(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    const uint64_t perLevel = 16; // open + close tag of div/section/article, on average
+    uint64_t levels = target / perLevel;
+    if (levels < 1) levels = 1;
+    uint64_t salt = rng.next();
+    for (uint64_t level = 0; level < levels; level++) {
+        out.put(std::string("<") + kBlockTags[(level ^ salt) % 3] + ">");
+        if (level % 64 == 63) out.put("\n");
+    }
+    out.put(sentence(rng, 12));
+    for (uint64_t level = levels; level-- > 0;) {
+        out.put(std::string("</") + kBlockTags[(level ^ salt) % 3] + ">");
+        if (level % 64 == 0) out.put("\n");
+    }
+}
+
+// One parent with as many children as fit
+inline void writeWide(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    out.put("<ul>\n");
+    while (out.getWritten() < target) {
+        if (rng.chance(20)) {
+            out.put("<li><a href=\"/item" + std::to_string(rng.range(0, 1 << 20)) + "\">" + sentence(rng, 2) +
+                    "</a></li>\n");
+        } else {
+            out.put("<li>" + sentence(rng, rng.range(1, 5)) + "</li>\n");
+        }
+    }
+    out.put("</ul>\n");
+}
+
+// Tags with dozens to hundreds of attributes, mixed quoting and booleans
+inline void writeAttrs(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        const char* tag = rng.chance(50) ? "div" : (rng.chance(50) ? "input" : "a");
+        std::string s = std::string("<") + tag;
+        int count = rng.chance(10) ? rng.range(100, 400) : rng.range(10, 60);
+        for (int i = 0; i < count; i++) {
+            if (rng.chance(10)) {
+                s += " disabled";
+            } else {
+                s += " data-" + std::string(kWords[rng.range(0, kWordCount - 1)]) + std::to_string(i) + "=" +
+                     attributeValue(rng);
+            }
+        }
+        s += strcmp(tag, "input") == 0 ? ">\n" : std::string(">") + sentence(rng, 3) + "</" + tag + ">\n";
+        out.put(s);
+    }
+}
+
+// A few elements holding very long runs of text and whitespace
+inline void writeText(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        uint64_t runEnd = out.getWritten() + static_cast<uint64_t>(rng.range(1 << 16, 1 << 22));
+        if (runEnd > target) runEnd = target;
+        out.put("<p>");
+        while (out.getWritten() < runEnd) {
+            std::string chunk = sentence(rng, 200);
+            if (rng.chance(10)) chunk += std::string(static_cast<size_t>(rng.range(10, 2000)), ' ');
+            if (rng.chance(5)) chunk += "\n\t\n";
+            out.put(chunk + " ");
+        }
+        out.put("</p>\n");
+    }
+}
+
+// Tag soup: never-closed elements, stray end tags, misnesting, bare '<'
+inline void writeUnclosed(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        switch (rng.range(0, 6)) {
+        case 0: out.put("<p>" + sentence(rng, rng.range(3, 15)) + "\n"); break;
+        case 1: out.put(std::string("</") + kBlockTags[rng.range(0, 8)] + ">"); break;
+        case 2: out.put("<b><i>" + sentence(rng, 3) + "</b></i>"); break;
+        case 3: out.put("<div><span>" + sentence(rng, 4) + "</div>"); break;
+        case 4: out.put(sentence(rng, 3) + " a < b and c > d " + sentence(rng, 2) + "\n"); break;
+        case 5: out.put("<li>" + sentence(rng, 4) + "<li>" + sentence(rng, 4) + "\n"); break;
+        default: out.put(paragraph(rng)); break;
+        }
+    }
+}
+
+// Large script and style blocks whose content looks like markup
+inline void writeScript(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        if (rng.chance(60)) {
+            out.put("<script>\n");
+            int lines = rng.range(50, 5000);
+            for (int i = 0; i < lines && out.getWritten() < target; i++) {
+                switch (rng.range(0, 3)) {
+                case 0:
+                    out.put("var s" + std::to_string(i) + " = \"<div class='x'>" + sentence(rng, 3) + "</div>\";\n");
+                    break;
+                case 1: out.put("if (a < b && b > c) { document.write('<p>' + x + '</p>'); }\n"); break;
+                case 2: out.put("// " + sentence(rng, 8) + " </span> <!-- not a comment -->\n"); break;
+                default: out.put("function f" + std::to_string(i) + "(x) { return x << 2; }\n"); break;
+                }
+            }
+            out.put("</script>\n");
+        } else {
+            out.put("<style>\n");
+            int rules = rng.range(50, 3000);
+            for (int i = 0; i < rules && out.getWritten() < target; i++) {
+                out.put(".c" + std::to_string(i) + " > p, div[data-x=\"<b>\"] { margin: " + std::to_string(i % 40) +
+                        "px; content: \"</style-ish>\"; }\n");
+            }
+            out.put("</style>\n");
+        }
+        out.put(paragraph(rng));
+    }
+}
+
+inline void writeUnicode(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        switch (rng.range(0, 3)) {
+        case 0: out.put("<h2>" + unicodeSentence(rng, rng.range(2, 6)) + "</h2>\n"); break;
+        case 1: out.put("<p dir=\"rtl\">" + unicodeSentence(rng, rng.range(5, 40)) + "</p>\n"); break;
+        default: out.put("<p>" + unicodeSentence(rng, rng.range(5, 60)) + "</p>\n"); break;
+        }
+    }
+}
+
+// Realistic-looking pages with a bit of everything
+inline void writeMixed(CorpusRng& rng, CorpusWriter& out, uint64_t target) {
+    while (out.getWritten() < target) {
+        int pick = rng.range(0, 99);
+        if (pick < 55) {
+            out.put(paragraph(rng));
+        } else if (pick < 65) {
+            std::string level = std::to_string(rng.range(1, 3));
+            out.put("<h" + level + ">" + sentence(rng, rng.range(2, 8)) + "</h" + level + ">\n");
+        } else if (pick < 75) {
+            out.put("<ul>");
+            int items = rng.range(2, 12);
+            for (int i = 0; i < items; i++) out.put("<li>" + sentence(rng, rng.range(1, 6)) + "</li>");
+            out.put("</ul>\n");
+        } else if (pick < 83) {
+            out.put("<table><tr><th>" + sentence(rng, 1) + "</th><th>" + sentence(rng, 1) + "</th></tr>");
+            int rows = rng.range(2, 20);
+            for (int i = 0; i < rows; i++) {
+                out.put("<tr><td>" + std::to_string(rng.range(0, 99999)) + "</td><td>" + sentence(rng, 3) +
+                        "</td></tr>");
+            }
+            out.put("</table>\n");
+        } else if (pick < 90) {
+            int depth = rng.range(3, 25);
+            for (int i = 0; i < depth; i++) out.put("<div class=\"d" + std::to_string(i) + "\">");
+            out.put(paragraph(rng));
+            for (int i = 0; i < depth; i++) out.put("</div>");
+            out.put("\n");
+        } else if (pick < 95) {
+            out.put("<p>" + unicodeSentence(rng, rng.range(4, 20)) + "</p>\n");
+        } else {
+            out.put("<script>var x = '<b>" + sentence(rng, 2) + "</b>'; if (x.length < 3) {}</script>\n");
+        }
+    }
+}
+
+// Whole document: skeleton around one shape's content, about size bytes
+inline void writeDocument(CorpusShape shape, uint64_t seed, uint64_t size, FILE* file) {
+    CorpusRng rng(seed * 0x100000001B3ull + static_cast<uint64_t>(shape));
+    CorpusWriter out(file);
+    out.put("<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>Synthetic ");
+    out.put(std::string(kShapeNames[shape]) + " #" + std::to_string(seed) + "</title></head>\n<body>\n");
+    out.put("<h1>" + sentence(rng, 5) + "</h1>\n");
+
+    const uint64_t tail = 16; // "</body></html>\n"
+    uint64_t target = size > out.getWritten() + tail ? size - tail : out.getWritten();
+    switch (shape) {
+    case SHAPE_DEEP: writeDeep(rng, out, target - out.getWritten()); break;
+    case SHAPE_WIDE: writeWide(rng, out, target); break;
+    case SHAPE_ATTRS: writeAttrs(rng, out, target); break;
+    case SHAPE_TEXT: writeText(rng, out, target); break;
+    case SHAPE_UNCLOSED: writeUnclosed(rng, out, target); break;
+    case SHAPE_SCRIPT: writeScript(rng, out, target); break;
+    case SHAPE_UNICODE: writeUnicode(rng, out, target); break;
+    default: writeMixed(rng, out, target); break;
+    }
+    out.put("</body></html>\n");
+}
+
+#endif // HTML_CORPUS_GEN_H
@@ -0,0 +1,141 @@
+#ifndef HTML_ENTITIES_H
+#define HTML_ENTITIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "charset.h"
+#include "html_entity_table.h"
+
+// ============================================================================
+// CHARACTER REFERENCE DECODING (&amp; &#8217; &#x2014; &nbsp; ...)
+// ============================================================================
+
+// First '&' in [p, end), or end. Sixteen bytes are compared at a time, so
+// text without references is skipped without looking at each byte.
+inline const char* findAmpersand(const char* p, const char* end) {
+#ifdef CHARSET_SSE2
+    const __m128i amp = _mm_set1_epi8('&');
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, amp));
+        if (mask) return p + lowestSetBit(mask);
+        p += 16;
+    }
+#endif
+    const void* hit = memchr(p, '&', static_cast<size_t>(end - p));
+    return hit ? static_cast<const char*>(hit) : end;
+}
+
+// Entry whose name is exactly name[0..len), or nullptr. One hash picks the
+// displacement, a second one the slot, so a lookup compares one name at most.
+inline const HtmlEntity* findNamedEntity(const char* name, size_t len) {
+    auto hash = [name, len](uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (size_t i = 0; i < len; i++) {
+            h ^= static_cast<unsigned char>(name[i]);
+            h *= 16777619u;
+        }
+        return h;
+    };
+    int32_t d = htmlEntityDisplacement[hash(0) % HTML_ENTITY_COUNT];
+    uint32_t slot = d < 0 ? static_cast<uint32_t>(-d - 1) : hash(static_cast<uint32_t>(d)) % HTML_ENTITY_COUNT;
+    const HtmlEntity& entry = htmlEntityTable[slot];
+    if (strncmp(entry.name, name, len) != 0 || entry.name[len] != '\0') return nullptr;
+    return &entry;
+}
+
+// What a numeric reference stands for: NUL, surrogates and values past
+// U+10FFFF become U+FFFD, and 0x80-0x9F are read as windows-1252 like
+// browsers do (&#150; is an en dash)
+inline uint32_t numericReferenceValue(uint32_t cp) {
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return 0xFFFD;
+    if (cp >= 0x80 && cp <= 0x9F) return windows1252CodePoint(static_cast<unsigned char>(cp));
+    return cp;
+}
+
+inline bool isAsciiAlnum(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// Decodes the reference at p (which points at '&') into out. Returns how many
+// input bytes it used, or 0 when p does not start a reference it knows.
+inline size_t decodeCharacterReference(const char* p, const char* end, bool inAttribute, char*& out) {
+    const char* q = p + 1;
+    if (q < end && *q == '#') {
+        q++;
+        bool hex = q < end && (*q == 'x' || *q == 'X');
+        if (hex) q++;
+        const char* digits = q;
+        uint32_t cp = 0;
+        for (; q < end; q++) {
+            int v;
+            if (*q >= '0' && *q <= '9') v = *q - '0';
+            else if (hex && *q >= 'a' && *q <= 'f') v = *q - 'a' + 10;
+            else if (hex && *q >= 'A' && *q <= 'F') v = *q - 'A' + 10;
+            else break;
+            cp = cp > 0x10FFFF ? cp : cp * (hex ? 16 : 10) + static_cast<uint32_t>(v);
+        }
+        if (q == digits) return 0;
+        if (q < end && *q == ';') q++;
+        out = appendUtf8(out, numericReferenceValue(cp));
+        return static_cast<size_t>(q - p);
+    }
+
+    const char* name = q;
+    while (q < end && q - name < HTML_ENTITY_MAX_NAME && isAsciiAlnum(*q)) q++;
+    size_t nameLen = static_cast<size_t>(q - name);
+    if (nameLen == 0) return 0;
+    if (q < end && *q == ';') {
+        const HtmlEntity* entity = findNamedEntity(name, nameLen + 1);
+        if (entity) {
+            size_t bytes = strlen(entity->utf8);
+            memcpy(out, entity->utf8, bytes);
+            out += bytes;
+            return nameLen + 2;
+        }
+    }
+    // Legacy names (&amp, &copy, &nbsp ...) also work without ';', longest first
+    size_t longest = nameLen < static_cast<size_t>(HTML_ENTITY_MAX_LEGACY_NAME) ? nameLen : HTML_ENTITY_MAX_LEGACY_NAME;
+    for (size_t len = longest; len >= 2; len--) {
+        const HtmlEntity* entity = findNamedEntity(name, len);
+        if (!entity) continue;
+        // In attribute values "?a=1&copy=2" is a query string, not a reference
+        char next = name + len < end ? name[len] : '\0';
+        if (inAttribute && (isAsciiAlnum(next) || next == '=')) return 0;
+        size_t bytes = strlen(entity->utf8);
+        memcpy(out, entity->utf8, bytes);
+        out += bytes;
+        return len + 1;
+    }
+    return 0;
+}
+
+// Room decodeHtmlEntities may need for len input bytes. Only &nGt; and &nLt;
+// grow (5 bytes to 6), everything else decodes to at most its own length.
+inline size_t decodedEntitiesCapacity(size_t len) {
+    return len + len / 5 + 1;
+}
+
+// Writes text[0..len) to out with its character references decoded and
+// returns the decoded length. Runs between references are copied in bulk.
+inline size_t decodeHtmlEntities(const char* text, size_t len, char* out, bool inAttribute) {
+    const char* p = text;
+    const char* end = text + len;
+    char* start = out;
+    while (p < end) {
+        const char* amp = findAmpersand(p, end);
+        memcpy(out, p, static_cast<size_t>(amp - p));
+        out += amp - p;
+        if (amp == end) break;
+        size_t used = decodeCharacterReference(amp, end, inAttribute, out);
+        if (used == 0) {
+            *out++ = '&';
+            used = 1;
+        }
+        p = amp + used;
+    }
+    return static_cast<size_t>(out - start);
+}
+
+#endif // HTML_ENTITIES_H
@@ -0,0 +1,2440 @@
+// Generated by gen_html_entity_table.py, do not edit
+#ifndef HTML_ENTITY_TABLE_H
+#define HTML_ENTITY_TABLE_H
+
+#include <cstdint>
+
+// Name as written after '&' (with its ';' when the reference needs one), then its UTF-8
+struct HtmlEntity {
+    const char* name;
+    const char* utf8;
+};
+
+static const int HTML_ENTITY_COUNT = 2231;
+static const int HTML_ENTITY_MAX_NAME = 32;
+static const int HTML_ENTITY_MAX_LEGACY_NAME = 6; // longest name usable without ';'
+
+static const int32_t htmlEntityDisplacement[HTML_ENTITY_COUNT] = {
+    0, -2227, -2224, 0, 1, 1, 0, 1, -2220, 2, -2217, 0,
+    0, 0, -2216, 0, 1, 0, 0, -2215, -2212, 0, 1, -2209,
+    -2204, -2200, 0, 0, 0, -2194, 0, -2192, -2191, 1, 1, 0,
+    -2189, 0, -2185, -2181, -2180, -2178, 2, 1, 0, 0, 0, 0,
+    -2175, 2, 0, 2, 0, -2172, 2, -2170, 3, -2168, 2, -2167,
+    -2166, 0, 0, -2165, -2161, 4, 1, 1, -2156, -2155, -2154, 1,
+    1, 0, -2153, 0, 0, 0, -2152, 0, 1, 5, 1, -2150,
+    1, 0, 0, -2149, 0, -2146, 0, 0, 0, 1, -2145, 0,
+    0, 1, 1, 2, 0, 1, 0, -2143, 5, -2139, 1, 1,
+    -2138, 0, 1, 6, 0, -2136, 0, 0, 0, 1, 0, 0,
+    2, 0, -2135, 1, -2134, 1, 0, 5, 1, 0, 1, -2132,
+    1, -2129, -2128, -2127, 0, -2124, -2119, 2, -2112, -2111, -2107, 0,
+    0, -2105, -2102, -2101, -2097, 0, -2095, -2093, 0, -2092, 0, 0,
+    0, 0, 2, 1, -2091, 0, -2088, 0, -2084, 0, 1, 1,
+    -2074, 0, -2073, 0, 0, -2071, 0, -2069, -2064, -2062, -2061, 1,
+    0, 0, -2060, 1, 0, -2057, -2052, 0, 2, 1, -2051, 1,
+    -2050, 1, -2049, 0, 0, -2043, -2042, 0, -2038, -2037, 4, -2035,
+    0, -2034, 3, -2031, 0, -2028, 4, -2026, -2022, 0, 0, 3,
+    0, -2013, 6, 1, 2, 0, 0, -2012, -2005, 0, -1998, 1,
+    0, -1996, 0, -1994, 0, -1993, 0, -1991, -1986, 3, -1984, 0,
+    0, 1, 1, 0, -1981, 0, 0, 0, -1978, -1977, -1976, 0,
+    1, 0, -1965, 0, -1962, 1, -1960, 0, 0, 1, 3, 3,
+    -1958, -1957, 1, 2, 1, 2, 0, -1956, -1953, 0, 0, 0,
+    -1951, 2, -1947, -1945, -1943, 3, -1941, -1940, 0, 0, -1939, 0,
+    -1937, -1934, -1930, -1925, 3, 2, -1923, 0, 3, -1921, 0, 0,
+    1, 0, -1918, 2, -1916, -1910, 4, 0, 1, 0, -1909, 0,
+    0, -1908, 0, 1, 0, 0, 0, -1905, 0, -1902, 0, -1900,
+    0, 0, 1, 1, -1896, 1, -1895, 0, 0, 0, 4, 0,
+    0, -1892, 1, 0, 0, -1886, -1883, 0, -1882, 0, 4, 0,
+    0, 1, -1880, 1, 0, -1878, 0, 0, 0, -1877, -1876, 4,
+    0, -1874, 0, 0, 1, -1871, 0, -1870, -1869, 2, 0, -1861,
+    1, 0, 0, 0, -1854, 1, 0, 0, 1, -1852, 4, -1851,
+    0, 3, 1, -1850, 0, 0, 1, 0, -1847, 4, -1846, 0,
+    0, 0, -1844, 0, -1838, 0, -1836, 0, 0, 1, -1832, 3,
+    1, 2, -1831, -1826, 5, 0, 1, 0, 0, -1825, -1821, 0,
+    0, 0, 0, -1819, 0, 0, 3, 6, 2, -1815, 3, -1814,
+    -1810, 0, 0, -1806, -1804, -1799, 0, 5, 1, -1792, -1791, 0,
+    0, 0, 0, 0, 0, 1, -1786, 0, 0, 1, 0, -1785,
+    -1783, -1779, 0, -1774, 0, 6, 3, 1, -1773, -1769, 0, 2,
+    5, 0, -1764, 0, 0, 0, 0, -1757, -1753, 1, 0, 0,
+    0, -1751, 0, 1, -1745, 1, -1740, 0, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, -1739, 0, 0, -1737, 5,
+    -1732, 0, -1731, -1728, 0, 3, 1, 1, 1, 0, -1726, -1725,
+    0, -1722, 1, 1, -1721, -1718, 3, 0, 5, 1, -1715, 0,
+    -1712, -1707, -1701, 1, -1699, -1696, -1695, 0, 3, 1, 1, 0,
+    1, 0, -1694, 2, 0, -1692, 0, -1691, 6, -1689, 0, -1688,
+    -1685, 0, -1680, 0, -1679, 0, -1677, -1672, -1669, 0, 8, 2,
+    -1668, 1, 0, 1, 0, -1667, 1, -1666, -1665, -1662, -1660, 0,
+    -1657, 0, 1, -1653, -1650, -1647, -1646, 0, 0, -1645, -1639, 0,
+    -1638, -1630, 0, 0, -1629, -1626, 4, 1, 0, 0, -1625, -1624,
+    -1622, 2, -1620, 0, 0, -1616, -1613, -1610, 0, 1, -1605, -1601,
+    0, 1, 0, 0, 0, 0, 0, -1600, 1, 0, 2, -1599,
+    3, 0, 1, 4, 0, -1596, -1595, 1, -1594, 0, 4, 0,
+    -1593, 4, -1591, -1589, 0, -1587, -1585, 0, 1, 0, 0, -1579,
+    0, 2, -1578, -1576, -1574, -1572, 0, -1569, 0, -1567, -1566, 0,
+    -1564, 3, 4, 2, 0, -1563, -1562, 2, -1560, 4, 0, 2,
+    0, 2, 0, 0, -1558, 0, 1, 2, -1555, 0, 0, 1,
+    -1554, 0, 0, -1551, -1549, -1548, 7, 5, 0, -1545, -1543, -1542,
+    5, -1541, 0, -1540, 0, 2, -1539, -1538, 1, -1526, -1525, 0,
+    -1520, 0, -1514, -1509, 11, 0, -1507, -1503, 0, 0, -1500, 1,
+    -1498, 1, 1, 1, 1, 0, 1, -1497, 1, 2, 0, 0,
+    -1496, 0, 0, -1492, 2, 4, 4, 1, -1490, 0, -1489, 1,
+    -1488, -1487, 0, 0, -1486, 1, 0, -1484, 0, 0, 0, 2,
+    -1479, 2, 0, 1, 0, -1478, 0, 10, 1, -1476, -1473, -1469,
+    2, 3, 0, 3, 5, -1467, 0, 2, 3, 3, 1, 0,
+    -1466, 1, -1459, -1458, 1, 0, -1452, 1, 2, 0, 0, -1451,
+    5, -1449, -1448, 10, -1444, -1441, 0, -1440, 0, 3, 0, 0,
+    -1438, -1437, -1434, 0, 0, 0, -1428, 2, -1427, -1426, 0, 4,
+    0, 0, -1417, 0, -1416, 0, -1415, 0, -1412, -1405, 0, 1,
+    1, 2, 1, 0, -1404, 1, -1401, 1, -1398, -1393, -1392, 0,
+    -1389, 3, 0, 2, 1, -1386, 0, -1384, 2, -1383, -1382, 0,
+    -1377, -1376, -1375, 0, 0, 0, 0, 0, 0, 0, -1374, -1373,
+    -1371, 0, 0, -1368, 0, 0, 0, -1367, -1366, 2, -1365, 0,
+    -1356, 0, 0, 0, 0, 0, 1, -1353, -1350, -1349, 1, 4,
+    0, 5, -1344, 0, -1342, 0, -1341, 1, -1338, -1337, -1336, -1333,
+    0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, -1331,
+    0, -1329, -1326, 2, 0, -1325, -1324, -1323, -1319, 3, -1311, 2,
+    0, -1310, -1304, 0, -1302, 0, 3, -1298, 2, 0, 0, -1297,
+    -1296, 0, 1, -1291, 5, 3, 0, 0, 0, 0, 0, 0,
+    1, -1290, -1288, -1286, -1283, 2, -1282, -1274, -1273, 0, 0, -1270,
+    0, 8, -1269, 1, -1264, 1, 0, -1261, 0, 0, -1259, 0,
+    0, 0, 5, 0, 0, 0, 0, 1, 3, 8, -1258, -1256,
+    0, 1, 0, -1254, 0, -1253, -1249, -1248, 2, -1247, 0, -1244,
+    0, -1239, 0, 1, 7, 1, -1238, 15, 3, -1237, 4, 0,
+    0, 11, -1235, 0, -1234, -1233, 0, 0, 0, 0, 0, -1231,
+    0, 0, -1228, -1226, -1222, 2, -1218, -1216, -1209, -1208, 0, -1207,
+    0, -1206, 0, 1, -1204, -1201, -1200, -1198, 0, 1, -1196, -1195,
+    -1193, 2, -1191, 0, 1, 1, 0, 0, -1190, 4, -1187, 0,
+    0, 1, -1186, 0, -1185, -1183, -1181, -1177, -1176, 0, 0, 1,
+    0, 0, 0, 1, 1, -1174, -1171, -1170, 1, -1166, 2, 0,
+    0, -1164, -1162, 0, 0, -1157, -1153, 10, -1149, 1, 0, 0,
+    3, -1147, 0, -1145, 2, 4, 0, -1144, 3, 0, 0, 3,
+    -1142, 0, 7, 0, -1139, 0, -1137, -1135, 0, 0, -1133, 0,
+    7, 0, 1, -1130, 2, -1129, 1, -1126, 0, -1124, 0, -1121,
+    0, -1120, 0, -1117, -1115, 3, -1114, -1112, -1110, 0, -1106, 2,
+    1, 0, 0, -1105, 0, -1104, 0, 0, 2, -1102, 0, 1,
+    9, 0, 6, 0, 0, 0, 1, 4, 4, 2, -1100, -1098,
+    2, 2, 0, 5, -1097, 0, -1095, -1094, -1090, -1087, -1085, -1084,
+    0, 0, 1, 1, 0, -1082, -1080, -1077, -1071, 0, -1070, 11,
+    0, -1069, 0, 1, 0, 0, -1068, -1067, -1066, -1064, -1062, -1061,
+    0, 0, 0, -1055, 3, 1, -1053, 0, -1048, 5, -1047, 3,
+    -1041, 0, 0, -1040, 0, 3, 0, -1038, 7, -1035, -1027, 1,
+    0, -1025, 0, 0, 3, -1022, -1009, -1007, -1005, -999, 5, 0,
+    1, 0, 2, -998, 0, 3, 0, 1, 0, -993, 0, -991,
+    0, 2, 2, 5, -990, 7, -988, 2, 0, -985, -984, 0,
+    5, 1, -979, 1, 3, -977, 0, 2, 0, 0, -975, 5,
+    0, -973, 1, 2, -970, 0, -963, 7, -958, 0, -955, 2,
+    -948, -947, 0, 3, -944, -943, -936, 0, 0, 0, 0, 0,
+    -935, -934, -933, -930, 4, 2, 0, 0, 5, 2, 1, -928,
+    0, -926, -925, -917, 0, -911, -908, 0, 0, 1, 1, -907,
+    0, 0, 0, 4, -904, 0, -901, 0, 0, 1, 0, 1,
+    0, 0, -900, 0, 5, 0, 0, -894, -889, 1, -885, -884,
+    0, 1, 8, -876, 1, 0, 1, -870, -869, 9, 0, 3,
+    0, 0, -868, 0, -867, 0, 0, 0, 3, -866, 1, 3,
+    2, 0, 4, 1, 0, 0, 2, 1, -864, -860, 0, 3,
+    -859, 0, 0, 0, -856, 0, 0, -855, 5, 1, -849, -848,
+    1, -847, -843, -838, 3, -836, 2, 0, -822, -818, 0, -817,
+    -816, -812, -811, 1, -809, 0, 1, -807, 1, 3, 2, -800,
+    1, 0, 0, 0, 0, 0, -799, 3, -796, 0, 2, -793,
+    -792, 0, 0, -791, -788, -786, -785, -780, 0, 0, 0, -776,
+    0, 0, 0, 4, -772, 0, 0, -770, 1, -769, -762, 0,
+    2, 3, 10, 0, -752, 0, 0, 3, 4, -751, -742, 3,
+    4, 0, -737, -736, -733, 24, 0, -732, 0, -731, 3, -730,
+    2, -729, 0, 1, 13, 0, 0, -727, 0, 1, -726, 0,
+    -723, 0, 1, 2, 0, 0, 3, -720, -713, -712, 0, 5,
+    1, 1, 0, 0, 0, 29, 0, 2, -708, 0, 0, 0,
+    -707, 5, 4, -704, -702, 2, -699, 0, 5, 1, -698, -695,
+    1, 2, 0, 7, 0, 0, 0, -694, 0, -686, 0, -684,
+    0, -683, 0, 4, 0, 2, -682, -680, 0, -674, -673, -663,
+    -662, 3, 0, 0, 0, 10, 6, 0, -660, 0, 1, -659,
+    -658, 0, 0, 0, -655, -654, 2, -648, -647, 7, -646, 0,
+    -639, 2, 0, 0, 1, -637, 2, -635, 0, 0, -634, 0,
+    -633, -625, 0, -623, 0, 0, 0, 2, 2, -622, 0, -618,
+    9, 0, 0, -616, 0, -615, 0, 2, 1, 2, 0, 0,
+    -614, -613, -606, 0, -604, 0, -602, -600, 3, -598, 1, -597,
+    3, 3, 0, 0, 0, 0, 0, -594, 0, -593, -590, 6,
+    -589, -588, 7, -586, -585, 0, 0, -584, 1, 0, 4, -583,
+    0, -581, 0, 2, -579, -576, 0, -573, -568, 0, -567, 0,
+    -566, 0, 4, -563, -559, -555, 11, 2, 0, 0, 11, 0,
+    -548, -544, -543, 0, -542, -541, 33, -540, -536, -534, 8, 14,
+    2, 0, 0, -533, -529, 0, -525, -524, -522, -521, 1, 0,
+    32, -520, 0, -506, -504, -503, 4, 3, 0, -502, 0, -501,
+    -500, 0, 1, 2, 29, 0, 1, 0, 2, -496, 1, 0,
+    -493, 0, -492, 0, 0, -490, 4, 0, -488, 0, -486, -485,
+    0, 0, 0, 1, 0, -482, -480, 0, -474, 0, 0, 0,
+    0, -472, -471, 0, 1, -465, 0, 3, 2, 1, -464, 4,
+    4, -463, -461, 0, 0, 0, -460, -457, -456, 0, -455, -453,
+    -452, -448, 0, 0, 6, 9, 15, 1, 0, 2, 0, -447,
+    -446, -445, 0, -444, 0, -442, 1, 0, 0, -440, -439, 0,
+    -438, -437, -432, 0, 5, 3, 0, 5, 3, -430, -429, -425,
+    -422, 10, 1, 0, -419, 0, 0, 4, 0, -418, -417, -414,
+    0, -412, 0, 0, 2, 0, 8, -410, 0, 7, 13, -407,
+    1, 3, 5, 1, 1, -401, 11, -400, 0, 0, 10, 0,
+    -398, 0, -393, -385, 1, 4, -383, 14, 0, 0, 4, 11,
+    0, 0, 0, 25, 0, 0, 1, 0, -380, 0, 22, 0,
+    0, 2, -377, 2, 8, -375, 0, 0, 0, 0, 3, -374,
+    0, 16, 0, -373, -366, -365, -364, -361, 1, 8, 0, 0,
+    -355, 0, 0, 4, 0, -353, 0, -349, -347, 0, 0, -346,
+    13, -344, -339, 0, 12, 0, 1, -338, 0, 33, 5, 0,
+    6, 0, -336, 3, -334, -325, 1, -321, 0, 1, 5, -318,
+    0, 0, 0, 0, 0, -315, 0, 0, 0, 0, -309, 0,
+    -308, -305, -300, -299, -295, -290, -282, 0, 0, 1, -281, 0,
+    -276, 0, 0, -275, 8, -273, -272, 0, 1, -268, -267, 0,
+    0, 0, -264, 0, 0, 0, -260, 0, 0, -257, 2, 0,
+    -256, 0, -255, 1, 3, 0, -254, 0, 0, -252, -248, -242,
+    0, 0, -240, 0, 1, -235, 0, 4, 0, 0, 0, 0,
+    2, -234, 0, -233, 17, 0, 12, 16, 0, -231, 2, 3,
+    1, -229, -225, 0, 0, 1, -223, 0, -221, -217, -215, -213,
+    0, 1, 0, 0, 3, 0, 5, 0, -212, 6, -211, 0,
+    -210, 0, -207, 0, 0, -203, 13, -200, 0, -196, -195, 0,
+    0, 0, 17, 20, -194, 1, 0, -193, 0, 0, 1, -192,
+    1, 7, -188, 24, -186, -182, -179, -176, -175, -173, 0, 0,
+    7, 6, -170, 6, -168, 4, 2, -165, 0, 0, 3, 0,
+    0, 3, 0, -163, -162, 0, -161, 5, 0, -158, -157, -155,
+    1, 0, 8, 1, -154, -151, 0, -150, 0, 3, 5, 0,
+    -142, 8, 0, 0, 0, -141, -135, -131, 0, -129, 28, 0,
+    -128, 0, -127, 0, 0, 15, -126, 4, 0, 0, 20, 0,
+    0, 0, -121, 20, -120, 0, 0, 1, 0, -118, 0, 1,
+    -113, -111, -109, 0, -107, 0, 5, 0, -104, 0, -103, 0,
+    -101, -98, -96, 1, 0, -88, -87, 5, 0, 1, 0, 0,
+    -86, -82, 0, 0, 2, -80, 0, 0, 5, -77, 0, 19,
+    -76, -75, -74, 1, -73, -71, 0, 8, 8, 0, 0, 38,
+    0, 9, 0, 0, 4, 9, -70, 8, -67, 0, -66, -60,
+    0, 0, -55, 0, -52, 72, 6, -51, 0, 0, -50, 0,
+    0, -47, -41, -39, 0, -37, 0, -31, -29, -28, -26, -18,
+    2, -17, -15, -13, 4, -11, -1, 0, 1, 0, 0,
+};
+
+static const HtmlEntity htmlEntityTable[HTML_ENTITY_COUNT] = {
+    {"lvnE;", "\342\211\250\357\270\200"},
+    {"varrho;", "\317\261"},
+    {"eogon;", "\304\231"},
+    {"lessgtr;", "\342\211\266"},
+    {"fallingdotseq;", "\342\211\222"},
+    {"sqsube;", "\342\212\221"},
+    {"ovbar;", "\342\214\275"},
+    {"male;", "\342\231\202"},
+    {"eta;", "\316\267"},
+    {"lrm;", "\342\200\216"},
+    {"nVdash;", "\342\212\256"},
+    {"xuplus;", "\342\250\204"},
+    {"eqsim;", "\342\211\202"},
+    {"infin;", "\342\210\236"},
+    {"die;", "\302\250"},
+    {"percnt;", "%"},
+    {"Cconint;", "\342\210\260"},
+    {"yacute;", "\303\275"},
+    {"triminus;", "\342\250\272"},
+    {"lmoust;", "\342\216\260"},
+    {"frac58;", "\342\205\235"},
+    {"Bumpeq;", "\342\211\216"},
+    {"triangleright;", "\342\226\271"},
+    {"Longleftrightarrow;", "\342\237\272"},
+    {"elinters;", "\342\217\247"},
+    {"egsdot;", "\342\252\230"},
+    {"star;", "\342\230\206"},
+    {"divonx;", "\342\213\207"},
+    {"leftrightsquigarrow;", "\342\206\255"},
+    {"bumpeq;", "\342\211\217"},
+    {"itilde;", "\304\251"},
+    {"LeftCeiling;", "\342\214\210"},
+    {"larrhk;", "\342\206\251"},
+    {"qscr;", "\360\235\223\206"},
+    {"copf;", "\360\235\225\224"},
+    {"NotGreaterGreater;", "\342\211\253\314\270"},
+    {"planck;", "\342\204\217"},
+    {"UpArrowBar;", "\342\244\222"},
+    {"ocir;", "\342\212\232"},
+    {"minusdu;", "\342\250\252"},
+    {"hopf;", "\360\235\225\231"},
+    {"DownRightTeeVector;", "\342\245\237"},
+    {"Fcy;", "\320\244"},
+    {"frac16;", "\342\205\231"},
+    {"RightDownVector;", "\342\207\202"},
+    {"Lang;", "\342\237\252"},
+    {"Acirc", "\303\202"},
+    {"dotplus;", "\342\210\224"},
+    {"DoubleRightArrow;", "\342\207\222"},
+    {"nrarrc;", "\342\244\263\314\270"},
+    {"succnapprox;", "\342\252\272"},
+    {"Omega;", "\316\251"},
+    {"vBarv;", "\342\253\251"},
+    {"Ocy;", "\320\236"},
+    {"kappa;", "\316\272"},
+    {"bigtriangleup;", "\342\226\263"},
+    {"gdot;", "\304\241"},
+    {"fltns;", "\342\226\261"},
+    {"smt;", "\342\252\252"},
+    {"veebar;", "\342\212\273"},
+    {"lthree;", "\342\213\213"},
+    {"LongRightArrow;", "\342\237\266"},
+    {"notin;", "\342\210\211"},
+    {"GreaterTilde;", "\342\211\263"},
+    {"leftrightarrows;", "\342\207\206"},
+    {"submult;", "\342\253\201"},
+    {"plusmn", "\302\261"},
+    {"NotLessSlantEqual;", "\342\251\275\314\270"},
+    {"elsdot;", "\342\252\227"},
+    {"part;", "\342\210\202"},
+    {"blk34;", "\342\226\223"},
+    {"equiv;", "\342\211\241"},
+    {"Idot;", "\304\260"},
+    {"gtreqless;", "\342\213\233"},
+    {"circledS;", "\342\223\210"},
+    {"frasl;", "\342\201\204"},
+    {"lesseqgtr;", "\342\213\232"},
+    {"swarr;", "\342\206\231"},
+    {"gsiml;", "\342\252\220"},
+    {"nGt;", "\342\211\253\342\203\222"},
+    {"Zeta;", "\316\226"},
+    {"Vbar;", "\342\253\253"},
+    {"ecirc;", "\303\252"},
+    {"ascr;", "\360\235\222\266"},
+    {"mfr;", "\360\235\224\252"},
+    {"nsubseteq;", "\342\212\210"},
+    {"bump;", "\342\211\216"},
+    {"beta;", "\316\262"},
+    {"nleqq;", "\342\211\246\314\270"},
+    {"ReverseUpEquilibrium;", "\342\245\257"},
+    {"yacy;", "\321\217"},
+    {"square;", "\342\226\241"},
+    {"complement;", "\342\210\201"},
+    {"yscr;", "\360\235\223\216"},
+    {"range;", "\342\246\245"},
+    {"dollar;", "$"},
+    {"twixt;", "\342\211\254"},
+    {"twoheadleftarrow;", "\342\206\236"},
+    {"Int;", "\342\210\254"},
+    {"nbumpe;", "\342\211\217\314\270"},
+    {"UpTee;", "\342\212\245"},
+    {"lagran;", "\342\204\222"},
+    {"nesear;", "\342\244\250"},
+    {"Delta;", "\316\224"},
+    {"Ucy;", "\320\243"},
+    {"larr;", "\342\206\220"},
+    {"iexcl", "\302\241"},
+    {"Jfr;", "\360\235\224\215"},
+    {"rtrie;", "\342\212\265"},
+    {"Wcirc;", "\305\264"},
+    {"subsetneq;", "\342\212\212"},
+    {"DifferentialD;", "\342\205\206"},
+    {"thorn", "\303\276"},
+    {"comp;", "\342\210\201"},
+    {"olt;", "\342\247\200"},
+    {"times;", "\303\227"},
+    {"rrarr;", "\342\207\211"},
+    {"COPY", "\302\251"},
+    {"Yuml;", "\305\270"},
+    {"SquareSupersetEqual;", "\342\212\222"},
+    {"backsimeq;", "\342\213\215"},
+    {"mstpos;", "\342\210\276"},
+    {"geq;", "\342\211\245"},
+    {"rarrap;", "\342\245\265"},
+    {"Kopf;", "\360\235\225\202"},
+    {"NestedLessLess;", "\342\211\252"},
+    {"SHCHcy;", "\320\251"},
+    {"ecolon;", "\342\211\225"},
+    {"SHcy;", "\320\250"},
+    {"rsh;", "\342\206\261"},
+    {"nap;", "\342\211\211"},
+    {"looparrowleft;", "\342\206\253"},
+    {"ccedil", "\303\247"},
+    {"iinfin;", "\342\247\234"},
+    {"nleqslant;", "\342\251\275\314\270"},
+    {"Dfr;", "\360\235\224\207"},
+    {"ncedil;", "\305\206"},
+    {"Ubrcy;", "\320\216"},
+    {"Egrave", "\303\210"},
+    {"gl;", "\342\211\267"},
+    {"nvrtrie;", "\342\212\265\342\203\222"},
+    {"bigvee;", "\342\213\201"},
+    {"pi;", "\317\200"},
+    {"igrave", "\303\254"},
+    {"nhArr;", "\342\207\216"},
+    {"epar;", "\342\213\225"},
+    {"prop;", "\342\210\235"},
+    {"nvrArr;", "\342\244\203"},
+    {"trie;", "\342\211\234"},
+    {"compfn;", "\342\210\230"},
+    {"Gcirc;", "\304\234"},
+    {"tint;", "\342\210\255"},
+    {"Vert;", "\342\200\226"},
+    {"TildeTilde;", "\342\211\210"},
+    {"supdot;", "\342\252\276"},
+    {"dharr;", "\342\207\202"},
+    {"dzigrarr;", "\342\237\277"},
+    {"top;", "\342\212\244"},
+    {"eqcolon;", "\342\211\225"},
+    {"rpar;", ")"},
+    {"Tcedil;", "\305\242"},
+    {"rlm;", "\342\200\217"},
+    {"bigoplus;", "\342\250\201"},
+    {"biguplus;", "\342\250\204"},
+    {"ap;", "\342\211\210"},
+    {"searr;", "\342\206\230"},
+    {"Implies;", "\342\207\222"},
+    {"ominus;", "\342\212\226"},
+    {"nvap;", "\342\211\215\342\203\222"},
+    {"notnivc;", "\342\213\275"},
+    {"Im;", "\342\204\221"},
+    {"angmsdac;", "\342\246\252"},
+    {"succcurlyeq;", "\342\211\275"},
+    {"boxUL;", "\342\225\235"},
+    {"NotSquareSubsetEqual;", "\342\213\242"},
+    {"sc;", "\342\211\273"},
+    {"nrArr;", "\342\207\217"},
+    {"leqslant;", "\342\251\275"},
+    {"vartriangleright;", "\342\212\263"},
+    {"nsimeq;", "\342\211\204"},
+    {"uuarr;", "\342\207\210"},
+    {"xopf;", "\360\235\225\251"},
+    {"ffllig;", "\357\254\204"},
+    {"aopf;", "\360\235\225\222"},
+    {"check;", "\342\234\223"},
+    {"gnE;", "\342\211\251"},
+    {"approx;", "\342\211\210"},
+    {"CounterClockwiseContourIntegral;", "\342\210\263"},
+    {"sect;", "\302\247"},
+    {"DiacriticalTilde;", "\313\234"},
+    {"Oslash", "\303\230"},
+    {"diams;", "\342\231\246"},
+    {"boxvl;", "\342\224\244"},
+    {"ratail;", "\342\244\232"},
+    {"Intersection;", "\342\213\202"},
+    {"Coproduct;", "\342\210\220"},
+    {"setmn;", "\342\210\226"},
+    {"bigodot;", "\342\250\200"},
+    {"gtquest;", "\342\251\274"},
+    {"lsaquo;", "\342\200\271"},
+    {"rect;", "\342\226\255"},
+    {"dHar;", "\342\245\245"},
+    {"sup1;", "\302\271"},
+    {"sqcaps;", "\342\212\223\357\270\200"},
+    {"reg;", "\302\256"},
+    {"nlsim;", "\342\211\264"},
+    {"RightArrowLeftArrow;", "\342\207\204"},
+    {"fscr;", "\360\235\222\273"},
+    {"bsol;", "\134"},
+    {"vDash;", "\342\212\250"},
+    {"macr;", "\302\257"},
+    {"rarrfs;", "\342\244\236"},
+    {"brvbar;", "\302\246"},
+    {"sup3;", "\302\263"},
+    {"ocirc", "\303\264"},
+    {"sqcups;", "\342\212\224\357\270\200"},
+    {"apos;", "'"},
+    {"lgE;", "\342\252\221"},
+    {"mldr;", "\342\200\246"},
+    {"supsub;", "\342\253\224"},
+    {"swnwar;", "\342\244\252"},
+    {"awint;", "\342\250\221"},
+    {"Zfr;", "\342\204\250"},
+    {"trpezium;", "\342\217\242"},
+    {"Uring;", "\305\256"},
+    {"andslope;", "\342\251\230"},
+    {"isin;", "\342\210\210"},
+    {"spar;", "\342\210\245"},
+    {"Hopf;", "\342\204\215"},
+    {"NotGreater;", "\342\211\257"},
+    {"upsih;", "\317\222"},
+    {"Sub;", "\342\213\220"},
+    {"comma;", ","},
+    {"succapprox;", "\342\252\270"},
+    {"prnsim;", "\342\213\250"},
+    {"rbrace;", "}"},
+    {"imagpart;", "\342\204\221"},
+    {"shy;", "\302\255"},
+    {"Yacute", "\303\235"},
+    {"and;", "\342\210\247"},
+    {"njcy;", "\321\232"},
+    {"DownTeeArrow;", "\342\206\247"},
+    {"Uscr;", "\360\235\222\260"},
+    {"curvearrowleft;", "\342\206\266"},
+    {"euro;", "\342\202\254"},
+    {"zcy;", "\320\267"},
+    {"ngtr;", "\342\211\257"},
+    {"PrecedesTilde;", "\342\211\276"},
+    {"bnot;", "\342\214\220"},
+    {"quaternions;", "\342\204\215"},
+    {"gacute;", "\307\265"},
+    {"duhar;", "\342\245\257"},
+    {"Exists;", "\342\210\203"},
+    {"Eogon;", "\304\230"},
+    {"frac12;", "\302\275"},
+    {"dcaron;", "\304\217"},
+    {"nsubE;", "\342\253\205\314\270"},
+    {"xcirc;", "\342\227\257"},
+    {"DoubleDownArrow;", "\342\207\223"},
+    {"NegativeThinSpace;", "\342\200\213"},
+    {"bbrk;", "\342\216\265"},
+    {"curren", "\302\244"},
+    {"nprec;", "\342\212\200"},
+    {"lowbar;", "_"},
+    {"NotSubset;", "\342\212\202\342\203\222"},
+    {"shortparallel;", "\342\210\245"},
+    {"Euml;", "\303\213"},
+    {"Ofr;", "\360\235\224\222"},
+    {"Sacute;", "\305\232"},
+    {"deg", "\302\260"},
+    {"ntgl;", "\342\211\271"},
+    {"pluse;", "\342\251\262"},
+    {"blk12;", "\342\226\222"},
+    {"rharu;", "\342\207\200"},
+    {"gne;", "\342\252\210"},
+    {"Hcirc;", "\304\244"},
+    {"TildeEqual;", "\342\211\203"},
+    {"Jukcy;", "\320\204"},
+    {"straightphi;", "\317\225"},
+    {"ordf;", "\302\252"},
+    {"blk14;", "\342\226\221"},
+    {"Atilde", "\303\203"},
+    {"jukcy;", "\321\224"},
+    {"emptyset;", "\342\210\205"},
+    {"triangle;", "\342\226\265"},
+    {"UpEquilibrium;", "\342\245\256"},
+    {"sext;", "\342\234\266"},
+    {"nleftarrow;", "\342\206\232"},
+    {"udhar;", "\342\245\256"},
+    {"Cfr;", "\342\204\255"},
+    {"supsetneqq;", "\342\253\214"},
+    {"LongLeftArrow;", "\342\237\265"},
+    {"times", "\303\227"},
+    {"cacute;", "\304\207"},
+    {"softcy;", "\321\214"},
+    {"harr;", "\342\206\224"},
+    {"rightharpoondown;", "\342\207\201"},
+    {"Vdashl;", "\342\253\246"},
+    {"jopf;", "\360\235\225\233"},
+    {"npr;", "\342\212\200"},
+    {"bcong;", "\342\211\214"},
+    {"ni;", "\342\210\213"},
+    {"Jsercy;", "\320\210"},
+    {"npre;", "\342\252\257\314\270"},
+    {"boxhD;", "\342\225\245"},
+    {"urcorner;", "\342\214\235"},
+    {"rightthreetimes;", "\342\213\214"},
+    {"ltlarr;", "\342\245\266"},
+    {"RightDoubleBracket;", "\342\237\247"},
+    {"gjcy;", "\321\223"},
+    {"ograve;", "\303\262"},
+    {"gtrsim;", "\342\211\263"},
+    {"ltrif;", "\342\227\202"},
+    {"Lambda;", "\316\233"},
+    {"par;", "\342\210\245"},
+    {"AMP", "&"},
+    {"subseteqq;", "\342\253\205"},
+    {"Jcy;", "\320\231"},
+    {"Oslash;", "\303\230"},
+    {"lnap;", "\342\252\211"},
+    {"rarrbfs;", "\342\244\240"},
+    {"aleph;", "\342\204\265"},
+    {"DoubleVerticalBar;", "\342\210\245"},
+    {"Sc;", "\342\252\274"},
+    {"Ll;", "\342\213\230"},
+    {"LeftUpTeeVector;", "\342\245\240"},
+    {"yicy;", "\321\227"},
+    {"Racute;", "\305\224"},
+    {"succsim;", "\342\211\277"},
+    {"Jopf;", "\360\235\225\201"},
+    {"zigrarr;", "\342\207\235"},
+    {"kjcy;", "\321\234"},
+    {"Iacute;", "\303\215"},
+    {"rarr;", "\342\206\222"},
+    {"escr;", "\342\204\257"},
+    {"oast;", "\342\212\233"},
+    {"plankv;", "\342\204\217"},
+    {"midast;", "*"},
+    {"wscr;", "\360\235\223\214"},
+    {"acirc;", "\303\242"},
+    {"raquo;", "\302\273"},
+    {"subE;", "\342\253\205"},
+    {"DownTee;", "\342\212\244"},
+    {"gfr;", "\360\235\224\244"},
+    {"mapstoleft;", "\342\206\244"},
+    {"ndash;", "\342\200\223"},
+    {"ddagger;", "\342\200\241"},
+    {"DiacriticalAcute;", "\302\264"},
+    {"Upsilon;", "\316\245"},
+    {"imof;", "\342\212\267"},
+    {"lsquo;", "\342\200\230"},
+    {"ogon;", "\313\233"},
+    {"sfr;", "\360\235\224\260"},
+    {"lbarr;", "\342\244\214"},
+    {"awconint;", "\342\210\263"},
+    {"rang;", "\342\237\251"},
+    {"nshortmid;", "\342\210\244"},
+    {"GreaterEqualLess;", "\342\213\233"},
+    {"TripleDot;", "\342\203\233"},
+    {"DD;", "\342\205\205"},
+    {"NotExists;", "\342\210\204"},
+    {"DoubleLongRightArrow;", "\342\237\271"},
+    {"deg;", "\302\260"},
+    {"prE;", "\342\252\263"},
+    {"ReverseElement;", "\342\210\213"},
+    {"napE;", "\342\251\260\314\270"},
+    {"COPY;", "\302\251"},
+    {"nopf;", "\360\235\225\237"},
+    {"lsh;", "\342\206\260"},
+    {"lt;", "<"},
+    {"DJcy;", "\320\202"},
+    {"LeftTriangle;", "\342\212\262"},
+    {"approxeq;", "\342\211\212"},
+    {"cent", "\302\242"},
+    {"rnmid;", "\342\253\256"},
+    {"TildeFullEqual;", "\342\211\205"},
+    {"eacute", "\303\251"},
+    {"Tcy;", "\320\242"},
+    {"ncaron;", "\305\210"},
+    {"blacksquare;", "\342\226\252"},
+    {"Dopf;", "\360\235\224\273"},
+    {"Poincareplane;", "\342\204\214"},
+    {"Scaron;", "\305\240"},
+    {"Yscr;", "\360\235\222\264"},
+    {"nrarrw;", "\342\206\235\314\270"},
+    {"Eopf;", "\360\235\224\274"},
+    {"curarrm;", "\342\244\274"},
+    {"topfork;", "\342\253\232"},
+    {"notnivb;", "\342\213\276"},
+    {"hslash;", "\342\204\217"},
+    {"Lscr;", "\342\204\222"},
+    {"nsupseteq;", "\342\212\211"},
+    {"jfr;", "\360\235\224\247"},
+    {"NotEqual;", "\342\211\240"},
+    {"rsaquo;", "\342\200\272"},
+    {"NotReverseElement;", "\342\210\214"},
+    {"downarrow;", "\342\206\223"},
+    {"boxv;", "\342\224\202"},
+    {"digamma;", "\317\235"},
+    {"ltquest;", "\342\251\273"},
+    {"RoundImplies;", "\342\245\260"},
+    {"ntlg;", "\342\211\270"},
+    {"REG", "\302\256"},
+    {"laquo", "\302\253"},
+    {"drbkarow;", "\342\244\220"},
+    {"subne;", "\342\212\212"},
+    {"eqvparsl;", "\342\247\245"},
+    {"qprime;", "\342\201\227"},
+    {"NotNestedLessLess;", "\342\252\241\314\270"},
+    {"esim;", "\342\211\202"},
+    {"complexes;", "\342\204\202"},
+    {"plusacir;", "\342\250\243"},
+    {"cscr;", "\360\235\222\270"},
+    {"radic;", "\342\210\232"},
+    {"blacktriangle;", "\342\226\264"},
+    {"supe;", "\342\212\207"},
+    {"blacklozenge;", "\342\247\253"},
+    {"OpenCurlyDoubleQuote;", "\342\200\234"},
+    {"nlarr;", "\342\206\232"},
+    {"gopf;", "\360\235\225\230"},
+    {"bsolb;", "\342\247\205"},
+    {"nearrow;", "\342\206\227"},
+    {"rHar;", "\342\245\244"},
+    {"frac25;", "\342\205\226"},
+    {"ldsh;", "\342\206\262"},
+    {"DownRightVector;", "\342\207\201"},
+    {"rarrlp;", "\342\206\254"},
+    {"Uparrow;", "\342\207\221"},
+    {"cedil;", "\302\270"},
+    {"boxUl;", "\342\225\234"},
+    {"nbsp", "\302\240"},
+    {"sqsupseteq;", "\342\212\222"},
+    {"smeparsl;", "\342\247\244"},
+    {"frac38;", "\342\205\234"},
+    {"notinE;", "\342\213\271\314\270"},
+    {"sqsup;", "\342\212\220"},
+    {"sube;", "\342\212\206"},
+    {"plusdo;", "\342\210\224"},
+    {"ctdot;", "\342\213\257"},
+    {"Icy;", "\320\230"},
+    {"omicron;", "\316\277"},
+    {"trianglelefteq;", "\342\212\264"},
+    {"csupe;", "\342\253\222"},
+    {"bull;", "\342\200\242"},
+    {"Del;", "\342\210\207"},
+    {"ncy;", "\320\275"},
+    {"gap;", "\342\252\206"},
+    {"frac78;", "\342\205\236"},
+    {"asymp;", "\342\211\210"},
+    {"Mscr;", "\342\204\263"},
+    {"forall;", "\342\210\200"},
+    {"Ncedil;", "\305\205"},
+    {"bnequiv;", "\342\211\241\342\203\245"},
+    {"xscr;", "\360\235\223\215"},
+    {"Leftarrow;", "\342\207\220"},
+    {"tritime;", "\342\250\273"},
+    {"uopf;", "\360\235\225\246"},
+    {"dscy;", "\321\225"},
+    {"zwj;", "\342\200\215"},
+    {"cross;", "\342\234\227"},
+    {"gcirc;", "\304\235"},
+    {"Gcy;", "\320\223"},
+    {"SucceedsTilde;", "\342\211\277"},
+    {"sub;", "\342\212\202"},
+    {"vrtri;", "\342\212\263"},
+    {"xsqcup;", "\342\250\206"},
+    {"boxDl;", "\342\225\226"},
+    {"Conint;", "\342\210\257"},
+    {"rbbrk;", "\342\235\263"},
+    {"Yopf;", "\360\235\225\220"},
+    {"Colon;", "\342\210\267"},
+    {"iogon;", "\304\257"},
+    {"boxdr;", "\342\224\214"},
+    {"timesbar;", "\342\250\261"},
+    {"NotSquareSuperset;", "\342\212\220\314\270"},
+    {"xmap;", "\342\237\274"},
+    {"Longrightarrow;", "\342\237\271"},
+    {"SucceedsSlantEqual;", "\342\211\275"},
+    {"rdquo;", "\342\200\235"},
+    {"NotCongruent;", "\342\211\242"},
+    {"suplarr;", "\342\245\273"},
+    {"GreaterLess;", "\342\211\267"},
+    {"gesles;", "\342\252\224"},
+    {"Kfr;", "\360\235\224\216"},
+    {"NotVerticalBar;", "\342\210\244"},
+    {"Bopf;", "\360\235\224\271"},
+    {"Qopf;", "\342\204\232"},
+    {"dtri;", "\342\226\277"},
+    {"geqslant;", "\342\251\276"},
+    {"Re;", "\342\204\234"},
+    {"gel;", "\342\213\233"},
+    {"efDot;", "\342\211\222"},
+    {"smashp;", "\342\250\263"},
+    {"circlearrowleft;", "\342\206\272"},
+    {"dlcrop;", "\342\214\215"},
+    {"Gammad;", "\317\234"},
+    {"Vscr;", "\360\235\222\261"},
+    {"latail;", "\342\244\231"},
+    {"Agrave;", "\303\200"},
+    {"nLl;", "\342\213\230\314\270"},
+    {"gbreve;", "\304\237"},
+    {"olcir;", "\342\246\276"},
+    {"fcy;", "\321\204"},
+    {"profline;", "\342\214\222"},
+    {"xharr;", "\342\237\267"},
+    {"rfloor;", "\342\214\213"},
+    {"emacr;", "\304\223"},
+    {"rlarr;", "\342\207\204"},
+    {"blacktriangleright;", "\342\226\270"},
+    {"lscr;", "\360\235\223\201"},
+    {"ropf;", "\360\235\225\243"},
+    {"varpi;", "\317\226"},
+    {"lotimes;", "\342\250\264"},
+    {"Proportional;", "\342\210\235"},
+    {"Ograve;", "\303\222"},
+    {"DownArrow;", "\342\206\223"},
+    {"Dcaron;", "\304\216"},
+    {"iquest", "\302\277"},
+    {"alefsym;", "\342\204\265"},
+    {"boxuL;", "\342\225\233"},
+    {"sqsubset;", "\342\212\217"},
+    {"ord;", "\342\251\235"},
+    {"rppolint;", "\342\250\222"},
+    {"eDot;", "\342\211\221"},
+    {"LeftArrow;", "\342\206\220"},
+    {"Longleftarrow;", "\342\237\270"},
+    {"ensp;", "\342\200\202"},
+    {"thetasym;", "\317\221"},
+    {"varsubsetneqq;", "\342\253\213\357\270\200"},
+    {"incare;", "\342\204\205"},
+    {"OverParenthesis;", "\342\217\234"},
+    {"NotTildeEqual;", "\342\211\204"},
+    {"bigwedge;", "\342\213\200"},
+    {"Itilde;", "\304\250"},
+    {"mopf;", "\360\235\225\236"},
+    {"geqq;", "\342\211\247"},
+    {"colon;", ":"},
+    {"llarr;", "\342\207\207"},
+    {"hscr;", "\360\235\222\275"},
+    {"mapstodown;", "\342\206\247"},
+    {"gcy;", "\320\263"},
+    {"para;", "\302\266"},
+    {"permil;", "\342\200\260"},
+    {"suphsol;", "\342\237\211"},
+    {"cirfnint;", "\342\250\220"},
+    {"RightTee;", "\342\212\242"},
+    {"lneqq;", "\342\211\250"},
+    {"frac14;", "\302\274"},
+    {"Zscr;", "\360\235\222\265"},
+    {"napprox;", "\342\211\211"},
+    {"numsp;", "\342\200\207"},
+    {"cuvee;", "\342\213\216"},
+    {"aelig", "\303\246"},
+    {"Uarr;", "\342\206\237"},
+    {"ltcc;", "\342\252\246"},
+    {"Aogon;", "\304\204"},
+    {"topbot;", "\342\214\266"},
+    {"veeeq;", "\342\211\232"},
+    {"lg;", "\342\211\266"},
+    {"pm;", "\302\261"},
+    {"vsubne;", "\342\212\212\357\270\200"},
+    {"nu;", "\316\275"},
+    {"smid;", "\342\210\243"},
+    {"TSHcy;", "\320\213"},
+    {"ImaginaryI;", "\342\205\210"},
+    {"Uuml", "\303\234"},
+    {"rarrsim;", "\342\245\264"},
+    {"infintie;", "\342\247\235"},
+    {"longmapsto;", "\342\237\274"},
+    {"lesdoto;", "\342\252\201"},
+    {"therefore;", "\342\210\264"},
+    {"Scy;", "\320\241"},
+    {"omid;", "\342\246\266"},
+    {"cuwed;", "\342\213\217"},
+    {"jcirc;", "\304\265"},
+    {"zacute;", "\305\272"},
+    {"aring;", "\303\245"},
+    {"apid;", "\342\211\213"},
+    {"Efr;", "\360\235\224\210"},
+    {"nvlt;", "<\342\203\222"},
+    {"erarr;", "\342\245\261"},
+    {"Updownarrow;", "\342\207\225"},
+    {"cdot;", "\304\213"},
+    {"iacute;", "\303\255"},
+    {"ordm;", "\302\272"},
+    {"angrt;", "\342\210\237"},
+    {"Iacute", "\303\215"},
+    {"topf;", "\360\235\225\245"},
+    {"UnderParenthesis;", "\342\217\235"},
+    {"UnionPlus;", "\342\212\216"},
+    {"leftleftarrows;", "\342\207\207"},
+    {"NotSquareSupersetEqual;", "\342\213\243"},
+    {"ruluhar;", "\342\245\250"},
+    {"THORN", "\303\236"},
+    {"Hfr;", "\342\204\214"},
+    {"iscr;", "\360\235\222\276"},
+    {"plusmn;", "\302\261"},
+    {"larrb;", "\342\207\244"},
+    {"fllig;", "\357\254\202"},
+    {"imagline;", "\342\204\220"},
+    {"RightVector;", "\342\207\200"},
+    {"Beta;", "\316\222"},
+    {"nLeftrightarrow;", "\342\207\216"},
+    {"kappav;", "\317\260"},
+    {"darr;", "\342\206\223"},
+    {"sqcap;", "\342\212\223"},
+    {"Udblac;", "\305\260"},
+    {"nsmid;", "\342\210\244"},
+    {"acd;", "\342\210\277"},
+    {"NJcy;", "\320\212"},
+    {"LeftUpVectorBar;", "\342\245\230"},
+    {"otilde", "\303\265"},
+    {"wreath;", "\342\211\200"},
+    {"roarr;", "\342\207\276"},
+    {"beth;", "\342\204\266"},
+    {"LeftAngleBracket;", "\342\237\250"},
+    {"minus;", "\342\210\222"},
+    {"atilde", "\303\243"},
+    {"backprime;", "\342\200\265"},
+    {"semi;", ";"},
+    {"Diamond;", "\342\213\204"},
+    {"LeftArrowBar;", "\342\207\244"},
+    {"leftthreetimes;", "\342\213\213"},
+    {"CapitalDifferentialD;", "\342\205\205"},
+    {"inodot;", "\304\261"},
+    {"xlArr;", "\342\237\270"},
+    {"cup;", "\342\210\252"},
+    {"nsc;", "\342\212\201"},
+    {"because;", "\342\210\265"},
+    {"isinsv;", "\342\213\263"},
+    {"Zcy;", "\320\227"},
+    {"Odblac;", "\305\220"},
+    {"Uacute;", "\303\232"},
+    {"Acirc;", "\303\202"},
+    {"eDDot;", "\342\251\267"},
+    {"tilde;", "\313\234"},
+    {"nles;", "\342\251\275\314\270"},
+    {"mnplus;", "\342\210\223"},
+    {"amp;", "&"},
+    {"amalg;", "\342\250\277"},
+    {"emsp;", "\342\200\203"},
+    {"amacr;", "\304\201"},
+    {"ldrdhar;", "\342\245\247"},
+    {"rlhar;", "\342\207\214"},
+    {"nsucc;", "\342\212\201"},
+    {"Ncaron;", "\305\207"},
+    {"oslash", "\303\270"},
+    {"Map;", "\342\244\205"},
+    {"OElig;", "\305\222"},
+    {"sigmav;", "\317\202"},
+    {"langle;", "\342\237\250"},
+    {"thinsp;", "\342\200\211"},
+    {"lesdotor;", "\342\252\203"},
+    {"Backslash;", "\342\210\226"},
+    {"nltri;", "\342\213\252"},
+    {"rpargt;", "\342\246\224"},
+    {"rationals;", "\342\204\232"},
+    {"chi;", "\317\207"},
+    {"thetav;", "\317\221"},
+    {"minusb;", "\342\212\237"},
+    {"Rarrtl;", "\342\244\226"},
+    {"raquo", "\302\273"},
+    {"plustwo;", "\342\250\247"},
+    {"Ubreve;", "\305\254"},
+    {"bsolhsub;", "\342\237\210"},
+    {"mapstoup;", "\342\206\245"},
+    {"vnsup;", "\342\212\203\342\203\222"},
+    {"larrsim;", "\342\245\263"},
+    {"Rcaron;", "\305\230"},
+    {"oS;", "\342\223\210"},
+    {"udarr;", "\342\207\205"},
+    {"eplus;", "\342\251\261"},
+    {"Nfr;", "\360\235\224\221"},
+    {"LessLess;", "\342\252\241"},
+    {"sol;", "/"},
+    {"xrarr;", "\342\237\266"},
+    {"urcorn;", "\342\214\235"},
+    {"boxuR;", "\342\225\230"},
+    {"ac;", "\342\210\276"},
+    {"Lacute;", "\304\271"},
+    {"uacute", "\303\272"},
+    {"Lsh;", "\342\206\260"},
+    {"TRADE;", "\342\204\242"},
+    {"oslash;", "\303\270"},
+    {"subnE;", "\342\253\213"},
+    {"intcal;", "\342\212\272"},
+    {"equest;", "\342\211\237"},
+    {"maltese;", "\342\234\240"},
+    {"orderof;", "\342\204\264"},
+    {"ordf", "\302\252"},
+    {"rAarr;", "\342\207\233"},
+    {"qopf;", "\360\235\225\242"},
+    {"supset;", "\342\212\203"},
+    {"UnderBar;", "_"},
+    {"tcy;", "\321\202"},
+    {"middot;", "\302\267"},
+    {"aacute", "\303\241"},
+    {"Aacute;", "\303\201"},
+    {"Oopf;", "\360\235\225\206"},
+    {"Product;", "\342\210\217"},
+    {"mho;", "\342\204\247"},
+    {"tfr;", "\360\235\224\261"},
+    {"ccups;", "\342\251\214"},
+    {"setminus;", "\342\210\226"},
+    {"harrcir;", "\342\245\210"},
+    {"caret;", "\342\201\201"},
+    {"nge;", "\342\211\261"},
+    {"capbrcup;", "\342\251\211"},
+    {"LeftDownVectorBar;", "\342\245\231"},
+    {"rArr;", "\342\207\222"},
+    {"Otilde;", "\303\225"},
+    {"boxDL;", "\342\225\227"},
+    {"lceil;", "\342\214\210"},
+    {"cularr;", "\342\206\266"},
+    {"ape;", "\342\211\212"},
+    {"Ucirc;", "\303\233"},
+    {"DiacriticalDoubleAcute;", "\313\235"},
+    {"thickapprox;", "\342\211\210"},
+    {"EmptySmallSquare;", "\342\227\273"},
+    {"Because;", "\342\210\265"},
+    {"llhard;", "\342\245\253"},
+    {"Supset;", "\342\213\221"},
+    {"Ocirc;", "\303\224"},
+    {"longleftrightarrow;", "\342\237\267"},
+    {"empty;", "\342\210\205"},
+    {"utri;", "\342\226\265"},
+    {"nsime;", "\342\211\204"},
+    {"boxvr;", "\342\224\234"},
+    {"acE;", "\342\210\276\314\263"},
+    {"hyphen;", "\342\200\220"},
+    {"seswar;", "\342\244\251"},
+    {"nLeftarrow;", "\342\207\215"},
+    {"lEg;", "\342\252\213"},
+    {"ulcorner;", "\342\214\234"},
+    {"tstrok;", "\305\247"},
+    {"cire;", "\342\211\227"},
+    {"bkarow;", "\342\244\215"},
+    {"bemptyv;", "\342\246\260"},
+    {"cupbrcap;", "\342\251\210"},
+    {"Hstrok;", "\304\246"},
+    {"iecy;", "\320\265"},
+    {"GT", ">"},
+    {"larrlp;", "\342\206\253"},
+    {"jcy;", "\320\271"},
+    {"sccue;", "\342\211\275"},
+    {"vellip;", "\342\213\256"},
+    {"divideontimes;", "\342\213\207"},
+    {"squ;", "\342\226\241"},
+    {"Edot;", "\304\226"},
+    {"scy;", "\321\201"},
+    {"dotsquare;", "\342\212\241"},
+    {"wedbar;", "\342\251\237"},
+    {"NotLeftTriangleBar;", "\342\247\217\314\270"},
+    {"toea;", "\342\244\250"},
+    {"not", "\302\254"},
+    {"subedot;", "\342\253\203"},
+    {"scaron;", "\305\241"},
+    {"cong;", "\342\211\205"},
+    {"thksim;", "\342\210\274"},
+    {"Scirc;", "\305\234"},
+    {"egrave", "\303\250"},
+    {"suphsub;", "\342\253\227"},
+    {"subsub;", "\342\253\225"},
+    {"rsqb;", "]"},
+    {"Copf;", "\342\204\202"},
+    {"vprop;", "\342\210\235"},
+    {"NotPrecedes;", "\342\212\200"},
+    {"phi;", "\317\206"},
+    {"RightArrowBar;", "\342\207\245"},
+    {"lesg;", "\342\213\232\357\270\200"},
+    {"nltrie;", "\342\213\254"},
+    {"lcy;", "\320\273"},
+    {"solb;", "\342\247\204"},
+    {"Acy;", "\320\220"},
+    {"capcup;", "\342\251\207"},
+    {"sqsupset;", "\342\212\220"},
+    {"emptyv;", "\342\210\205"},
+    {"isinv;", "\342\210\210"},
+    {"orarr;", "\342\206\273"},
+    {"Epsilon;", "\316\225"},
+    {"supmult;", "\342\253\202"},
+    {"succ;", "\342\211\273"},
+    {"ShortLeftArrow;", "\342\206\220"},
+    {"NotSubsetEqual;", "\342\212\210"},
+    {"NotEqualTilde;", "\342\211\202\314\270"},
+    {"RightFloor;", "\342\214\213"},
+    {"nscr;", "\360\235\223\203"},
+    {"excl;", "!"},
+    {"brvbar", "\302\246"},
+    {"CloseCurlyDoubleQuote;", "\342\200\235"},
+    {"tshcy;", "\321\233"},
+    {"Topf;", "\360\235\225\213"},
+    {"boxVl;", "\342\225\242"},
+    {"glE;", "\342\252\222"},
+    {"RightTriangleEqual;", "\342\212\265"},
+    {"tcaron;", "\305\245"},
+    {"pr;", "\342\211\272"},
+    {"LeftUpDownVector;", "\342\245\221"},
+    {"flat;", "\342\231\255"},
+    {"loplus;", "\342\250\255"},
+    {"zscr;", "\360\235\223\217"},
+    {"szlig;", "\303\237"},
+    {"verbar;", "|"},
+    {"DownArrowUpArrow;", "\342\207\265"},
+    {"HilbertSpace;", "\342\204\213"},
+    {"DiacriticalGrave;", "`"},
+    {"nequiv;", "\342\211\242"},
+    {"succneqq;", "\342\252\266"},
+    {"Darr;", "\342\206\241"},
+    {"ntrianglelefteq;", "\342\213\254"},
+    {"boxvH;", "\342\225\252"},
+    {"boxVR;", "\342\225\240"},
+    {"Ccedil", "\303\207"},
+    {"dscr;", "\360\235\222\271"},
+    {"capdot;", "\342\251\200"},
+    {"prurel;", "\342\212\260"},
+    {"nspar;", "\342\210\246"},
+    {"OpenCurlyQuote;", "\342\200\230"},
+    {"Rsh;", "\342\206\261"},
+    {"eparsl;", "\342\247\243"},
+    {"THORN;", "\303\236"},
+    {"rdldhar;", "\342\245\251"},
+    {"siml;", "\342\252\235"},
+    {"subdot;", "\342\252\275"},
+    {"bsim;", "\342\210\275"},
+    {"gt", ">"},
+    {"lowast;", "\342\210\227"},
+    {"supsup;", "\342\253\226"},
+    {"prec;", "\342\211\272"},
+    {"sqsubseteq;", "\342\212\221"},
+    {"in;", "\342\210\210"},
+    {"LessSlantEqual;", "\342\251\275"},
+    {"nvinfin;", "\342\247\236"},
+    {"Icirc;", "\303\216"},
+    {"uml;", "\302\250"},
+    {"psi;", "\317\210"},
+    {"Popf;", "\342\204\231"},
+    {"larrpl;", "\342\244\271"},
+    {"Ocirc", "\303\224"},
+    {"bot;", "\342\212\245"},
+    {"lsim;", "\342\211\262"},
+    {"Igrave;", "\303\214"},
+    {"ZeroWidthSpace;", "\342\200\213"},
+    {"aacute;", "\303\241"},
+    {"frac12", "\302\275"},
+    {"swarrow;", "\342\206\231"},
+    {"Tstrok;", "\305\246"},
+    {"dash;", "\342\200\220"},
+    {"NotSucceeds;", "\342\212\201"},
+    {"simgE;", "\342\252\240"},
+    {"integers;", "\342\204\244"},
+    {"tau;", "\317\204"},
+    {"Mcy;", "\320\234"},
+    {"euml;", "\303\253"},
+    {"oint;", "\342\210\256"},
+    {"Cap;", "\342\213\222"},
+    {"lbrack;", "["},
+    {"simne;", "\342\211\206"},
+    {"rtriltri;", "\342\247\216"},
+    {"ssetmn;", "\342\210\226"},
+    {"vscr;", "\360\235\223\213"},
+    {"grave;", "`"},
+    {"gneq;", "\342\252\210"},
+    {"Rho;", "\316\241"},
+    {"lates;", "\342\252\255\357\270\200"},
+    {"sfrown;", "\342\214\242"},
+    {"Nscr;", "\360\235\222\251"},
+    {"NotLessEqual;", "\342\211\260"},
+    {"LeftVectorBar;", "\342\245\222"},
+    {"lescc;", "\342\252\250"},
+    {"phmmat;", "\342\204\263"},
+    {"homtht;", "\342\210\273"},
+    {"lltri;", "\342\227\272"},
+    {"uArr;", "\342\207\221"},
+    {"barvee;", "\342\212\275"},
+    {"lnE;", "\342\211\250"},
+    {"pfr;", "\360\235\224\255"},
+    {"VerticalBar;", "\342\210\243"},
+    {"ngt;", "\342\211\257"},
+    {"angrtvbd;", "\342\246\235"},
+    {"Rrightarrow;", "\342\207\233"},
+    {"AElig", "\303\206"},
+    {"gtlPar;", "\342\246\225"},
+    {"div;", "\303\267"},
+    {"NegativeThickSpace;", "\342\200\213"},
+    {"uplus;", "\342\212\216"},
+    {"diamond;", "\342\213\204"},
+    {"egs;", "\342\252\226"},
+    {"vArr;", "\342\207\225"},
+    {"djcy;", "\321\222"},
+    {"circledR;", "\302\256"},
+    {"dArr;", "\342\207\223"},
+    {"uacute;", "\303\272"},
+    {"weierp;", "\342\204\230"},
+    {"UpTeeArrow;", "\342\206\245"},
+    {"TScy;", "\320\246"},
+    {"Cedilla;", "\302\270"},
+    {"phiv;", "\317\225"},
+    {"boxhU;", "\342\225\250"},
+    {"vsupnE;", "\342\253\214\357\270\200"},
+    {"varr;", "\342\206\225"},
+    {"multimap;", "\342\212\270"},
+    {"lpar;", "("},
+    {"nsup;", "\342\212\205"},
+    {"ofr;", "\360\235\224\254"},
+    {"bne;", "=\342\203\245"},
+    {"copy;", "\302\251"},
+    {"Cup;", "\342\213\223"},
+    {"RightUpVector;", "\342\206\276"},
+    {"bigsqcup;", "\342\250\206"},
+    {"rAtail;", "\342\244\234"},
+    {"profalar;", "\342\214\256"},
+    {"lharul;", "\342\245\252"},
+    {"bscr;", "\360\235\222\267"},
+    {"SupersetEqual;", "\342\212\207"},
+    {"dotminus;", "\342\210\270"},
+    {"csup;", "\342\253\220"},
+    {"ThinSpace;", "\342\200\211"},
+    {"swArr;", "\342\207\231"},
+    {"ShortUpArrow;", "\342\206\221"},
+    {"late;", "\342\252\255"},
+    {"Zcaron;", "\305\275"},
+    {"andd;", "\342\251\234"},
+    {"GreaterEqual;", "\342\211\245"},
+    {"eqslantless;", "\342\252\225"},
+    {"apE;", "\342\251\260"},
+    {"yucy;", "\321\216"},
+    {"Xfr;", "\360\235\224\233"},
+    {"eng;", "\305\213"},
+    {"bfr;", "\360\235\224\237"},
+    {"DoubleLongLeftRightArrow;", "\342\237\272"},
+    {"lopar;", "\342\246\205"},
+    {"equals;", "="},
+    {"oline;", "\342\200\276"},
+    {"boxVr;", "\342\225\237"},
+    {"fopf;", "\360\235\225\227"},
+    {"gescc;", "\342\252\251"},
+    {"boxVL;", "\342\225\243"},
+    {"or;", "\342\210\250"},
+    {"Ograve", "\303\222"},
+    {"micro", "\302\265"},
+    {"xlarr;", "\342\237\265"},
+    {"npart;", "\342\210\202\314\270"},
+    {"els;", "\342\252\225"},
+    {"Vcy;", "\320\222"},
+    {"xnis;", "\342\213\273"},
+    {"hookrightarrow;", "\342\206\252"},
+    {"Lt;", "\342\211\252"},
+    {"nbump;", "\342\211\216\314\270"},
+    {"mp;", "\342\210\223"},
+    {"RightDownTeeVector;", "\342\245\235"},
+    {"sum;", "\342\210\221"},
+    {"rcub;", "}"},
+    {"varepsilon;", "\317\265"},
+    {"hercon;", "\342\212\271"},
+    {"thicksim;", "\342\210\274"},
+    {"lcub;", "{"},
+    {"middot", "\302\267"},
+    {"Utilde;", "\305\250"},
+    {"Wfr;", "\360\235\224\232"},
+    {"colone;", "\342\211\224"},
+    {"wp;", "\342\204\230"},
+    {"iprod;", "\342\250\274"},
+    {"nsubset;", "\342\212\202\342\203\222"},
+    {"boxVH;", "\342\225\254"},
+    {"DownLeftVectorBar;", "\342\245\226"},
+    {"bbrktbrk;", "\342\216\266"},
+    {"subsup;", "\342\253\223"},
+    {"trisb;", "\342\247\215"},
+    {"lesges;", "\342\252\223"},
+    {"bigcirc;", "\342\227\257"},
+    {"nsqsupe;", "\342\213\243"},
+    {"exist;", "\342\210\203"},
+    {"LeftRightVector;", "\342\245\216"},
+    {"NotGreaterEqual;", "\342\211\261"},
+    {"ncong;", "\342\211\207"},
+    {"Breve;", "\313\230"},
+    {"seArr;", "\342\207\230"},
+    {"NotElement;", "\342\210\211"},
+    {"Theta;", "\316\230"},
+    {"Square;", "\342\226\241"},
+    {"Lstrok;", "\305\201"},
+    {"rightharpoonup;", "\342\207\200"},
+    {"nabla;", "\342\210\207"},
+    {"rmoust;", "\342\216\261"},
+    {"Mellintrf;", "\342\204\263"},
+    {"DoubleLeftRightArrow;", "\342\207\224"},
+    {"VerticalLine;", "|"},
+    {"boxvR;", "\342\225\236"},
+    {"PlusMinus;", "\302\261"},
+    {"egrave;", "\303\250"},
+    {"notinva;", "\342\210\211"},
+    {"boxminus;", "\342\212\237"},
+    {"thorn;", "\303\276"},
+    {"LeftTriangleBar;", "\342\247\217"},
+    {"sect", "\302\247"},
+    {"zwnj;", "\342\200\214"},
+    {"timesb;", "\342\212\240"},
+    {"Zacute;", "\305\271"},
+    {"cir;", "\342\227\213"},
+    {"ic;", "\342\201\243"},
+    {"NotSucceedsTilde;", "\342\211\277\314\270"},
+    {"boxHu;", "\342\225\247"},
+    {"sscr;", "\360\235\223\210"},
+    {"not;", "\302\254"},
+    {"simrarr;", "\342\245\262"},
+    {"DoubleLongLeftArrow;", "\342\237\270"},
+    {"ulcrop;", "\342\214\217"},
+    {"scE;", "\342\252\264"},
+    {"Qfr;", "\360\235\224\224"},
+    {"VDash;", "\342\212\253"},
+    {"umacr;", "\305\253"},
+    {"models;", "\342\212\247"},
+    {"yuml;", "\303\277"},
+    {"delta;", "\316\264"},
+    {"uuml;", "\303\274"},
+    {"gesdotol;", "\342\252\204"},
+    {"MinusPlus;", "\342\210\223"},
+    {"fnof;", "\306\222"},
+    {"dfr;", "\360\235\224\241"},
+    {"capcap;", "\342\251\213"},
+    {"Upsi;", "\317\222"},
+    {"DownArrowBar;", "\342\244\223"},
+    {"reals;", "\342\204\235"},
+    {"quot;", "\042"},
+    {"Sup;", "\342\213\221"},
+    {"npar;", "\342\210\246"},
+    {"CircleDot;", "\342\212\231"},
+    {"rcy;", "\321\200"},
+    {"frac18;", "\342\205\233"},
+    {"scsim;", "\342\211\277"},
+    {"oacute;", "\303\263"},
+    {"origof;", "\342\212\266"},
+    {"nesim;", "\342\211\202\314\270"},
+    {"Ouml;", "\303\226"},
+    {"upharpoonright;", "\342\206\276"},
+    {"rarrtl;", "\342\206\243"},
+    {"CHcy;", "\320\247"},
+    {"rightleftarrows;", "\342\207\204"},
+    {"ucirc;", "\303\273"},
+    {"napid;", "\342\211\213\314\270"},
+    {"sopf;", "\360\235\225\244"},
+    {"cedil", "\302\270"},
+    {"angrtvb;", "\342\212\276"},
+    {"sdotb;", "\342\212\241"},
+    {"ordm", "\302\272"},
+    {"LessFullEqual;", "\342\211\246"},
+    {"ratio;", "\342\210\266"},
+    {"lrtri;", "\342\212\277"},
+    {"RuleDelayed;", "\342\247\264"},
+    {"NotTildeFullEqual;", "\342\211\207"},
+    {"shcy;", "\321\210"},
+    {"zeta;", "\316\266"},
+    {"macr", "\302\257"},
+    {"dwangle;", "\342\246\246"},
+    {"ohbar;", "\342\246\265"},
+    {"nsce;", "\342\252\260\314\270"},
+    {"uogon;", "\305\263"},
+    {"smtes;", "\342\252\254\357\270\200"},
+    {"IEcy;", "\320\225"},
+    {"Dscr;", "\360\235\222\237"},
+    {"race;", "\342\210\275\314\261"},
+    {"angmsdae;", "\342\246\254"},
+    {"fpartint;", "\342\250\215"},
+    {"Integral;", "\342\210\253"},
+    {"sigmaf;", "\317\202"},
+    {"boxDR;", "\342\225\224"},
+    {"bowtie;", "\342\213\210"},
+    {"eqslantgtr;", "\342\252\226"},
+    {"ncup;", "\342\251\202"},
+    {"NotSupersetEqual;", "\342\212\211"},
+    {"iocy;", "\321\221"},
+    {"leftharpoonup;", "\342\206\274"},
+    {"Aring", "\303\205"},
+    {"centerdot;", "\302\267"},
+    {"sharp;", "\342\231\257"},
+    {"kcedil;", "\304\267"},
+    {"RightTriangleBar;", "\342\247\220"},
+    {"boxul;", "\342\224\230"},
+    {"curvearrowright;", "\342\206\267"},
+    {"oror;", "\342\251\226"},
+    {"osol;", "\342\212\230"},
+    {"coprod;", "\342\210\220"},
+    {"Rcedil;", "\305\226"},
+    {"hybull;", "\342\201\203"},
+    {"Gopf;", "\360\235\224\276"},
+    {"sstarf;", "\342\213\206"},
+    {"NotPrecedesSlantEqual;", "\342\213\240"},
+    {"nless;", "\342\211\256"},
+    {"tscy;", "\321\206"},
+    {"iexcl;", "\302\241"},
+    {"trade;", "\342\204\242"},
+    {"gla;", "\342\252\245"},
+    {"Rcy;", "\320\240"},
+    {"auml", "\303\244"},
+    {"reg", "\302\256"},
+    {"Wopf;", "\360\235\225\216"},
+    {"NotHumpDownHump;", "\342\211\216\314\270"},
+    {"npolint;", "\342\250\224"},
+    {"ubrcy;", "\321\236"},
+    {"isins;", "\342\213\264"},
+    {"natural;", "\342\231\256"},
+    {"nges;", "\342\251\276\314\270"},
+    {"prod;", "\342\210\217"},
+    {"OverBar;", "\342\200\276"},
+    {"Escr;", "\342\204\260"},
+    {"DownRightVectorBar;", "\342\245\227"},
+    {"Amacr;", "\304\200"},
+    {"LeftTee;", "\342\212\243"},
+    {"exponentiale;", "\342\205\207"},
+    {"equivDD;", "\342\251\270"},
+    {"hfr;", "\360\235\224\245"},
+    {"Ugrave", "\303\231"},
+    {"Or;", "\342\251\224"},
+    {"MediumSpace;", "\342\201\237"},
+    {"DownLeftVector;", "\342\206\275"},
+    {"Bcy;", "\320\221"},
+    {"DZcy;", "\320\217"},
+    {"succnsim;", "\342\213\251"},
+    {"hbar;", "\342\204\217"},
+    {"RightArrow;", "\342\206\222"},
+    {"ccirc;", "\304\211"},
+    {"ljcy;", "\321\231"},
+    {"cfr;", "\360\235\224\240"},
+    {"supdsub;", "\342\253\230"},
+    {"NestedGreaterGreater;", "\342\211\253"},
+    {"LongLeftRightArrow;", "\342\237\267"},
+    {"boxtimes;", "\342\212\240"},
+    {"sce;", "\342\252\260"},
+    {"copy", "\302\251"},
+    {"ldquo;", "\342\200\234"},
+    {"omacr;", "\305\215"},
+    {"orslope;", "\342\251\227"},
+    {"mlcp;", "\342\253\233"},
+    {"boxvL;", "\342\225\241"},
+    {"ifr;", "\360\235\224\246"},
+    {"dbkarow;", "\342\244\217"},
+    {"rtimes;", "\342\213\212"},
+    {"hstrok;", "\304\247"},
+    {"Ifr;", "\342\204\221"},
+    {"Laplacetrf;", "\342\204\222"},
+    {"sup1", "\302\271"},
+    {"Uuml;", "\303\234"},
+    {"lbbrk;", "\342\235\262"},
+    {"erDot;", "\342\211\223"},
+    {"boxdl;", "\342\224\220"},
+    {"lbrace;", "{"},
+    {"circeq;", "\342\211\227"},
+    {"operp;", "\342\246\271"},
+    {"ETH", "\303\220"},
+    {"iiint;", "\342\210\255"},
+    {"Cross;", "\342\250\257"},
+    {"laemptyv;", "\342\246\264"},
+    {"vzigzag;", "\342\246\232"},
+    {"gt;", ">"},
+    {"lmidot;", "\305\200"},
+    {"Fopf;", "\360\235\224\275"},
+    {"Otimes;", "\342\250\267"},
+    {"nparallel;", "\342\210\246"},
+    {"hardcy;", "\321\212"},
+    {"Hscr;", "\342\204\213"},
+    {"gtrapprox;", "\342\252\206"},
+    {"prnE;", "\342\252\265"},
+    {"Vvdash;", "\342\212\252"},
+    {"subseteq;", "\342\212\206"},
+    {"nearr;", "\342\206\227"},
+    {"ubreve;", "\305\255"},
+    {"trianglerighteq;", "\342\212\265"},
+    {"isinE;", "\342\213\271"},
+    {"Dot;", "\302\250"},
+    {"Iogon;", "\304\256"},
+    {"dlcorn;", "\342\214\236"},
+    {"sacute;", "\305\233"},
+    {"ntilde", "\303\261"},
+    {"lozenge;", "\342\227\212"},
+    {"Icirc", "\303\216"},
+    {"OverBrace;", "\342\217\236"},
+    {"Igrave", "\303\214"},
+    {"roplus;", "\342\250\256"},
+    {"uHar;", "\342\245\243"},
+    {"Ycy;", "\320\253"},
+    {"PartialD;", "\342\210\202"},
+    {"dot;", "\313\231"},
+    {"loarr;", "\342\207\275"},
+    {"intprod;", "\342\250\274"},
+    {"mcy;", "\320\274"},
+    {"period;", "."},
+    {"DoubleDot;", "\302\250"},
+    {"lneq;", "\342\252\207"},
+    {"roang;", "\342\237\255"},
+    {"hoarr;", "\342\207\277"},
+    {"Tscr;", "\360\235\222\257"},
+    {"searrow;", "\342\206\230"},
+    {"barwed;", "\342\214\205"},
+    {"nlt;", "\342\211\256"},
+    {"NotGreaterTilde;", "\342\211\265"},
+    {"nvsim;", "\342\210\274\342\203\222"},
+    {"bigcup;", "\342\213\203"},
+    {"ogt;", "\342\247\201"},
+    {"lparlt;", "\342\246\223"},
+    {"half;", "\302\275"},
+    {"ltcir;", "\342\251\271"},
+    {"ii;", "\342\205\210"},
+    {"Pr;", "\342\252\273"},
+    {"HumpEqual;", "\342\211\217"},
+    {"ofcir;", "\342\246\277"},
+    {"nacute;", "\305\204"},
+    {"euml", "\303\253"},
+    {"vcy;", "\320\262"},
+    {"frac35;", "\342\205\227"},
+    {"varphi;", "\317\225"},
+    {"strns;", "\302\257"},
+    {"spadesuit;", "\342\231\240"},
+    {"supsetneq;", "\342\212\213"},
+    {"FilledSmallSquare;", "\342\227\274"},
+    {"larrfs;", "\342\244\235"},
+    {"looparrowright;", "\342\206\254"},
+    {"gvertneqq;", "\342\211\251\357\270\200"},
+    {"IJlig;", "\304\262"},
+    {"xutri;", "\342\226\263"},
+    {"odblac;", "\305\221"},
+    {"DDotrahd;", "\342\244\221"},
+    {"opar;", "\342\246\267"},
+    {"UpperLeftArrow;", "\342\206\226"},
+    {"female;", "\342\231\200"},
+    {"notinvb;", "\342\213\267"},
+    {"iiota;", "\342\204\251"},
+    {"nwarr;", "\342\206\226"},
+    {"precnapprox;", "\342\252\271"},
+    {"breve;", "\313\230"},
+    {"efr;", "\360\235\224\242"},
+    {"iota;", "\316\271"},
+    {"ycy;", "\321\213"},
+    {"Ccirc;", "\304\210"},
+    {"nrtri;", "\342\213\253"},
+    {"icirc", "\303\256"},
+    {"LT", "<"},
+    {"nang;", "\342\210\240\342\203\222"},
+    {"dfisht;", "\342\245\277"},
+    {"qint;", "\342\250\214"},
+    {"Gbreve;", "\304\236"},
+    {"sqsupe;", "\342\212\222"},
+    {"rarrpl;", "\342\245\205"},
+    {"tbrk;", "\342\216\264"},
+    {"ShortDownArrow;", "\342\206\223"},
+    {"boxDr;", "\342\225\223"},
+    {"RightUpDownVector;", "\342\245\217"},
+    {"lHar;", "\342\245\242"},
+    {"DoubleLeftTee;", "\342\253\244"},
+    {"cups;", "\342\210\252\357\270\200"},
+    {"nwArr;", "\342\207\226"},
+    {"xfr;", "\360\235\224\265"},
+    {"rbrack;", "]"},
+    {"nsccue;", "\342\213\241"},
+    {"dtdot;", "\342\213\261"},
+    {"racute;", "\305\225"},
+    {"Gg;", "\342\213\231"},
+    {"vBar;", "\342\253\250"},
+    {"Gt;", "\342\211\253"},
+    {"uwangle;", "\342\246\247"},
+    {"Therefore;", "\342\210\264"},
+    {"cupdot;", "\342\212\215"},
+    {"LowerLeftArrow;", "\342\206\231"},
+    {"ContourIntegral;", "\342\210\256"},
+    {"RBarr;", "\342\244\220"},
+    {"theta;", "\316\270"},
+    {"lap;", "\342\252\205"},
+    {"RightTeeArrow;", "\342\206\246"},
+    {"NotLeftTriangle;", "\342\213\252"},
+    {"Tfr;", "\360\235\224\227"},
+    {"rbrkslu;", "\342\246\220"},
+    {"ncongdot;", "\342\251\255\314\270"},
+    {"horbar;", "\342\200\225"},
+    {"ufisht;", "\342\245\276"},
+    {"bopf;", "\360\235\225\223"},
+    {"lnapprox;", "\342\252\211"},
+    {"nearhk;", "\342\244\244"},
+    {"cylcty;", "\342\214\255"},
+    {"scirc;", "\305\235"},
+    {"it;", "\342\201\242"},
+    {"emsp14;", "\342\200\205"},
+    {"triangleq;", "\342\211\234"},
+    {"downharpoonleft;", "\342\207\203"},
+    {"ntilde;", "\303\261"},
+    {"Yfr;", "\360\235\224\234"},
+    {"rBarr;", "\342\244\217"},
+    {"lBarr;", "\342\244\216"},
+    {"there4;", "\342\210\264"},
+    {"RightUpTeeVector;", "\342\245\234"},
+    {"varnothing;", "\342\210\205"},
+    {"supseteq;", "\342\212\207"},
+    {"UpArrowDownArrow;", "\342\207\205"},
+    {"NotSquareSubset;", "\342\212\217\314\270"},
+    {"hellip;", "\342\200\246"},
+    {"lmoustache;", "\342\216\260"},
+    {"Nacute;", "\305\203"},
+    {"UpDownArrow;", "\342\206\225"},
+    {"ThickSpace;", "\342\201\237\342\200\212"},
+    {"DownLeftRightVector;", "\342\245\220"},
+    {"dd;", "\342\205\206"},
+    {"edot;", "\304\227"},
+    {"cirscir;", "\342\247\202"},
+    {"lvertneqq;", "\342\211\250\357\270\200"},
+    {"Tau;", "\316\244"},
+    {"ExponentialE;", "\342\205\207"},
+    {"afr;", "\360\235\224\236"},
+    {"Bernoullis;", "\342\204\254"},
+    {"quest;", "\077"},
+    {"aring", "\303\245"},
+    {"NotGreaterFullEqual;", "\342\211\247\314\270"},
+    {"sqsub;", "\342\212\217"},
+    {"triangleleft;", "\342\227\203"},
+    {"ETH;", "\303\220"},
+    {"ijlig;", "\304\263"},
+    {"hksearow;", "\342\244\245"},
+    {"nwarrow;", "\342\206\226"},
+    {"lozf;", "\342\247\253"},
+    {"Iuml", "\303\217"},
+    {"Ugrave;", "\303\231"},
+    {"block;", "\342\226\210"},
+    {"les;", "\342\251\275"},
+    {"rightsquigarrow;", "\342\206\235"},
+    {"atilde;", "\303\243"},
+    {"LeftVector;", "\342\206\274"},
+    {"ltrie;", "\342\212\264"},
+    {"Iuml;", "\303\217"},
+    {"lambda;", "\316\273"},
+    {"nleq;", "\342\211\260"},
+    {"oelig;", "\305\223"},
+    {"ForAll;", "\342\210\200"},
+    {"Lopf;", "\360\235\225\203"},
+    {"InvisibleTimes;", "\342\201\242"},
+    {"leftharpoondown;", "\342\206\275"},
+    {"PrecedesEqual;", "\342\252\257"},
+    {"cirmid;", "\342\253\257"},
+    {"Pscr;", "\360\235\222\253"},
+    {"LeftDoubleBracket;", "\342\237\246"},
+    {"RightTriangle;", "\342\212\263"},
+    {"NotLessLess;", "\342\211\252\314\270"},
+    {"ggg;", "\342\213\231"},
+    {"SubsetEqual;", "\342\212\206"},
+    {"lE;", "\342\211\246"},
+    {"DoubleLeftArrow;", "\342\207\220"},
+    {"num;", "#"},
+    {"szlig", "\303\237"},
+    {"supseteqq;", "\342\253\206"},
+    {"blacktriangledown;", "\342\226\276"},
+    {"NotLeftTriangleEqual;", "\342\213\254"},
+    {"NonBreakingSpace;", "\302\240"},
+    {"nvltrie;", "\342\212\264\342\203\222"},
+    {"ouml;", "\303\266"},
+    {"rsquor;", "\342\200\231"},
+    {"boxHD;", "\342\225\246"},
+    {"nfr;", "\360\235\224\253"},
+    {"real;", "\342\204\234"},
+    {"ufr;", "\360\235\224\262"},
+    {"oplus;", "\342\212\225"},
+    {"gEl;", "\342\252\214"},
+    {"Dstrok;", "\304\220"},
+    {"SOFTcy;", "\320\254"},
+    {"Kscr;", "\360\235\222\246"},
+    {"ddotseq;", "\342\251\267"},
+    {"lt", "<"},
+    {"boxhu;", "\342\224\264"},
+    {"nvHarr;", "\342\244\204"},
+    {"thkap;", "\342\211\210"},
+    {"vartheta;", "\317\221"},
+    {"ltdot;", "\342\213\226"},
+    {"yen", "\302\245"},
+    {"rthree;", "\342\213\214"},
+    {"lcaron;", "\304\276"},
+    {"Ycirc;", "\305\266"},
+    {"abreve;", "\304\203"},
+    {"ccaps;", "\342\251\215"},
+    {"NotGreaterSlantEqual;", "\342\251\276\314\270"},
+    {"Hat;", "^"},
+    {"Lcy;", "\320\233"},
+    {"parsim;", "\342\253\263"},
+    {"curlyeqsucc;", "\342\213\237"},
+    {"iacute", "\303\255"},
+    {"simdot;", "\342\251\252"},
+    {"frac14", "\302\274"},
+    {"smallsetminus;", "\342\210\226"},
+    {"gesl;", "\342\213\233\357\270\200"},
+    {"lobrk;", "\342\237\246"},
+    {"LeftTriangleEqual;", "\342\212\264"},
+    {"supE;", "\342\253\206"},
+    {"lsime;", "\342\252\215"},
+    {"nsim;", "\342\211\201"},
+    {"LeftArrowRightArrow;", "\342\207\206"},
+    {"yacute", "\303\275"},
+    {"Proportion;", "\342\210\267"},
+    {"EqualTilde;", "\342\211\202"},
+    {"iff;", "\342\207\224"},
+    {"ffilig;", "\357\254\203"},
+    {"rightarrow;", "\342\206\222"},
+    {"tscr;", "\360\235\223\211"},
+    {"Vopf;", "\360\235\225\215"},
+    {"boxhd;", "\342\224\254"},
+    {"yfr;", "\360\235\224\266"},
+    {"NotSucceedsEqual;", "\342\252\260\314\270"},
+    {"ll;", "\342\211\252"},
+    {"AElig;", "\303\206"},
+    {"luruhar;", "\342\245\246"},
+    {"DoubleContourIntegral;", "\342\210\257"},
+    {"hookleftarrow;", "\342\206\251"},
+    {"quot", "\042"},
+    {"Wscr;", "\360\235\222\262"},
+    {"aogon;", "\304\205"},
+    {"Fscr;", "\342\204\261"},
+    {"Barv;", "\342\253\247"},
+    {"dsol;", "\342\247\266"},
+    {"gtcir;", "\342\251\272"},
+    {"Sscr;", "\360\235\222\256"},
+    {"quatint;", "\342\250\226"},
+    {"ring;", "\313\232"},
+    {"LessTilde;", "\342\211\262"},
+    {"VerticalTilde;", "\342\211\200"},
+    {"boxHd;", "\342\225\244"},
+    {"frown;", "\342\214\242"},
+    {"barwedge;", "\342\214\205"},
+    {"congdot;", "\342\251\255"},
+    {"pitchfork;", "\342\213\224"},
+    {"Dashv;", "\342\253\244"},
+    {"ouml", "\303\266"},
+    {"heartsuit;", "\342\231\245"},
+    {"DoubleUpDownArrow;", "\342\207\225"},
+    {"rceil;", "\342\214\211"},
+    {"Uopf;", "\360\235\225\214"},
+    {"angmsd;", "\342\210\241"},
+    {"And;", "\342\251\223"},
+    {"nRightarrow;", "\342\207\217"},
+    {"Precedes;", "\342\211\272"},
+    {"intlarhk;", "\342\250\227"},
+    {"rotimes;", "\342\250\265"},
+    {"Bscr;", "\342\204\254"},
+    {"DoubleRightTee;", "\342\212\250"},
+    {"CircleTimes;", "\342\212\227"},
+    {"EmptyVerySmallSquare;", "\342\226\253"},
+    {"Ouml", "\303\226"},
+    {"NotRightTriangleEqual;", "\342\213\255"},
+    {"SucceedsEqual;", "\342\252\260"},
+    {"Iota;", "\316\231"},
+    {"nlE;", "\342\211\246\314\270"},
+    {"utrif;", "\342\226\264"},
+    {"OverBracket;", "\342\216\264"},
+    {"nmid;", "\342\210\244"},
+    {"caron;", "\313\207"},
+    {"ugrave", "\303\271"},
+    {"NotRightTriangle;", "\342\213\253"},
+    {"NotHumpEqual;", "\342\211\217\314\270"},
+    {"oscr;", "\342\204\264"},
+    {"tdot;", "\342\203\233"},
+    {"bcy;", "\320\261"},
+    {"Rfr;", "\342\204\234"},
+    {"nvge;", "\342\211\245\342\203\222"},
+    {"circleddash;", "\342\212\235"},
+    {"straightepsilon;", "\317\265"},
+    {"zeetrf;", "\342\204\250"},
+    {"rscr;", "\360\235\223\207"},
+    {"nsubseteqq;", "\342\253\205\314\270"},
+    {"boxplus;", "\342\212\236"},
+    {"Ecy;", "\320\255"},
+    {"Downarrow;", "\342\207\223"},
+    {"Jscr;", "\360\235\222\245"},
+    {"angst;", "\303\205"},
+    {"Dcy;", "\320\224"},
+    {"ntriangleleft;", "\342\213\252"},
+    {"lessapprox;", "\342\252\205"},
+    {"RightAngleBracket;", "\342\237\251"},
+    {"gtrdot;", "\342\213\227"},
+    {"simg;", "\342\252\236"},
+    {"drcorn;", "\342\214\237"},
+    {"simlE;", "\342\252\237"},
+    {"pointint;", "\342\250\225"},
+    {"lesseqqgtr;", "\342\252\213"},
+    {"rarrw;", "\342\206\235"},
+    {"coloneq;", "\342\211\224"},
+    {"rcaron;", "\305\231"},
+    {"succeq;", "\342\252\260"},
+    {"minusd;", "\342\210\270"},
+    {"lbrksld;", "\342\246\217"},
+    {"curarr;", "\342\206\267"},
+    {"csub;", "\342\253\217"},
+    {"plus;", "+"},
+    {"Gdot;", "\304\240"},
+    {"lesssim;", "\342\211\262"},
+    {"nsupseteqq;", "\342\253\206\314\270"},
+    {"ntrianglerighteq;", "\342\213\255"},
+    {"curlywedge;", "\342\213\217"},
+    {"LessEqualGreater;", "\342\213\232"},
+    {"gimel;", "\342\204\267"},
+    {"bsime;", "\342\213\215"},
+    {"Dagger;", "\342\200\241"},
+    {"ngsim;", "\342\211\265"},
+    {"KJcy;", "\320\214"},
+    {"ltri;", "\342\227\203"},
+    {"UnderBrace;", "\342\217\237"},
+    {"PrecedesSlantEqual;", "\342\211\274"},
+    {"Mopf;", "\360\235\225\204"},
+    {"pound;", "\302\243"},
+    {"mscr;", "\360\235\223\202"},
+    {"Atilde;", "\303\203"},
+    {"gnsim;", "\342\213\247"},
+    {"lrhard;", "\342\245\255"},
+    {"gscr;", "\342\204\212"},
+    {"hArr;", "\342\207\224"},
+    {"precsim;", "\342\211\276"},
+    {"questeq;", "\342\211\237"},
+    {"xcup;", "\342\213\203"},
+    {"Sqrt;", "\342\210\232"},
+    {"nrtrie;", "\342\213\255"},
+    {"rarrc;", "\342\244\263"},
+    {"Ntilde;", "\303\221"},
+    {"eg;", "\342\252\232"},
+    {"angmsdah;", "\342\246\257"},
+    {"order;", "\342\204\264"},
+    {"lhard;", "\342\206\275"},
+    {"Nopf;", "\342\204\225"},
+    {"ell;", "\342\204\223"},
+    {"napos;", "\305\211"},
+    {"ecirc", "\303\252"},
+    {"rdquor;", "\342\200\235"},
+    {"cirE;", "\342\247\203"},
+    {"Colone;", "\342\251\264"},
+    {"daleth;", "\342\204\270"},
+    {"nlArr;", "\342\207\215"},
+    {"lbrkslu;", "\342\246\215"},
+    {"bernou;", "\342\204\254"},
+    {"NotRightTriangleBar;", "\342\247\220\314\270"},
+    {"diam;", "\342\213\204"},
+    {"Lleftarrow;", "\342\207\232"},
+    {"ucy;", "\321\203"},
+    {"nrightarrow;", "\342\206\233"},
+    {"bottom;", "\342\212\245"},
+    {"acirc", "\303\242"},
+    {"cularrp;", "\342\244\275"},
+    {"Cacute;", "\304\206"},
+    {"Wedge;", "\342\213\200"},
+    {"AMP;", "&"},
+    {"preccurlyeq;", "\342\211\274"},
+    {"para", "\302\266"},
+    {"UpperRightArrow;", "\342\206\227"},
+    {"Oacute;", "\303\223"},
+    {"sbquo;", "\342\200\232"},
+    {"scnap;", "\342\252\272"},
+    {"Lfr;", "\360\235\224\217"},
+    {"DownLeftTeeVector;", "\342\245\236"},
+    {"hkswarow;", "\342\244\246"},
+    {"angzarr;", "\342\215\274"},
+    {"nle;", "\342\211\260"},
+    {"NotTilde;", "\342\211\201"},
+    {"RightUpVectorBar;", "\342\245\224"},
+    {"lurdshar;", "\342\245\212"},
+    {"Eacute;", "\303\211"},
+    {"Zopf;", "\342\204\244"},
+    {"lrarr;", "\342\207\206"},
+    {"Barwed;", "\342\214\206"},
+    {"subsetneqq;", "\342\253\213"},
+    {"rarrhk;", "\342\206\252"},
+    {"sup3", "\302\263"},
+    {"eth", "\303\260"},
+    {"lAarr;", "\342\207\232"},
+    {"Lcaron;", "\304\275"},
+    {"frac45;", "\342\205\230"},
+    {"CloseCurlyQuote;", "\342\200\231"},
+    {"LeftTeeVector;", "\342\245\232"},
+    {"LessGreater;", "\342\211\266"},
+    {"frac15;", "\342\205\225"},
+    {"Rscr;", "\342\204\233"},
+    {"gamma;", "\316\263"},
+    {"realpart;", "\342\204\234"},
+    {"Superset;", "\342\212\203"},
+    {"Uogon;", "\305\262"},
+    {"lang;", "\342\237\250"},
+    {"planckh;", "\342\204\216"},
+    {"nrarr;", "\342\206\233"},
+    {"Sum;", "\342\210\221"},
+    {"Rang;", "\342\237\253"},
+    {"Ccedil;", "\303\207"},
+    {"nLtv;", "\342\211\252\314\270"},
+    {"Kappa;", "\316\232"},
+    {"Gcedil;", "\304\242"},
+    {"lsquor;", "\342\200\232"},
+    {"qfr;", "\360\235\224\256"},
+    {"sqcup;", "\342\212\224"},
+    {"imacr;", "\304\253"},
+    {"iquest;", "\302\277"},
+    {"precneqq;", "\342\252\265"},
+    {"odot;", "\342\212\231"},
+    {"loang;", "\342\237\254"},
+    {"prcue;", "\342\211\274"},
+    {"llcorner;", "\342\214\236"},
+    {"puncsp;", "\342\200\210"},
+    {"phone;", "\342\230\216"},
+    {"angle;", "\342\210\240"},
+    {"Qscr;", "\360\235\222\254"},
+    {"ngeqslant;", "\342\251\276\314\270"},
+    {"rtri;", "\342\226\271"},
+    {"jsercy;", "\321\230"},
+    {"sup;", "\342\212\203"},
+    {"DoubleUpArrow;", "\342\207\221"},
+    {"ltrPar;", "\342\246\226"},
+    {"popf;", "\360\235\225\241"},
+    {"leftrightharpoons;", "\342\207\213"},
+    {"amp", "&"},
+    {"ApplyFunction;", "\342\201\241"},
+    {"Assign;", "\342\211\224"},
+    {"wr;", "\342\211\200"},
+    {"upsi;", "\317\205"},
+    {"boxdR;", "\342\225\222"},
+    {"angmsdad;", "\342\246\253"},
+    {"wedge;", "\342\210\247"},
+    {"Agrave", "\303\200"},
+    {"cuepr;", "\342\213\236"},
+    {"sup2", "\302\262"},
+    {"diamondsuit;", "\342\231\246"},
+    {"SuchThat;", "\342\210\213"},
+    {"Aopf;", "\360\235\224\270"},
+    {"harrw;", "\342\206\255"},
+    {"vopf;", "\360\235\225\247"},
+    {"andv;", "\342\251\232"},
+    {"ucirc", "\303\273"},
+    {"Prime;", "\342\200\263"},
+    {"expectation;", "\342\204\260"},
+    {"niv;", "\342\210\213"},
+    {"langd;", "\342\246\221"},
+    {"Tab;", "\011"},
+    {"scap;", "\342\252\270"},
+    {"demptyv;", "\342\246\261"},
+    {"Otilde", "\303\225"},
+    {"el;", "\342\252\231"},
+    {"Yacute;", "\303\235"},
+    {"wopf;", "\360\235\225\250"},
+    {"isindot;", "\342\213\265"},
+    {"ldrushar;", "\342\245\213"},
+    {"RightDownVectorBar;", "\342\245\225"},
+    {"filig;", "\357\254\201"},
+    {"angsph;", "\342\210\242"},
+    {"varsigma;", "\317\202"},
+    {"Subset;", "\342\213\220"},
+    {"ddarr;", "\342\207\212"},
+    {"Leftrightarrow;", "\342\207\224"},
+    {"gnapprox;", "\342\252\212"},
+    {"shchcy;", "\321\211"},
+    {"updownarrow;", "\342\206\225"},
+    {"Oscr;", "\360\235\222\252"},
+    {"Nu;", "\316\235"},
+    {"Gfr;", "\360\235\224\212"},
+    {"prnap;", "\342\252\271"},
+    {"subplus;", "\342\252\277"},
+    {"Alpha;", "\316\221"},
+    {"telrec;", "\342\214\225"},
+    {"backepsilon;", "\317\266"},
+    {"gtcc;", "\342\252\247"},
+    {"larrtl;", "\342\206\242"},
+    {"boxV;", "\342\225\221"},
+    {"ccedil;", "\303\247"},
+    {"Auml;", "\303\204"},
+    {"ocirc;", "\303\264"},
+    {"checkmark;", "\342\234\223"},
+    {"robrk;", "\342\237\247"},
+    {"uring;", "\305\257"},
+    {"Pfr;", "\360\235\224\223"},
+    {"cap;", "\342\210\251"},
+    {"rmoustache;", "\342\216\261"},
+    {"lfloor;", "\342\214\212"},
+    {"rho;", "\317\201"},
+    {"NotLessGreater;", "\342\211\270"},
+    {"target;", "\342\214\226"},
+    {"NotLess;", "\342\211\256"},
+    {"cudarrl;", "\342\244\270"},
+    {"ncap;", "\342\251\203"},
+    {"ecy;", "\321\215"},
+    {"Oacute", "\303\223"},
+    {"REG;", "\302\256"},
+    {"nhpar;", "\342\253\262"},
+    {"DiacriticalDot;", "\313\231"},
+    {"scnE;", "\342\252\266"},
+    {"nprcue;", "\342\213\240"},
+    {"solbar;", "\342\214\277"},
+    {"SquareIntersection;", "\342\212\223"},
+    {"nGg;", "\342\213\231\314\270"},
+    {"caps;", "\342\210\251\357\270\200"},
+    {"Afr;", "\360\235\224\204"},
+    {"ugrave;", "\303\271"},
+    {"NotGreaterLess;", "\342\211\271"},
+    {"Pcy;", "\320\237"},
+    {"sdot;", "\342\213\205"},
+    {"bigstar;", "\342\230\205"},
+    {"squf;", "\342\226\252"},
+    {"icirc;", "\303\256"},
+    {"kscr;", "\360\235\223\200"},
+    {"raemptyv;", "\342\246\263"},
+    {"iopf;", "\360\235\225\232"},
+    {"wfr;", "\360\235\224\264"},
+    {"nsupe;", "\342\212\211"},
+    {"acy;", "\320\260"},
+    {"supne;", "\342\212\213"},
+    {"SquareSubset;", "\342\212\217"},
+    {"longleftarrow;", "\342\237\265"},
+    {"squarf;", "\342\226\252"},
+    {"zdot;", "\305\274"},
+    {"ccupssm;", "\342\251\220"},
+    {"InvisibleComma;", "\342\201\243"},
+    {"doublebarwedge;", "\342\214\206"},
+    {"xdtri;", "\342\226\275"},
+    {"clubs;", "\342\231\243"},
+    {"angmsdaa;", "\342\246\250"},
+    {"bumpe;", "\342\211\217"},
+    {"pscr;", "\360\235\223\205"},
+    {"nsqsube;", "\342\213\242"},
+    {"otilde;", "\303\265"},
+    {"gvnE;", "\342\211\251\357\270\200"},
+    {"Eta;", "\316\227"},
+    {"Vee;", "\342\213\201"},
+    {"hairsp;", "\342\200\212"},
+    {"nsucceq;", "\342\252\260\314\270"},
+    {"ge;", "\342\211\245"},
+    {"apacir;", "\342\251\257"},
+    {"divide", "\303\267"},
+    {"Esim;", "\342\251\263"},
+    {"Xopf;", "\360\235\225\217"},
+    {"ClockwiseContourIntegral;", "\342\210\262"},
+    {"int;", "\342\210\253"},
+    {"UnderBracket;", "\342\216\265"},
+    {"gtrless;", "\342\211\267"},
+    {"lstrok;", "\305\202"},
+    {"mid;", "\342\210\243"},
+    {"rhov;", "\317\261"},
+    {"rbarr;", "\342\244\215"},
+    {"leftarrow;", "\342\206\220"},
+    {"GreaterGreater;", "\342\252\242"},
+    {"nsupset;", "\342\212\203\342\203\222"},
+    {"precnsim;", "\342\213\250"},
+    {"angmsdab;", "\342\246\251"},
+    {"Ecaron;", "\304\232"},
+    {"NotCupCap;", "\342\211\255"},
+    {"circledast;", "\342\212\233"},
+    {"Sopf;", "\360\235\225\212"},
+    {"chcy;", "\321\207"},
+    {"realine;", "\342\204\233"},
+    {"triangledown;", "\342\226\277"},
+    {"intercal;", "\342\212\272"},
+    {"uharl;", "\342\206\277"},
+    {"ZHcy;", "\320\226"},
+    {"drcrop;", "\342\214\214"},
+    {"bdquo;", "\342\200\236"},
+    {"upsilon;", "\317\205"},
+    {"duarr;", "\342\207\265"},
+    {"subset;", "\342\212\202"},
+    {"gesdot;", "\342\252\200"},
+    {"lrhar;", "\342\207\213"},
+    {"ecir;", "\342\211\226"},
+    {"dagger;", "\342\200\240"},
+    {"Mu;", "\316\234"},
+    {"dzcy;", "\321\237"},
+    {"Equilibrium;", "\342\207\214"},
+    {"NegativeMediumSpace;", "\342\200\213"},
+    {"boxbox;", "\342\247\211"},
+    {"zopf;", "\360\235\225\253"},
+    {"dstrok;", "\304\221"},
+    {"nisd;", "\342\213\272"},
+    {"cuesc;", "\342\213\237"},
+    {"Lcedil;", "\304\273"},
+    {"otimes;", "\342\212\227"},
+    {"bigtriangledown;", "\342\226\275"},
+    {"khcy;", "\321\205"},
+    {"swarhk;", "\342\244\246"},
+    {"uharr;", "\342\206\276"},
+    {"rightarrowtail;", "\342\206\243"},
+    {"plusb;", "\342\212\236"},
+    {"iiiint;", "\342\250\214"},
+    {"rbrksld;", "\342\246\216"},
+    {"vdash;", "\342\212\242"},
+    {"map;", "\342\206\246"},
+    {"kcy;", "\320\272"},
+    {"lsqb;", "["},
+    {"Cscr;", "\360\235\222\236"},
+    {"rsquo;", "\342\200\231"},
+    {"numero;", "\342\204\226"},
+    {"Egrave;", "\303\210"},
+    {"rhard;", "\342\207\201"},
+    {"longrightarrow;", "\342\237\266"},
+    {"NoBreak;", "\342\201\240"},
+    {"asympeq;", "\342\211\215"},
+    {"NotTildeTilde;", "\342\211\211"},
+    {"frac13;", "\342\205\223"},
+    {"VeryThinSpace;", "\342\200\212"},
+    {"Succeeds;", "\342\211\273"},
+    {"Uarrocir;", "\342\245\211"},
+    {"YUcy;", "\320\256"},
+    {"ultri;", "\342\227\270"},
+    {"boxHU;", "\342\225\251"},
+    {"preceq;", "\342\252\257"},
+    {"subrarr;", "\342\245\271"},
+    {"pcy;", "\320\277"},
+    {"Union;", "\342\213\203"},
+    {"wcirc;", "\305\265"},
+    {"tcedil;", "\305\243"},
+    {"upuparrows;", "\342\207\210"},
+    {"uscr;", "\360\235\223\212"},
+    {"Eacute", "\303\211"},
+    {"ges;", "\342\251\276"},
+    {"olarr;", "\342\206\272"},
+    {"doteq;", "\342\211\220"},
+    {"Ccaron;", "\304\214"},
+    {"ee;", "\342\205\207"},
+    {"blank;", "\342\220\243"},
+    {"notniva;", "\342\210\214"},
+    {"NotPrecedesEqual;", "\342\252\257\314\270"},
+    {"rightrightarrows;", "\342\207\211"},
+    {"hamilt;", "\342\204\213"},
+    {"YAcy;", "\320\257"},
+    {"scpolint;", "\342\250\223"},
+    {"nvle;", "\342\211\244\342\203\222"},
+    {"dcy;", "\320\264"},
+    {"plusdu;", "\342\250\245"},
+    {"supnE;", "\342\253\214"},
+    {"gsim;", "\342\211\263"},
+    {"gtrarr;", "\342\245\270"},
+    {"ReverseEquilibrium;", "\342\207\213"},
+    {"gammad;", "\317\235"},
+    {"Auml", "\303\204"},
+    {"nbsp;", "\302\240"},
+    {"nVDash;", "\342\212\257"},
+    {"slarr;", "\342\206\220"},
+    {"sigma;", "\317\203"},
+    {"RightCeiling;", "\342\214\211"},
+    {"nsupE;", "\342\253\206\314\270"},
+    {"ssmile;", "\342\214\243"},
+    {"boxUR;", "\342\225\232"},
+    {"neArr;", "\342\207\227"},
+    {"dtrif;", "\342\226\276"},
+    {"jscr;", "\360\235\222\277"},
+    {"pound", "\302\243"},
+    {"lnsim;", "\342\213\246"},
+    {"circ;", "\313\206"},
+    {"sdote;", "\342\251\246"},
+    {"Vfr;", "\360\235\224\231"},
+    {"circlearrowright;", "\342\206\273"},
+    {"Phi;", "\316\246"},
+    {"lsimg;", "\342\252\217"},
+    {"ohm;", "\316\251"},
+    {"rightleftharpoons;", "\342\207\214"},
+    {"RightVectorBar;", "\342\245\223"},
+    {"upharpoonleft;", "\342\206\277"},
+    {"malt;", "\342\234\240"},
+    {"lat;", "\342\252\253"},
+    {"urcrop;", "\342\214\216"},
+    {"Iukcy;", "\320\206"},
+    {"xodot;", "\342\250\200"},
+    {"LJcy;", "\320\211"},
+    {"Rightarrow;", "\342\207\222"},
+    {"forkv;", "\342\253\231"},
+    {"downdownarrows;", "\342\207\212"},
+    {"leqq;", "\342\211\246"},
+    {"Psi;", "\316\250"},
+    {"backsim;", "\342\210\275"},
+    {"LeftDownVector;", "\342\207\203"},
+    {"zfr;", "\360\235\224\267"},
+    {"nvDash;", "\342\212\255"},
+    {"Aacute", "\303\201"},
+    {"uhblk;", "\342\226\200"},
+    {"aelig;", "\303\246"},
+    {"kgreen;", "\304\270"},
+    {"varkappa;", "\317\260"},
+    {"epsi;", "\316\265"},
+    {"QUOT", "\042"},
+    {"kopf;", "\360\235\225\234"},
+    {"Tilde;", "\342\210\274"},
+    {"bumpE;", "\342\252\256"},
+    {"varpropto;", "\342\210\235"},
+    {"varsubsetneq;", "\342\212\212\357\270\200"},
+    {"xoplus;", "\342\250\201"},
+    {"icy;", "\320\270"},
+    {"Ncy;", "\320\235"},
+    {"nvgt;", ">\342\203\222"},
+    {"csube;", "\342\253\221"},
+    {"uarr;", "\342\206\221"},
+    {"fflig;", "\357\254\200"},
+    {"Congruent;", "\342\211\241"},
+    {"DotEqual;", "\342\211\220"},
+    {"imped;", "\306\265"},
+    {"cwconint;", "\342\210\262"},
+    {"bepsi;", "\317\266"},
+    {"bullet;", "\342\200\242"},
+    {"gg;", "\342\211\253"},
+    {"easter;", "\342\251\256"},
+    {"rfr;", "\360\235\224\257"},
+    {"omega;", "\317\211"},
+    {"nvdash;", "\342\212\254"},
+    {"nedot;", "\342\211\220\314\270"},
+    {"lrcorner;", "\342\214\237"},
+    {"ne;", "\342\211\240"},
+    {"dashv;", "\342\212\243"},
+    {"ngeqq;", "\342\211\247\314\270"},
+    {"ffr;", "\360\235\224\243"},
+    {"ang;", "\342\210\240"},
+    {"searhk;", "\342\244\245"},
+    {"mu;", "\316\274"},
+    {"conint;", "\342\210\256"},
+    {"NotDoubleVerticalBar;", "\342\210\246"},
+    {"NotNestedGreaterGreater;", "\342\252\242\314\270"},
+    {"Ufr;", "\360\235\224\230"},
+    {"propto;", "\342\210\235"},
+    {"lesdot;", "\342\251\277"},
+    {"frac34", "\302\276"},
+    {"sup2;", "\302\262"},
+    {"kfr;", "\360\235\224\250"},
+    {"ange;", "\342\246\244"},
+    {"Omicron;", "\316\237"},
+    {"scedil;", "\305\237"},
+    {"rdsh;", "\342\206\263"},
+    {"eqcirc;", "\342\211\226"},
+    {"agrave", "\303\240"},
+    {"DownBreve;", "\314\221"},
+    {"boxur;", "\342\224\224"},
+    {"imath;", "\304\261"},
+    {"Kcy;", "\320\232"},
+    {"boxUr;", "\342\225\231"},
+    {"angmsdaf;", "\342\246\255"},
+    {"frac23;", "\342\205\224"},
+    {"epsiv;", "\317\265"},
+    {"simplus;", "\342\250\244"},
+    {"supsim;", "\342\253\210"},
+    {"le;", "\342\211\244"},
+    {"epsilon;", "\316\265"},
+    {"gtdot;", "\342\213\227"},
+    {"angmsdag;", "\342\246\256"},
+    {"tprime;", "\342\200\264"},
+    {"lcedil;", "\304\274"},
+    {"zhcy;", "\320\266"},
+    {"eacute;", "\303\251"},
+    {"shortmid;", "\342\210\243"},
+    {"oopf;", "\360\235\225\240"},
+    {"LeftTeeArrow;", "\342\206\244"},
+    {"Bfr;", "\360\235\224\205"},
+    {"npreceq;", "\342\252\257\314\270"},
+    {"Ropf;", "\342\204\235"},
+    {"uml", "\302\250"},
+    {"NewLine;", "\012"},
+    {"twoheadrightarrow;", "\342\206\240"},
+    {"vangrt;", "\342\246\234"},
+    {"lacute;", "\304\272"},
+    {"ntriangleright;", "\342\213\253"},
+    {"iuml", "\303\257"},
+    {"divide;", "\303\267"},
+    {"lAtail;", "\342\244\233"},
+    {"Scedil;", "\305\236"},
+    {"gE;", "\342\211\247"},
+    {"iukcy;", "\321\226"},
+    {"acute;", "\302\264"},
+    {"Mfr;", "\360\235\224\220"},
+    {"laquo;", "\302\253"},
+    {"smte;", "\342\252\254"},
+    {"lessdot;", "\342\213\226"},
+    {"hearts;", "\342\231\245"},
+    {"supplus;", "\342\253\200"},
+    {"Sfr;", "\360\235\224\226"},
+    {"piv;", "\317\226"},
+    {"perp;", "\342\212\245"},
+    {"odsold;", "\342\246\274"},
+    {"Ntilde", "\303\221"},
+    {"Larr;", "\342\206\236"},
+    {"smile;", "\342\214\243"},
+    {"nharr;", "\342\206\256"},
+    {"Gamma;", "\316\223"},
+    {"ecaron;", "\304\233"},
+    {"lArr;", "\342\207\220"},
+    {"GreaterSlantEqual;", "\342\251\276"},
+    {"LeftFloor;", "\342\214\212"},
+    {"leftrightarrow;", "\342\206\224"},
+    {"copysr;", "\342\204\227"},
+    {"QUOT;", "\042"},
+    {"profsurf;", "\342\214\223"},
+    {"boxH;", "\342\225\220"},
+    {"Ecirc", "\303\212"},
+    {"VerticalSeparator;", "\342\235\230"},
+    {"DotDot;", "\342\203\234"},
+    {"vartriangleleft;", "\342\212\262"},
+    {"ENG;", "\305\212"},
+    {"alpha;", "\316\261"},
+    {"backcong;", "\342\211\214"},
+    {"orv;", "\342\251\233"},
+    {"xotime;", "\342\250\202"},
+    {"nwarhk;", "\342\244\243"},
+    {"sim;", "\342\210\274"},
+    {"natur;", "\342\231\256"},
+    {"timesd;", "\342\250\260"},
+    {"vfr;", "\360\235\224\263"},
+    {"curren;", "\302\244"},
+    {"frac56;", "\342\205\232"},
+    {"gnap;", "\342\252\212"},
+    {"doteqdot;", "\342\211\221"},
+    {"mumap;", "\342\212\270"},
+    {"olcross;", "\342\246\273"},
+    {"vltri;", "\342\212\262"},
+    {"eopf;", "\360\235\225\226"},
+    {"nexist;", "\342\210\204"},
+    {"NegativeVeryThinSpace;", "\342\200\213"},
+    {"prap;", "\342\252\267"},
+    {"capand;", "\342\251\204"},
+    {"oacute", "\303\263"},
+    {"gsime;", "\342\252\216"},
+    {"Iopf;", "\360\235\225\200"},
+    {"rangd;", "\342\246\222"},
+    {"rangle;", "\342\237\251"},
+    {"cent;", "\302\242"},
+    {"GJcy;", "\320\203"},
+    {"rcedil;", "\305\227"},
+    {"nleftrightarrow;", "\342\206\256"},
+    {"ngE;", "\342\211\247\314\270"},
+    {"rtrif;", "\342\226\270"},
+    {"ast;", "*"},
+    {"glj;", "\342\252\244"},
+    {"odiv;", "\342\250\270"},
+    {"vnsub;", "\342\212\202\342\203\222"},
+    {"LeftUpVector;", "\342\206\277"},
+    {"CirclePlus;", "\342\212\225"},
+    {"CircleMinus;", "\342\212\226"},
+    {"Omacr;", "\305\214"},
+    {"gtreqqless;", "\342\252\214"},
+    {"micro;", "\302\265"},
+    {"pluscir;", "\342\250\242"},
+    {"Fouriertrf;", "\342\204\261"},
+    {"cwint;", "\342\210\261"},
+    {"starf;", "\342\230\205"},
+    {"sung;", "\342\231\252"},
+    {"primes;", "\342\204\231"},
+    {"Gscr;", "\360\235\222\242"},
+    {"varsupsetneqq;", "\342\253\214\357\270\200"},
+    {"shy", "\302\255"},
+    {"gesdoto;", "\342\252\202"},
+    {"ccaron;", "\304\215"},
+    {"Cayleys;", "\342\204\255"},
+    {"ropar;", "\342\246\206"},
+    {"acute", "\302\264"},
+    {"af;", "\342\201\241"},
+    {"rdca;", "\342\244\267"},
+    {"KHcy;", "\320\245"},
+    {"agrave;", "\303\240"},
+    {"circledcirc;", "\342\212\232"},
+    {"gneqq;", "\342\211\251"},
+    {"rbrke;", "\342\246\214"},
+    {"dblac;", "\313\235"},
+    {"auml;", "\303\244"},
+    {"Pi;", "\316\240"},
+    {"uuml", "\303\274"},
+    {"vee;", "\342\210\250"},
+    {"ulcorn;", "\342\214\234"},
+    {"GreaterFullEqual;", "\342\211\247"},
+    {"Star;", "\342\213\206"},
+    {"Euml", "\303\213"},
+    {"cupcup;", "\342\251\212"},
+    {"tosa;", "\342\244\251"},
+    {"cudarrr;", "\342\244\265"},
+    {"yopf;", "\360\235\225\252"},
+    {"notinvc;", "\342\213\266"},
+    {"nvlArr;", "\342\244\202"},
+    {"mDDot;", "\342\210\272"},
+    {"crarr;", "\342\206\265"},
+    {"parsl;", "\342\253\275"},
+    {"nLt;", "\342\211\252\342\203\222"},
+    {"blacktriangleleft;", "\342\227\202"},
+    {"bprime;", "\342\200\265"},
+    {"Lmidot;", "\304\277"},
+    {"subsim;", "\342\253\207"},
+    {"igrave;", "\303\254"},
+    {"cemptyv;", "\342\246\262"},
+    {"odash;", "\342\212\235"},
+    {"nparsl;", "\342\253\275\342\203\245"},
+    {"HumpDownHump;", "\342\211\216"},
+    {"hcirc;", "\304\245"},
+    {"iuml;", "\303\257"},
+    {"Not;", "\342\253\254"},
+    {"SmallCircle;", "\342\210\230"},
+    {"Equal;", "\342\251\265"},
+    {"yen;", "\302\245"},
+    {"prsim;", "\342\211\276"},
+    {"LeftDownTeeVector;", "\342\245\241"},
+    {"boxdL;", "\342\225\225"},
+    {"Vdash;", "\342\212\251"},
+    {"FilledVerySmallSquare;", "\342\226\252"},
+    {"nldr;", "\342\200\245"},
+    {"utilde;", "\305\251"},
+    {"Ecirc;", "\303\212"},
+    {"xcap;", "\342\213\202"},
+    {"plussim;", "\342\250\246"},
+    {"nis;", "\342\213\274"},
+    {"leftarrowtail;", "\342\206\242"},
+    {"ldca;", "\342\244\266"},
+    {"Emacr;", "\304\222"},
+    {"Uacute", "\303\232"},
+    {"NotSuperset;", "\342\212\203\342\203\222"},
+    {"zcaron;", "\305\276"},
+    {"xrArr;", "\342\237\271"},
+    {"rfisht;", "\342\245\275"},
+    {"supedot;", "\342\253\204"},
+    {"CenterDot;", "\302\267"},
+    {"Xi;", "\316\236"},
+    {"boxvh;", "\342\224\274"},
+    {"scnsim;", "\342\213\251"},
+    {"becaus;", "\342\210\265"},
+    {"DScy;", "\320\205"},
+    {"nsube;", "\342\212\210"},
+    {"xi;", "\316\276"},
+    {"triplus;", "\342\250\271"},
+    {"xhArr;", "\342\237\272"},
+    {"otimesas;", "\342\250\266"},
+    {"Chi;", "\316\247"},
+    {"boxh;", "\342\224\200"},
+    {"curlyvee;", "\342\213\216"},
+    {"lne;", "\342\252\207"},
+    {"SquareSubsetEqual;", "\342\212\221"},
+    {"simeq;", "\342\211\203"},
+    {"Xscr;", "\360\235\222\263"},
+    {"SquareSuperset;", "\342\212\220"},
+    {"pertenk;", "\342\200\261"},
+    {"lopf;", "\360\235\225\235"},
+    {"precapprox;", "\342\252\267"},
+    {"xwedge;", "\342\213\200"},
+    {"srarr;", "\342\206\222"},
+    {"eth;", "\303\260"},
+    {"cupcap;", "\342\251\206"},
+    {"nshortparallel;", "\342\210\246"},
+    {"Ffr;", "\360\235\224\211"},
+    {"Umacr;", "\305\252"},
+    {"HARDcy;", "\320\252"},
+    {"Verbar;", "\342\200\226"},
+    {"GT;", ">"},
+    {"wedgeq;", "\342\211\231"},
+    {"nexists;", "\342\210\204"},
+    {"sime;", "\342\211\203"},
+    {"Imacr;", "\304\252"},
+    {"Sigma;", "\316\243"},
+    {"measuredangle;", "\342\210\241"},
+    {"ograve", "\303\262"},
+    {"loz;", "\342\227\212"},
+    {"downharpoonright;", "\342\207\202"},
+    {"bigcap;", "\342\213\202"},
+    {"urtri;", "\342\227\271"},
+    {"marker;", "\342\226\256"},
+    {"NotSucceedsSlantEqual;", "\342\213\241"},
+    {"topcir;", "\342\253\261"},
+    {"rarrb;", "\342\207\245"},
+    {"dharl;", "\342\207\203"},
+    {"Zdot;", "\305\273"},
+    {"xvee;", "\342\213\201"},
+    {"Ascr;", "\360\235\222\234"},
+    {"boxVh;", "\342\225\253"},
+    {"HorizontalLine;", "\342\224\200"},
+    {"Aring;", "\303\205"},
+    {"NotLessTilde;", "\342\211\264"},
+    {"mapsto;", "\342\206\246"},
+    {"fjlig;", "fj"},
+    {"rx;", "\342\204\236"},
+    {"spades;", "\342\231\240"},
+    {"jmath;", "\310\267"},
+    {"andand;", "\342\251\225"},
+    {"yuml", "\303\277"},
+    {"Kcedil;", "\304\266"},
+    {"mdash;", "\342\200\224"},
+    {"Cdot;", "\304\212"},
+    {"ShortRightArrow;", "\342\206\222"},
+    {"prime;", "\342\200\262"},
+    {"Tcaron;", "\305\244"},
+    {"lfisht;", "\342\245\274"},
+    {"clubsuit;", "\342\231\243"},
+    {"ldquor;", "\342\200\236"},
+    {"SquareUnion;", "\342\212\224"},
+    {"ocy;", "\320\276"},
+    {"frac34;", "\302\276"},
+    {"leg;", "\342\213\232"},
+    {"RightTeeVector;", "\342\245\233"},
+    {"notni;", "\342\210\214"},
+    {"Ucirc", "\303\233"},
+    {"leq;", "\342\211\244"},
+    {"uparrow;", "\342\206\221"},
+    {"lharu;", "\342\206\274"},
+    {"vsupne;", "\342\212\213\357\270\200"},
+    {"LowerRightArrow;", "\342\206\230"},
+    {"esdot;", "\342\211\220"},
+    {"udblac;", "\305\261"},
+    {"ltimes;", "\342\213\211"},
+    {"image;", "\342\204\221"},
+    {"YIcy;", "\320\207"},
+    {"pre;", "\342\252\257"},
+    {"lbrke;", "\342\246\213"},
+    {"Abreve;", "\304\202"},
+    {"LeftRightArrow;", "\342\206\224"},
+    {"lfr;", "\360\235\224\251"},
+    {"Rarr;", "\342\206\240"},
+    {"mcomma;", "\342\250\251"},
+    {"Hacek;", "\313\207"},
+    {"Element;", "\342\210\210"},
+    {"nGtv;", "\342\211\253\314\270"},
+    {"nsub;", "\342\212\204"},
+    {"disin;", "\342\213\262"},
+    {"larrbfs;", "\342\244\237"},
+    {"notindot;", "\342\213\265\314\270"},
+    {"Iscr;", "\342\204\220"},
+    {"vsubnE;", "\342\253\213\357\270\200"},
+    {"LT;", "<"},
+    {"ngeq;", "\342\211\261"},
+    {"IOcy;", "\320\201"},
+    {"nwnear;", "\342\244\247"},
+    {"bsemi;", "\342\201\217"},
+    {"CupCap;", "\342\211\215"},
+    {"rharul;", "\342\245\254"},
+    {"dopf;", "\360\235\225\225"},
+    {"bigotimes;", "\342\250\202"},
+    {"UpArrow;", "\342\206\221"},
+    {"utdot;", "\342\213\260"},
+    {"Jcirc;", "\304\264"},
+    {"vert;", "|"},
+    {"risingdotseq;", "\342\211\223"},
+    {"between;", "\342\211\254"},
+    {"curlyeqprec;", "\342\213\236"},
+    {"fork;", "\342\213\224"},
+    {"midcir;", "\342\253\260"},
+    {"parallel;", "\342\210\245"},
+    {"tridot;", "\342\227\254"},
+    {"lhblk;", "\342\226\204"},
+    {"ycirc;", "\305\267"},
+    {"commat;", "@"},
+    {"varsupsetneq;", "\342\212\213\357\270\200"},
+    {"naturals;", "\342\204\225"},
+    {"cupor;", "\342\251\205"},
+    {"emsp13;", "\342\200\204"},
+    {"bNot;", "\342\253\255"},
+};
+
+#endif // HTML_ENTITY_TABLE_H
@@ -1,1212 +1,245 @@
-#include <iostream>
-#include <fstream>
-#include <cstring>
-#include <cstdlib>
-#include <cctype>
-#include <stdexcept>
-#include <cstdio>
-#include <string>
+#include "html_parser.h"
+#include "batch_parser.h"
+#include "dom_snapshot.h"
+#include "dom_diff.h"
+#include "file_watch.h"
 
-// ============================================================================
-// STRING UTILITY FUNCTIONS (Manual implementation)
-// ============================================================================
-
-char* copyString(const char* str) {
-    if (!str) return nullptr;
-    int len = strlen(str);
-    char* result = new char[len + 1];
-    strcpy(result, str);
-    return result;
-}
-
-char* substring(const char* str, int start, int len) {
-    if (!str || start < 0 || len < 0) return nullptr;
-    int strLen = strlen(str);
-    if (start >= strLen) return nullptr;
-    if (start + len > strLen) len = strLen - start;
-    if (len <= 0) return nullptr;
-    char* result = new char[len + 1];
-    if (!result) return nullptr;
-    strncpy(result, str + start, len);
-    result[len] = '\0';
-    return result;
-}
-
-void trimString(char* str) {
-    if (!str) return;
-    int start = 0;
-    while (str[start] && isspace(str[start])) start++;
-    int end = strlen(str) - 1;
-    while (end >= start && isspace(str[end])) end--;
-    int len = end - start + 1;
-    memmove(str, str + start, len);
-    str[len] = '\0';
-}
+DEFINE_MEMORY_ACCOUNTING()
 
 // ============================================================================
-// LINKED LIST CLASS
+// MAIN FUNCTION
 // ============================================================================
 
-template<typename T>
-class LinkedList {
-private:
-    struct Node {
-        T data;
-        Node* next;
-        Node(T d) : data(d), next(nullptr) {}
-    };
-    Node* head;
-    int size;
-
-public:
-    LinkedList() : head(nullptr), size(0) {}
-    
-    ~LinkedList() {
-        clear();
-    }
-    
-    void insert(T data) {
-        Node* newNode = new Node(data);
-        if (!head) {
-            head = newNode;
+// html_parser --batch <manifest or folder> [--out DIR | --combined FILE] [--threads N]
+int runBatchMode(int argc, char* argv[]) {
+    std::string source = argv[2];
+    std::string traceFile;
+    BatchOptions options;
+    options.outputDir = "batch_output";
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            options.outputDir = argv[++i];
+        } else if (strcmp(argv[i], "--combined") == 0 && i + 1 < argc) {
+            options.combinedFile = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFile = argv[++i];
         } else {
-            Node* current = head;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = newNode;
-        }
-        size++;
-    }
-    
-    void insertFront(T data) {
-        Node* newNode = new Node(data);
-        newNode->next = head;
-        head = newNode;
-        size++;
-    }
-    
-    bool remove(T data) {
-        if (!head) return false;
-        if (head->data == data) {
-            Node* temp = head;
-            head = head->next;
-            delete temp;
-            size--;
-            return true;
-        }
-        Node* current = head;
-        while (current->next) {
-            if (current->next->data == data) {
-                Node* temp = current->next;
-                current->next = temp->next;
-                delete temp;
-                size--;
-                return true;
-            }
-            current = current->next;
-        }
-        return false;
-    }
-    
-    bool search(T data) {
-        Node* current = head;
-        while (current) {
-            if (current->data == data) return true;
-            current = current->next;
-        }
-        return false;
-    }
-    
-    bool isEmpty() const {
-        return head == nullptr;
-    }
-    
-    int getSize() const {
-        return size;
-    }
-    
-    T getFront() {
-        if (head) return head->data;
-        return T();
-    }
-    
-    void clear() {
-        while (head) {
-            Node* temp = head;
-            head = head->next;
-            delete temp;
-        }
-        size = 0;
-    }
-    
-    Node* getHead() const {
-        return head;
-    }
-};
-
-// ============================================================================
-// STACK CLASS
-// ============================================================================
-
-template<typename T>
-class Stack {
-private:
-    struct Node {
-        T data;
-        Node* next;
-        Node(T d) : data(d), next(nullptr) {}
-    };
-    Node* top;
-    int size;
-
-public:
-    Stack() : top(nullptr), size(0) {}
-    
-    ~Stack() {
-        clear();
-    }
-    
-    void push(T data) {
-        Node* newNode = new Node(data);
-        newNode->next = top;
-        top = newNode;
-        size++;
-    }
-    
-    T pop() {
-        if (!top) return T();
-        Node* temp = top;
-        T data = top->data;
-        top = top->next;
-        delete temp;
-        size--;
-        return data;
-    }
-    
-    T peek() const {
-        if (!top) return T();
-        return top->data;
-    }
-    
-    bool isEmpty() const {
-        return top == nullptr;
-    }
-    
-    int getSize() const {
-        return size;
-    }
-    
-    void clear() {
-        while (top) {
-            Node* temp = top;
-            top = top->next;
-            delete temp;
+            std::cerr << "Unknown batch option " << argv[i] << std::endl;
+            return 1;
         }
-        size = 0;
     }
-};
 
-// ============================================================================
-// QUEUE CLASS
-// ============================================================================
-
-template<typename T>
-class Queue {
-private:
-    struct Node {
-        T data;
-        Node* next;
-        Node(T d) : data(d), next(nullptr) {}
-    };
-    Node* front;
-    Node* rear;
-    int size;
-
-public:
-    Queue() : front(nullptr), rear(nullptr), size(0) {}
-    
-    ~Queue() {
-        clear();
-    }
-    
-    void enqueue(T data) {
-        Node* newNode = new Node(data);
-        if (!rear) {
-            front = rear = newNode;
-        } else {
-            rear->next = newNode;
-            rear = newNode;
-        }
-        size++;
-    }
-    
-    T dequeue() {
-        if (!front) return T();
-        Node* temp = front;
-        T data = front->data;
-        front = front->next;
-        if (!front) rear = nullptr;
-        delete temp;
-        size--;
-        return data;
-    }
-    
-    T peek() const {
-        if (!front) return T();
-        return front->data;
-    }
-    
-    bool isEmpty() const {
-        return front == nullptr;
-    }
-    
-    int getSize() const {
-        return size;
-    }
-    
-    void clear() {
-        while (front) {
-            Node* temp = front;
-            front = front->next;
-            delete temp;
-        }
-        rear = nullptr;
-        size = 0;
-    }
-};
-
-// ============================================================================
-// HASH TABLE CLASS
-// ============================================================================
-
-class HashTable {
-private:
-    struct HashNode {
-        char* key;
-        char* value;
-        HashNode* next;
-        HashNode(const char* k, const char* v) {
-            key = copyString(k);
-            value = copyString(v);
-            next = nullptr;
-        }
-        ~HashNode() {
-            delete[] key;
-            delete[] value;
-        }
-    };
-    
-    static const int TABLE_SIZE = 101;
-    HashNode** buckets;
-    int size;
-
-    int hashFunction(const char* key) {
-        int hash = 0;
-        for (int i = 0; key[i]; i++) {
-            hash = (hash * 31 + key[i]) % TABLE_SIZE;
-        }
-        return hash;
+    std::vector<BatchItem> items;
+    std::string error;
+    std::error_code ec;
+    bool listed = std::filesystem::is_directory(source, ec) ? listHtmlFiles(source, options.outputDir, items, error)
+                                                            : loadManifest(source, options.outputDir, items, error);
+    if (!listed || (options.combinedFile.empty() && !checkDistinctOutputs(items, error))) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
     }
 
-public:
-    HashTable() : size(0) {
-        buckets = new HashNode*[TABLE_SIZE];
-        for (int i = 0; i < TABLE_SIZE; i++) {
-            buckets[i] = nullptr;
-        }
-    }
-    
-    ~HashTable() {
-        clear();
-        delete[] buckets;
-    }
-    
-    void insert(const char* key, const char* value) {
-        int index = hashFunction(key);
-        HashNode* current = buckets[index];
-        
-        // Check if key already exists
-        while (current) {
-            if (strcmp(current->key, key) == 0) {
-                delete[] current->value;
-                current->value = copyString(value);
-                return;
-            }
-            current = current->next;
-        }
-        
-        // Insert new node at front of chain
-        HashNode* newNode = new HashNode(key, value);
-        newNode->next = buckets[index];
-        buckets[index] = newNode;
-        size++;
+    if (!traceFile.empty()) enableTracing();
+    std::cout << "Batch input: " << source << " (" << items.size() << " files)" << std::endl;
+    std::cout << "Render output: " << (options.combinedFile.empty() ? options.outputDir + "/" : options.combinedFile)
+              << std::endl;
+    BatchStats stats = runBatch(items, options);
+    printBatchStats(std::cout, stats);
+    if (!traceFile.empty() && !writeTraceFile(traceFile, error)) {
+        std::cerr << "Error: " << error << std::endl;
     }
-    
-    char* get(const char* key) {
-        int index = hashFunction(key);
-        HashNode* current = buckets[index];
-        while (current) {
-            if (strcmp(current->key, key) == 0) {
-                return current->value;
-            }
-            current = current->next;
-        }
-        return nullptr;
-    }
-    
-    bool contains(const char* key) {
-        return get(key) != nullptr;
-    }
-    
-    void remove(const char* key) {
-        int index = hashFunction(key);
-        HashNode* current = buckets[index];
-        HashNode* prev = nullptr;
-        
-        while (current) {
-            if (strcmp(current->key, key) == 0) {
-                if (prev) {
-                    prev->next = current->next;
-                } else {
-                    buckets[index] = current->next;
-                }
-                delete current;
-                size--;
-                return;
-            }
-            prev = current;
-            current = current->next;
-        }
-    }
-    
-    int getSize() const {
-        return size;
-    }
-    
-    void clear() {
-        for (int i = 0; i < TABLE_SIZE; i++) {
-            while (buckets[i]) {
-                HashNode* temp = buckets[i];
-                buckets[i] = buckets[i]->next;
-                delete temp;
-            }
-        }
-        size = 0;
-    }
-};
-
-// ============================================================================
-// AVL TREE CLASS (for tag indexing)
-// ============================================================================
+    return stats.failed == 0 ? 0 : 1;
+}
 
-class AVLTree {
-private:
-    struct AVLNode {
-        char* data;
-        AVLNode* left;
-        AVLNode* right;
-        int height;
-        
-        AVLNode(const char* d) {
-            data = copyString(d);
-            left = right = nullptr;
-            height = 1;
-        }
-        
-        ~AVLNode() {
-            delete[] data;
-        }
-    };
-    
-    AVLNode* root;
-    
-    int getHeight(AVLNode* node) {
-        return node ? node->height : 0;
-    }
-    
-    int getBalance(AVLNode* node) {
-        return node ? getHeight(node->left) - getHeight(node->right) : 0;
-    }
-    
-    void updateHeight(AVLNode* node) {
-        if (node) {
-            int leftHeight = getHeight(node->left);
-            int rightHeight = getHeight(node->right);
-            node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
-        }
-    }
-    
-    AVLNode* rotateRight(AVLNode* y) {
-        if (!y || !y->left) return y;
-        AVLNode* x = y->left;
-        AVLNode* T2 = x->right;
-        
-        x->right = y;
-        y->left = T2;
-        
-        updateHeight(y);
-        updateHeight(x);
-        
-        return x;
-    }
-    
-    AVLNode* rotateLeft(AVLNode* x) {
-        if (!x || !x->right) return x;
-        AVLNode* y = x->right;
-        AVLNode* T2 = y->left;
-        
-        y->left = x;
-        x->right = T2;
-        
-        updateHeight(x);
-        updateHeight(y);
-        
-        return y;
-    }
-    
-    AVLNode* insertHelper(AVLNode* node, const char* data) {
-        if (!node) {
-            return new AVLNode(data);
-        }
-        
-        int cmp = strcmp(data, node->data);
-        if (cmp < 0) {
-            node->left = insertHelper(node->left, data);
-        } else if (cmp > 0) {
-            node->right = insertHelper(node->right, data);
+// html_parser --load <snapshot> [page.txt] [--threads N]: renders a stored DOM, nothing is parsed
+int runLoadMode(int argc, char* argv[]) {
+    const char* snapshotFile = argv[2];
+    const char* outputFile = "page.txt";
+    int threads = 1;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
         } else {
-            return node; // Duplicate
-        }
-        
-        updateHeight(node);
-        
-        int balance = getBalance(node);
-        
-        // Left Left Case
-        if (balance > 1 && node->left && strcmp(data, node->left->data) < 0) {
-            return rotateRight(node);
-        }
-        
-        // Right Right Case
-        if (balance < -1 && node->right && strcmp(data, node->right->data) > 0) {
-            return rotateLeft(node);
-        }
-        
-        // Left Right Case
-        if (balance > 1 && node->left && strcmp(data, node->left->data) > 0) {
-            node->left = rotateLeft(node->left);
-            return rotateRight(node);
-        }
-        
-        // Right Left Case
-        if (balance < -1 && node->right && strcmp(data, node->right->data) < 0) {
-            node->right = rotateRight(node->right);
-            return rotateLeft(node);
-        }
-        
-        return node;
-    }
-    
-    bool searchHelper(AVLNode* node, const char* data) {
-        if (!node) return false;
-        
-        int cmp = strcmp(data, node->data);
-        if (cmp == 0) return true;
-        if (cmp < 0) return searchHelper(node->left, data);
-        return searchHelper(node->right, data);
-    }
-    
-    void clearHelper(AVLNode* node) {
-        if (node) {
-            clearHelper(node->left);
-            clearHelper(node->right);
-            delete node;
+            outputFile = argv[i];
         }
     }
+    std::cout << "Snapshot: " << snapshotFile << std::endl;
+    std::cout << "Render output: " << outputFile << std::endl;
 
-public:
-    AVLTree() : root(nullptr) {}
-    
-    ~AVLTree() {
-        clear();
-    }
-    
-    void insert(const char* data) {
-        root = insertHelper(root, data);
-    }
-    
-    bool search(const char* data) {
-        return searchHelper(root, data);
-    }
-    
-    void clear() {
-        clearHelper(root);
-        root = nullptr;
-    }
-};
-
-// ============================================================================
-// GRAPH CLASS (adjacency list representation)
-// ============================================================================
-
-class Graph {
-private:
-    struct GraphNode {
-        int vertex;
-        GraphNode* next;
-        GraphNode(int v) : vertex(v), next(nullptr) {}
-    };
-    
-    GraphNode** adjList;
-    int numVertices;
-    int maxVertices;
-
-public:
-    Graph(int maxV = 1000) : numVertices(0), maxVertices(maxV) {
-        adjList = new GraphNode*[maxVertices];
-        for (int i = 0; i < maxVertices; i++) {
-            adjList[i] = nullptr;
-        }
-    }
-    
-    ~Graph() {
-        for (int i = 0; i < maxVertices; i++) {
-            GraphNode* current = adjList[i];
-            while (current) {
-                GraphNode* temp = current;
-                current = current->next;
-                delete temp;
-            }
-        }
-        delete[] adjList;
-    }
-    
-    void addVertex(int v) {
-        if (v >= 0 && v < maxVertices && v >= numVertices) {
-            numVertices = v + 1;
-        }
-    }
-    
-    void addEdge(int src, int dest) {
-        if (src >= 0 && src < maxVertices && dest >= 0 && dest < maxVertices) {
-            addVertex(src);
-            addVertex(dest);
-            GraphNode* newNode = new GraphNode(dest);
-            newNode->next = adjList[src];
-            adjList[src] = newNode;
-        }
-    }
-    
-    void printGraph() {
-        for (int i = 0; i < numVertices; i++) {
-            std::cout << "Vertex " << i << ": ";
-            GraphNode* current = adjList[i];
-            while (current) {
-                std::cout << current->vertex << " ";
-                current = current->next;
-            }
-            std::cout << std::endl;
-        }
+    auto started = std::chrono::steady_clock::now();
+    DomSnapshot snapshot;
+    std::string error;
+    if (!snapshot.open(snapshotFile, error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
     }
-    
-    int getNumVertices() const {
-        return numVertices;
+    std::ofstream file(outputFile);
+    if (!file.is_open()) {
+        std::cerr << "Error: Cannot open file " << outputFile << " for writing" << std::endl;
+        return 1;
     }
-};
-
-// ============================================================================
-// HTML NODE STRUCTURE (General Tree for DOM)
-// ============================================================================
+    writeRenderDocument(file, snapshot.buildRenderDocument(threads));
+    file.close();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
 
-enum TokenType {
-    OPEN_TAG,
-    CLOSE_TAG,
-    TEXT,
-    SELF_CLOSE_TAG
-};
+    std::cout << "Rendered from snapshot in " << ms << " ms: " << snapshot.nodeCount() << " nodes, "
+              << snapshot.attributeCount() << " attributes, " << snapshot.edgeCount() << " graph edges, "
+              << snapshot.fileBytes() << " bytes mapped" << std::endl;
+    return 0;
+}
 
-struct Token {
-    TokenType type;
-    char* content;
-    HashTable* attributes;
-    
-    Token() : type(TEXT), content(nullptr), attributes(nullptr) {}
-    
-    ~Token() {
-        delete[] content;
-        delete attributes;
-    }
-};
+// html_parser --watch <page.html> [page.txt]: renders the page again every time it is saved, re-rendering
+// only the subtrees that changed
+int runWatchMode(int argc, char* argv[]) {
+    const char* inputFile = argv[2];
+    const char* outputFile = argc > 3 ? argv[3] : "page.txt";
+    std::cout << "Watching: " << inputFile << " (Ctrl+C to stop)" << std::endl;
+    std::cout << "Render output: " << outputFile << std::endl;
 
-struct HTMLNode {
-    char* tagName;
-    char* textContent;
-    HashTable* attributes;
-    HTMLNode* parent;
-    HTMLNode* firstChild;
-    HTMLNode* nextSibling;
-    int depth;
-    int nodeId; // For graph representation
-    
-    HTMLNode() {
-        tagName = nullptr;
-        textContent = nullptr;
-        attributes = new HashTable();
-        parent = nullptr;
-        firstChild = nullptr;
-        nextSibling = nullptr;
-        depth = 0;
-        nodeId = -1;
-    }
-    
-    ~HTMLNode() {
-        delete[] tagName;
-        delete[] textContent;
-        delete attributes;
-        // Children and siblings are managed by tree cleanup
+    FileWatcher watcher(inputFile);
+    std::string error;
+    if (!watcher.start(error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
     }
-    
-    void addChild(HTMLNode* child) {
-        if (!child) return;
-        child->parent = this;
-        child->depth = this->depth + 1;
-        
-        if (!firstChild) {
-            firstChild = child;
+    HTMLParser parser;
+    ReloadRenderer renderer;
+    std::string html;
+    std::string transcoded;
+    for (;;) {
+        auto started = std::chrono::steady_clock::now();
+        if (!readWholeFile(inputFile, html)) {
+            std::cerr << "Error: Cannot open file " << inputFile << std::endl;
         } else {
-            HTMLNode* current = firstChild;
-            while (current->nextSibling) {
-                current = current->nextSibling;
+            parser.parse(decodeHtmlDocument(html.c_str(), html.size(), "", transcoded));
+            auto parsed = std::chrono::steady_clock::now();
+            ReloadStats reload;
+            std::ofstream file(outputFile);
+            if (!file.is_open()) {
+                std::cerr << "Error: Cannot open file " << outputFile << " for writing" << std::endl;
+                return 1;
             }
-            current->nextSibling = child;
-        }
-    }
-    
-    void addSibling(HTMLNode* sibling) {
-        if (!sibling) return;
-        HTMLNode* current = this;
-        while (current->nextSibling) {
-            current = current->nextSibling;
-        }
-        current->nextSibling = sibling;
-        sibling->parent = this->parent;
-        sibling->depth = this->depth;
-    }
-};
-
-// ============================================================================
-// HTML PARSER CLASS
-// ============================================================================
+            writeRenderDocument(file, renderer.renderTree(parser.getRoot(), &reload));
+            file.close();
+            auto rendered = std::chrono::steady_clock::now();
 
-class HTMLParser {
-private:
-    HTMLNode* root;
-    AVLTree* tagRegistry;
-    Graph* elementGraph;
-    int nodeCounter;
-    std::string pageTitle;
-    
-    // HTML4 valid tags (no duplicates)
-    const char* html4Tags[49] = {
-        "html", "head", "body", "title", "meta", "div", "span",
-        "h1", "h2", "h3", "h4", "h5", "h6",
-        "p", "br", "hr", "pre", "code",
-        "strong", "em", "b", "i", "u", "small", "big",
-        "ul", "ol", "li", "dl", "dt", "dd",
-        "a", "img",
-        "table", "tr", "td", "th", "thead", "tbody",
-        "form", "input", "textarea", "button", "select", "option",
-        "script", "style", "link", "base"
-    };
-    
-    void initializeTagRegistry() {
-        tagRegistry = new AVLTree();
-        for (int i = 0; i < 49; i++) {
-            tagRegistry->insert(html4Tags[i]);
-        }
-    }
-    
-    char* toLowerCase(const char* str) {
-        if (!str) return nullptr;
-        int len = strlen(str);
-        char* result = new char[len + 1];
-        for (int i = 0; i < len; i++) {
-            result[i] = tolower(str[i]);
-        }
-        result[len] = '\0';
-        return result;
-    }
-    
-    Token* createToken(TokenType type, const char* content) {
-        Token* token = new Token();
-        token->type = type;
-        token->content = copyString(content);
-        token->attributes = new HashTable();
-        return token;
-    }
-    
-    void parseAttributes(const char* tagStr, HashTable* attrs) {
-        if (!tagStr || !attrs) return;
-        
-        int len = strlen(tagStr);
-        int i = 0;
-        
-        while (i < len) {
-            // Skip whitespace
-            while (i < len && isspace(tagStr[i])) i++;
-            if (i >= len) break;
-            
-            // Find attribute name
-            int nameStart = i;
-            while (i < len && !isspace(tagStr[i]) && tagStr[i] != '=') i++;
-            if (i == nameStart) break;
-            
-            char* attrName = substring(tagStr, nameStart, i - nameStart);
-            char* lowerName = toLowerCase(attrName);
-            
-            // Skip whitespace and =
-            while (i < len && (isspace(tagStr[i]) || tagStr[i] == '=')) i++;
-            
-            if (i < len && tagStr[i] == '"') {
-                i++; // Skip opening quote
-                int valueStart = i;
-                while (i < len && tagStr[i] != '"') i++;
-                if (i < len) {
-                    char* attrValue = substring(tagStr, valueStart, i - valueStart);
-                    attrs->insert(lowerName, attrValue);
-                    delete[] attrValue;
-                    i++; // Skip closing quote
-                }
-            }
-            
-            delete[] attrName;
-            delete[] lowerName;
+            std::cout << "Parsed in " << std::chrono::duration<double, std::milli>(parsed - started).count()
+                      << " ms, rendered in " << std::chrono::duration<double, std::milli>(rendered - parsed).count()
+                      << " ms: " << reload.reusedSubtrees << " subtrees reused ("
+                      << reload.reusedNodes << " of " << reload.nodes << " nodes), " << reload.renderedNodes
+                      << " nodes re-rendered" << std::endl;
         }
-    }
-    
-    Queue<Token*>* tokenize(const char* html) {
-        Queue<Token*>* tokens = new Queue<Token*>();
-        if (!html) return tokens;
-        
-        int len = strlen(html);
-        int i = 0;
-        
-        while (i < len) {
-            // Skip whitespace
-            while (i < len && isspace(html[i])) i++;
-            if (i >= len) break;
-            
-            if (html[i] == '<') {
-                // Found a tag
-                int tagStart = i;
-                i++;
-                
-                if (i >= len) break;
-                
-                // Check for closing tag
-                bool isClosing = false;
-                if (html[i] == '/') {
-                    isClosing = true;
-                    i++;
-                }
-                
-                // Find end of tag first
-                int tagEnd = tagStart + 1;
-                while (tagEnd < len && html[tagEnd] != '>') tagEnd++;
-                
-                // Check for self-closing (before >)
-                bool isSelfClose = false;
-                if (tagEnd < len && tagEnd > tagStart + 1 && html[tagEnd - 1] == '/') {
-                    isSelfClose = true;
-                }
-                
-                // Extract tag name
-                int nameStart = i;
-                while (i < len && i < tagEnd && html[i] != '>' && !isspace(html[i]) && html[i] != '/') {
-                    i++;
-                }
-                int nameLen = i - nameStart;
-                
-                if (nameLen > 0 && nameStart >= 0 && nameStart + nameLen <= len) {
-                    char* tagName = substring(html, nameStart, nameLen);
-                    if (tagName && strlen(tagName) > 0) {
-                        char* lowerTag = toLowerCase(tagName);
-                        if (lowerTag) {
-                            Token* token;
-                            if (isSelfClose && !isClosing) {
-                                token = createToken(SELF_CLOSE_TAG, lowerTag);
-                            } else if (isClosing) {
-                                token = createToken(CLOSE_TAG, lowerTag);
-                            } else {
-                                token = createToken(OPEN_TAG, lowerTag);
-                                // Extract full tag for attributes (only for opening tags)
-                                if (tagEnd > nameStart && tagEnd <= len) {
-                                    int fullTagLen = tagEnd - nameStart;
-                                    char* fullTag = substring(html, nameStart, fullTagLen);
-                                    if (fullTag) {
-                                        parseAttributes(fullTag, token->attributes);
-                                        delete[] fullTag;
-                                    }
-                                }
-                            }
-                            
-                            if (token) {
-                                tokens->enqueue(token);
-                            }
-                            
-                            delete[] lowerTag;
-                        }
-                        delete[] tagName;
-                    }
-                }
-                
-                // Skip to end of tag
-                i = tagEnd;
-                if (i < len) i++;
-            } else {
-                // Text content
-                int textStart = i;
-                while (i < len && html[i] != '<') i++;
-                int textLen = i - textStart;
-                
-                if (textLen > 0) {
-                    char* text = substring(html, textStart, textLen);
-                    trimString(text);
-                    if (strlen(text) > 0) {
-                        Token* token = createToken(TEXT, text);
-                        tokens->enqueue(token);
-                    }
-                    delete[] text;
-                }
-            }
-        }
-        
-        return tokens;
-    }
-    
-    HTMLNode* createNode(const char* tagName) {
-        HTMLNode* node = new HTMLNode();
-        node->tagName = copyString(tagName);
-        node->nodeId = nodeCounter++;
-        return node;
-    }
-    
-    void buildDOMTree(Queue<Token*>* tokens) {
-        root = nullptr;
-        Stack<HTMLNode*>* nodeStack = new Stack<HTMLNode*>();
-        HTMLNode* currentNode = nullptr;
-        
-        elementGraph = new Graph(1000);
-        
-        while (!tokens->isEmpty()) {
-            Token* token = tokens->dequeue();
-            
-            try {
-                if (token->type == OPEN_TAG) {
-                    // Validate tag
-                    bool isValid = tagRegistry->search(token->content);
-                    if (!isValid) {
-                        // Unknown tag (HTML5 or invalid) - handle gracefully
-                        throw std::runtime_error("Unknown tag encountered");
-                    }
-                    
-                    HTMLNode* newNode = createNode(token->content);
-                    
-                    // Attributes are stored in token but HashTable doesn't have iterator
-                    // For now, attributes are parsed but not copied to node
-                    // This can be enhanced later if needed
-                    
-                    if (!root) {
-                        root = newNode;
-                        currentNode = newNode;
-                    } else {
-                        if (currentNode) {
-                            currentNode->addChild(newNode);
-                        }
-                        currentNode = newNode;
-                    }
-                    
-                    nodeStack->push(newNode);
-                    elementGraph->addVertex(newNode->nodeId);
-                    
-                    if (newNode->parent) {
-                        elementGraph->addEdge(newNode->parent->nodeId, newNode->nodeId);
-                    }
-                    
-                } else if (token->type == CLOSE_TAG) {
-                    // Validate tag
-                    bool isValid = tagRegistry->search(token->content);
-                    if (!isValid) {
-                        throw std::runtime_error("Unknown closing tag");
-                    }
-                    
-                    // Pop stack until matching tag (don't delete nodes, they're in the tree)
-                    Stack<HTMLNode*>* tempStack = new Stack<HTMLNode*>();
-                    bool found = false;
-                    
-                    while (!nodeStack->isEmpty()) {
-                        HTMLNode* top = nodeStack->pop();
-                        if (top && strcmp(top->tagName, token->content) == 0) {
-                            found = true;
-                            // Don't delete - node is part of tree structure
-                            break;
-                        }
-                        tempStack->push(top);
-                    }
-                    
-                    // Push back unmatched nodes
-                    while (!tempStack->isEmpty()) {
-                        nodeStack->push(tempStack->pop());
-                    }
-                    delete tempStack;
-                    
-                    if (found) {
-                        if (!nodeStack->isEmpty()) {
-                            currentNode = nodeStack->peek();
-                        } else {
-                            currentNode = nullptr;
-                        }
-                    }
-                    
-                } else if (token->type == SELF_CLOSE_TAG) {
-                    bool isValid = tagRegistry->search(token->content);
-                    if (!isValid) {
-                        throw std::runtime_error("Unknown self-closing tag");
-                    }
-                    
-                    HTMLNode* newNode = createNode(token->content);
-                    if (currentNode) {
-                        currentNode->addChild(newNode);
-                    } else if (!root) {
-                        root = newNode;
-                    }
-                    
-                    elementGraph->addVertex(newNode->nodeId);
-                    if (newNode->parent) {
-                        elementGraph->addEdge(newNode->parent->nodeId, newNode->nodeId);
-                    }
-                    
-                } else if (token->type == TEXT) {
-                    if (currentNode) {
-                        if (!currentNode->textContent) {
-                            currentNode->textContent = copyString(token->content);
-                        } else {
-                            // Append text
-                            int oldLen = strlen(currentNode->textContent);
-                            int newLen = strlen(token->content);
-                            char* combined = new char[oldLen + newLen + 2];
-                            strcpy(combined, currentNode->textContent);
-                            strcat(combined, " ");
-                            strcat(combined, token->content);
-                            delete[] currentNode->textContent;
-                            currentNode->textContent = combined;
-                        }
-                    }
-                }
-            } catch (const std::exception& e) {
-                // Unknown tag - skip it but continue parsing
-                // Tag is already logged, continue
-            }
-            
-            delete token;
+        if (!watcher.waitForChange(error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
         }
-        
-        delete nodeStack;
-    }
-
-    bool tagEquals(HTMLNode* node, const char* name) {
-        return node && node->tagName && name && strcmp(node->tagName, name) == 0;
-    }
-
-    bool isInlineBold(HTMLNode* node) {
-        return tagEquals(node, "strong") || tagEquals(node, "b");
-    }
-
-    bool isInlineItalic(HTMLNode* node) {
-        return tagEquals(node, "em") || tagEquals(node, "i");
-    }
-
-    void appendTrimmed(std::string& out, const char* text) {
-        if (!text) return;
-        std::string t(text);
-        size_t start = t.find_first_not_of(" \t\r\n");
-        if (start == std::string::npos) return;
-        size_t end = t.find_last_not_of(" \t\r\n");
-        if (!out.empty()) out += " ";
-        out += t.substr(start, end - start + 1);
-    }
-
-    void appendWrapped(std::string& out, const char* marker, const std::string& inner) {
-        if (inner.empty()) return;
-        if (!out.empty()) out += " ";
-        out += marker;
-        out += inner;
-        out += marker;
     }
+}
 
-    void buildInlineText(HTMLNode* node, std::string& out) {
-        if (!node) return;
-        if (node->textContent && strlen(node->textContent) > 0) {
-            appendTrimmed(out, node->textContent);
-        }
+static void printPhase(std::ostream& out, const char* name, const PhaseTime& phase) {
+    out << "  " << name << ": " << phase.wallMs << " ms wall, " << phase.cpuMs << " ms cpu" << std::endl;
+}
 
-        HTMLNode* child = node->firstChild;
-        while (child) {
-            if (isInlineBold(child)) {
-                std::string inner;
-                buildInlineText(child, inner);
-                appendWrapped(out, "**", inner);
-            } else if (isInlineItalic(child)) {
-                std::string inner;
-                buildInlineText(child, inner);
-                appendWrapped(out, "*", inner);
-            } else if (tagEquals(child, "br")) {
-                if (!out.empty()) out += " ";
-            } else {
-                buildInlineText(child, out);
-            }
-            child = child->nextSibling;
-        }
+static void printStats(std::ostream& out, const ParseStats& stats) {
+    out << "Phases:" << std::endl;
+    printPhase(out, "read", stats.read);
+    printPhase(out, "tokenize", stats.tokenize);
+    printPhase(out, "tree build", stats.treeBuild);
+    printPhase(out, "title extraction", stats.titleExtraction);
+    printPhase(out, "render write", stats.renderWrite);
+    out << "Tokens: " << stats.openTags << " open, " << stats.closeTags << " close, " << stats.selfCloseTags
+        << " self-closing, " << stats.textTokens << " text" << std::endl;
+    out << "Nodes: " << stats.nodes << ", max depth " << stats.maxDepth << ", unknown tags skipped "
+        << stats.unknownTags << ", graph edges " << stats.graphEdges << std::endl;
+    out << "Skipped: " << stats.comments << " comments, " << stats.rawTextBytes << " script/style bytes"
+        << std::endl;
+    out << "Bytes: " << stats.inputBytes << " in, " << stats.textBytes << " text, " << stats.outputBytes << " out"
+        << std::endl;
+    if (stats.tokenizeChunks > 0) {
+        out << "Parallel tokenize: " << stats.tokenizeChunks << " chunks, " << stats.chunksRetokenized
+            << " re-tokenized" << std::endl;
     }
+}
 
-    void extractTitle(HTMLNode* node) {
-        if (!node || !pageTitle.empty()) return;
-        if (tagEquals(node, "title")) {
-            std::string text;
-            buildInlineText(node, text);
-            pageTitle = text;
-            return;
-        }
-        HTMLNode* child = node->firstChild;
-        while (child) {
-            extractTitle(child);
-            if (!pageTitle.empty()) return;
-            child = child->nextSibling;
-        }
-    }
-    
-    void writeNodeToFile(std::ofstream& file, HTMLNode* node, int indent) {
-        if (!node) return;
-        
-        for (int i = 0; i < indent; i++) {
-            file << "  ";
-        }
-        
-        if (node->tagName) {
-            file << "TAG:" << node->tagName << std::endl;
-        }
-        
-        if (node->textContent && strlen(node->textContent) > 0) {
-            for (int i = 0; i < indent + 1; i++) {
-                file << "  ";
-            }
-            file << "TEXT:" << node->textContent << std::endl;
-        }
-        
-        HTMLNode* child = node->firstChild;
-        while (child) {
-            writeNodeToFile(file, child, indent + 1);
-            child = child->nextSibling;
-        }
-    }
+static void printPhaseJson(std::ostream& out, const char* name, const PhaseTime& phase, bool last) {
+    out << "    \"" << name << "\": {\"wall_ms\": " << phase.wallMs << ", \"cpu_ms\": " << phase.cpuMs << "}"
+        << (last ? "" : ",") << "\n";
+}
 
-    void writeRenderNodes(std::ofstream& file, HTMLNode* node) {
-        if (!node) return;
+static void printStatsJson(std::ostream& out, const ParseStats& stats, bool withMemory) {
+    out << "{\n  \"phases\": {\n";
+    printPhaseJson(out, "read", stats.read, false);
+    printPhaseJson(out, "tokenize", stats.tokenize, false);
+    printPhaseJson(out, "tree_build", stats.treeBuild, false);
+    printPhaseJson(out, "title_extraction", stats.titleExtraction, false);
+    printPhaseJson(out, "render_write", stats.renderWrite, true);
+    out << "  },\n  \"tokens\": {\"open\": " << stats.openTags << ", \"close\": " << stats.closeTags
+        << ", \"self_close\": " << stats.selfCloseTags << ", \"text\": " << stats.textTokens << "},\n";
+    out << "  \"nodes\": " << stats.nodes << ",\n  \"max_depth\": " << stats.maxDepth
+        << ",\n  \"unknown_tags\": " << stats.unknownTags << ",\n  \"comments\": " << stats.comments
+        << ",\n  \"raw_text_bytes\": " << stats.rawTextBytes << ",\n  \"graph_edges\": " << stats.graphEdges
+        << ",\n  \"input_bytes\": " << stats.inputBytes << ",\n  \"text_bytes\": " << stats.textBytes
+        << ",\n  \"output_bytes\": " << stats.outputBytes << ",\n  \"tokenize_chunks\": " << stats.tokenizeChunks
+        << ",\n  \"chunks_retokenized\": " << stats.chunksRetokenized;
+    if (withMemory) {
+        out << ",\n  \"memory\": ";
+        printAllocStatsJson(out);
+    }
+    out << "\n}" << std::endl;
+}
 
-        if (tagEquals(node, "h1") || tagEquals(node, "h2") || tagEquals(node, "h3") || tagEquals(node, "p")) {
-            std::string text;
-            buildInlineText(node, text);
-            if (!text.empty()) {
-                if (tagEquals(node, "h1")) file << "H1: ";
-                else if (tagEquals(node, "h2")) file << "H2: ";
-                else if (tagEquals(node, "h3")) file << "H3: ";
-                else file << "P: ";
-                file << text << std::endl;
+int main(int argc, char* argv[]) {
+    if (argc > 2 && strcmp(argv[1], "--batch") == 0) {
+        return runBatchMode(argc, argv);
+    }
+    if (argc > 2 && strcmp(argv[1], "--load") == 0) {
+        return runLoadMode(argc, argv);
+    }
+    if (argc > 2 && strcmp(argv[1], "--watch") == 0) {
+        return runWatchMode(argc, argv);
+    }
+
+    // --stats, --stats=json, --memory, --drop-scripts, --stream, --threads N, --trace FILE and --snapshot FILE
+    // may go anywhere; the other arguments keep their positions
+    std::string statsFormat;
+    bool showMemory = false;
+    bool dropScripts = false;
+    bool streamRender = false;
+    int threads = 1;
+    std::string traceFile;
+    std::string snapshotFile;
+    std::vector<char*> args;
+    for (int i = 0; i < argc; i++) {
+        if (i > 0 && strcmp(argv[i], "--memory") == 0) {
+            showMemory = true;
+        } else if (i > 0 && strcmp(argv[i], "--drop-scripts") == 0) {
+            dropScripts = true;
+        } else if (i > 0 && strcmp(argv[i], "--stream") == 0) {
+            streamRender = true;
+        } else if (i > 0 && strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (i > 0 && strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (i > 0 && strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc) {
+            snapshotFile = argv[++i];
+        } else if (i > 0 && strcmp(argv[i], "--stats") == 0) {
+            statsFormat = "text";
+        } else if (i > 0 && strncmp(argv[i], "--stats=", 8) == 0) {
+            statsFormat = argv[i] + 8;
+            if (statsFormat != "json" && statsFormat != "text") {
+                std::cerr << "Unknown stats format " << statsFormat << " (use --stats or --stats=json)" << std::endl;
+                return 1;
             }
+        } else {
+            args.push_back(argv[i]);
         }
-
-        HTMLNode* child = node->firstChild;
-        while (child) {
-            writeRenderNodes(file, child);
-            child = child->nextSibling;
-        }
-    }
-    
-    void cleanupTree(HTMLNode* node) {
-        if (!node) return;
-        cleanupTree(node->firstChild);
-        cleanupTree(node->nextSibling);
-        delete node;
-    }
-
-public:
-    HTMLParser() : root(nullptr), tagRegistry(nullptr), elementGraph(nullptr), nodeCounter(0) {
-        initializeTagRegistry();
-    }
-    
-    ~HTMLParser() {
-        cleanupTree(root);
-        delete tagRegistry;
-        delete elementGraph;
-    }
-    
-    void parse(const char* html) {
-        Queue<Token*>* tokens = tokenize(html);
-        buildDOMTree(tokens);
-        
-        // Cleanup tokens queue
-        while (!tokens->isEmpty()) {
-            Token* token = tokens->dequeue();
-            delete token;
-        }
-        delete tokens;
-    }
-    
-    void writeDebugToFile(const char* filename) {
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Error: Cannot open file " << filename << " for writing" << std::endl;
-            return;
-        }
-        
-        if (root) {
-            writeNodeToFile(file, root, 0);
-        }
-        
-        file.close();
-    }
-
-    void writeRenderToFile(const char* filename) {
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Error: Cannot open file " << filename << " for writing" << std::endl;
-            return;
-        }
-
-        pageTitle.clear();
-        extractTitle(root);
-        if (!pageTitle.empty()) {
-            file << "TITLE: " << pageTitle << std::endl;
-        }
-
-        if (root) {
-            writeRenderNodes(file, root);
-        }
-
-        file.close();
     }
-    
-    HTMLNode* getRoot() {
-        return root;
-    }
-};
+    argc = static_cast<int>(args.size());
+    argv = args.data();
+    bool quiet = statsFormat == "json"; // stdout carries only the JSON
 
-// ============================================================================
-// MAIN FUNCTION
-// ============================================================================
-
-int main(int argc, char* argv[]) {
     const char* inputFile = "output.html";
     const char* outputFile = "page.txt";
     const char* debugFile = "parsed_output.txt";
@@ -1224,44 +257,91 @@ int main(int argc, char* argv[]) {
             debugFile = argv[4];
         }
     }
-    
-    std::cout << "Input HTML: " << inputFile << std::endl;
-    std::cout << "Render output: " << outputFile << std::endl;
-    if (writeDebug) {
-        std::cout << "Debug output: " << debugFile << std::endl;
-    }
-
-    // Read HTML file using C-style I/O
-    FILE* file = fopen(inputFile, "r");
-    if (!file) {
-        std::cerr << "Error: Cannot open file " << inputFile << std::endl;
+    if ((writeDebug || !snapshotFile.empty()) && streamRender) {
+        std::cerr << "Error: --debug and --snapshot need the whole tree, which --stream never keeps" << std::endl;
         return 1;
     }
     
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    // Allocate buffer
-    char* htmlContent = new char[fileSize + 1];
-    size_t bytesRead = fread(htmlContent, 1, fileSize, file);
-    htmlContent[bytesRead] = '\0';
-    fclose(file);
-    
-    // Parse HTML
+    if (!quiet) {
+        std::cout << "Input HTML: " << inputFile << std::endl;
+        std::cout << "Render output: " << outputFile << std::endl;
+        if (writeDebug) {
+            std::cout << "Debug output: " << debugFile << std::endl;
+        }
+    }
+
+    if (showMemory) enableMemoryAccounting();
+    if (!traceFile.empty()) enableTracing();
+
+    ParseStats stats;
+    ParseStats* statsTarget = statsFormat.empty() ? nullptr : &stats;
     HTMLParser parser;
-    parser.parse(htmlContent);
+    parser.setStats(statsTarget);
+    parser.setDropRawText(dropScripts);
+
+    // Blocks are written as they close and freed, so memory stays flat however big the file is
+    if (streamRender) {
+        if (!parser.streamRenderToFile(inputFile, outputFile)) return 1;
+    } else {
+        // Read HTML file using C-style I/O
+        TraceScope readSpan("io", "read input");
+        PhaseTimer readTimer(statsTarget ? &stats.read : nullptr);
+        FILE* file = fopen(inputFile, "rb"); // binary: UTF-16 and CR bytes reach the charset step untouched
+        if (!file) {
+            std::cerr << "Error: Cannot open file " << inputFile << std::endl;
+            return 1;
+        }
+    
+        // Get file size
+        fseek(file, 0, SEEK_END);
+        long fileSize = ftell(file);
+        fseek(file, 0, SEEK_SET);
+    
+        // Allocate buffer
+        char* htmlContent = new char[fileSize + 1];
+        size_t bytesRead = fread(htmlContent, 1, fileSize, file);
+        htmlContent[bytesRead] = '\0';
+        fclose(file);
+
+        // BOM or <meta charset>, else sniffed; ASCII and valid UTF-8 are parsed in place
+        std::string transcoded;
+        const char* html = decodeHtmlDocument(htmlContent, bytesRead, "", transcoded);
+        readTimer.stop();
+        readSpan.stop();
+        stats.inputBytes = static_cast<long long>(bytesRead);
+    
+        // Parse HTML; with --threads the tokenizer splits one big page over several threads
+        if (threads > 1) {
+            parser.parseParallel(html, threads);
+        } else {
+            parser.parse(html);
+        }
     
-    // Write output
-    parser.writeRenderToFile(outputFile);
-    if (writeDebug) {
-        parser.writeDebugToFile(debugFile);
-    }
+        // Write output; --threads also spreads collecting the render blocks
+        parser.writeRenderToFile(outputFile, threads);
+        if (writeDebug) {
+            parser.writeDebugToFile(debugFile);
+        }
+        std::string error;
+        if (!snapshotFile.empty() && !writeDomSnapshot(snapshotFile.c_str(), parser, error)) {
+            std::cerr << "Error: " << error << std::endl;
+        }
     
-    delete[] htmlContent;
+        delete[] htmlContent;
+    }
     
-    std::cout << "HTML parsing completed. Output written to " << outputFile << std::endl;
+    // Live bytes are taken while the parser still holds the document
+    if (statsFormat == "json") {
+        printStatsJson(std::cout, stats, showMemory);
+    } else {
+        std::cout << "HTML parsing completed. Output written to " << outputFile << std::endl;
+        if (statsTarget) printStats(std::cout, stats);
+        if (showMemory) printAllocStats(std::cout);
+    }
+    std::string error;
+    if (!traceFile.empty() && !writeTraceFile(traceFile, error)) {
+        std::cerr << "Error: " << error << std::endl;
+    }
     
     return 0;
 }
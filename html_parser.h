@@ -0,0 +1,2560 @@
+#ifndef HTML_PARSER_H
+#define HTML_PARSER_H
+
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include "charset.h"
+#include "html_entities.h"
+#include "memory_accounting.h"
+#include "phase_timer.h"
+#include "trace_events.h"
+
+// ============================================================================
+// STRING UTILITY FUNCTIONS (Manual implementation)
+// ============================================================================
+
+// ASCII only: bytes of multi-byte UTF-8 characters are never spaces or letters
+inline bool isAsciiSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline char toAsciiLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline char* copyString(const char* str) {
+    if (!str) return nullptr;
+    int len = strlen(str);
+    char* result = new char[len + 1];
+    strcpy(result, str);
+    return result;
+}
+
+inline char* substring(const char* str, int start, int len) {
+    if (!str || start < 0 || len < 0) return nullptr;
+    int strLen = strlen(str);
+    if (start >= strLen) return nullptr;
+    if (start + len > strLen) len = strLen - start;
+    if (len <= 0) return nullptr;
+    char* result = new char[len + 1];
+    if (!result) return nullptr;
+    strncpy(result, str + start, len);
+    result[len] = '\0';
+    return result;
+}
+
+// Copies len bytes from str; unlike substring it never measures the rest of
+// the string, so the tokenizer's copies cost their own length only
+inline char* copyRange(const char* str, int len) {
+    if (!str || len <= 0) return nullptr;
+    char* result = new char[len + 1];
+    memcpy(result, str, len);
+    result[len] = '\0';
+    return result;
+}
+
+inline void trimString(char* str) {
+    if (!str) return;
+    int start = 0;
+    while (str[start] && isAsciiSpace(str[start])) start++;
+    int end = strlen(str) - 1;
+    while (end >= start && isAsciiSpace(str[end])) end--;
+    int len = end - start + 1;
+    memmove(str, str + start, len);
+    str[len] = '\0';
+}
+
+inline bool isHtmlSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+}
+
+// Collapses each run of HTML whitespace (space, tab, CR, LF, FF) into one
+// space and drops it at both ends, in place and in one pass. Sixteen bytes
+// are classified at a time; a block whose only whitespace is single spaces
+// (most of any prose) is moved whole.
+inline void collapseWhitespace(char* str) {
+    if (!str) return;
+    char* r = str;
+    char* end = str + strlen(str);
+    char* w = str;
+    bool afterSpace = true; // also true at the start, so leading whitespace goes
+#ifdef CHARSET_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i ff = _mm_set1_epi8('\f');
+    while (end - r >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r));
+        int spaces = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, space));
+        int others = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, lf)),
+                                                    _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, ff))));
+        if (!others && !(spaces & (spaces << 1)) && !(afterSpace && (spaces & 1))) {
+            // w never passes r, so the store only covers bytes already loaded
+            if (w != r) _mm_storeu_si128(reinterpret_cast<__m128i*>(w), chunk);
+            w += 16;
+            r += 16;
+            afterSpace = (spaces & 0x8000) != 0;
+            continue;
+        }
+        for (char* blockEnd = r + 16; r < blockEnd; r++) {
+            if (isHtmlSpace(*r)) {
+                if (!afterSpace) *w++ = ' ';
+                afterSpace = true;
+            } else {
+                *w++ = *r;
+                afterSpace = false;
+            }
+        }
+    }
+#endif
+    for (; r < end; r++) {
+        if (isHtmlSpace(*r)) {
+            if (!afterSpace) *w++ = ' ';
+            afterSpace = true;
+        } else {
+            *w++ = *r;
+            afterSpace = false;
+        }
+    }
+    if (w > str && w[-1] == ' ') w--;
+    *w = '\0';
+}
+
+// Replaces str with a copy whose character references are decoded. Strings
+// without an '&' are left as they are, so they cost no allocation.
+inline void decodeEntities(char*& str, bool inAttribute) {
+    if (!str) return;
+    size_t len = strlen(str);
+    if (findAmpersand(str, str + len) == str + len) return;
+    char* decoded = new char[decodedEntitiesCapacity(len)];
+    decoded[decodeHtmlEntities(str, len, decoded, inAttribute)] = '\0';
+    delete[] str;
+    str = decoded;
+}
+
+// ============================================================================
+// FILE INPUT
+// ============================================================================
+
+// Reads the file at path byte for byte into out; shared by html_parser, the
+// batch runner and the page pipeline
+inline bool readWholeFile(const std::string& path, std::string& out) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    out.clear();
+    char buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        out.append(buffer, n);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+// ============================================================================
+// MARKUP SKIPPING (comments, doctypes, script and style bodies)
+// ============================================================================
+
+// First p in [p, end) with p[0] == a and p[1] == b, or end. Each step tests
+// sixteen starting positions, so long bodies are crossed at memory speed.
+inline const char* findBytePair(const char* p, const char* end, char a, char b) {
+#ifdef CHARSET_SSE2
+    const __m128i first = _mm_set1_epi8(a);
+    const __m128i second = _mm_set1_epi8(b);
+    while (end - p >= 17) {
+        __m128i at = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+        int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(at, first), _mm_cmpeq_epi8(next, second)));
+        if (mask) return p + lowestSetBit(mask);
+        p += 16;
+    }
+#endif
+    for (; end - p >= 2; p++) {
+        if (p[0] == a && p[1] == b) return p;
+    }
+    return end;
+}
+
+// lt points at "<!" or "<?": a comment, doctype, CDATA section or
+// processing instruction. Returns just past it, or nullptr if it does not
+// end before end. Comments end at the first "-->", even one that follows
+// "<!--" directly, the way browsers close "<!-->". A from past lt resumes
+// a search that already found no end before it.
+inline const char* skipMarkupDeclaration(const char* lt, const char* end, const char* from = nullptr) {
+    if (end - lt >= 4 && lt[1] == '!' && lt[2] == '-' && lt[3] == '-') {
+        for (const char* q = from && from > lt + 2 ? from : lt + 2;; q++) {
+            q = findBytePair(q, end, '-', '-');
+            if (end - q < 3) return nullptr;
+            if (q[2] == '>') return q + 3;
+        }
+    }
+    const char* p = from && from > lt + 1 ? from : lt + 1;
+    const void* gt = memchr(p, '>', static_cast<size_t>(end - p));
+    return gt ? static_cast<const char*>(gt) + 1 : nullptr;
+}
+
+// "script" or "style" when the tag [lt, gt] opens one of those elements,
+// whose bodies are raw text, not markup
+inline const char* rawTextElement(const char* lt, const char* gt) {
+    static const char* const names[2] = {"script", "style"};
+    if (gt[-1] == '/') return nullptr;
+    for (const char* name : names) {
+        size_t n = strlen(name);
+        if (static_cast<size_t>(gt - lt - 1) < n) continue;
+        size_t k = 0;
+        while (k < n && toAsciiLower(lt[1 + k]) == name[k]) k++;
+        if (k == n && (lt + 1 + n == gt || isAsciiSpace(lt[1 + n]) || lt[1 + n] == '/')) return name;
+    }
+    return nullptr;
+}
+
+// Where the body starting at p ends: the '<' of the first "</name" followed
+// by a space, '/' or '>'. end when there is none yet.
+inline const char* findRawTextEnd(const char* p, const char* end, const char* name) {
+    size_t n = strlen(name);
+    while (true) {
+        p = findBytePair(p, end, '<', '/');
+        if (p == end || static_cast<size_t>(end - p) < n + 3) return end;
+        size_t k = 0;
+        while (k < n && toAsciiLower(p[2 + k]) == name[k]) k++;
+        char after = p[2 + n];
+        if (k == n && (isAsciiSpace(after) || after == '/' || after == '>')) return p;
+        p++;
+    }
+}
+
+// Elements that have no end tag and no content (the known tags among them)
+inline bool isVoidElement(const char* tag) {
+    static const char* const names[7] = {"br", "hr", "img", "input", "meta", "link", "base"};
+    for (const char* name : names) {
+        if (strcmp(tag, name) == 0) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// LINKED LIST CLASS
+// ============================================================================
+
+template<typename T>
+class LinkedList {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node(T d) : data(d), next(nullptr) {}
+    };
+    Node* head;
+    int size;
+
+public:
+    LinkedList() : head(nullptr), size(0) {}
+    
+    ~LinkedList() {
+        clear();
+    }
+    
+    void insert(T data) {
+        Node* newNode = new Node(data);
+        if (!head) {
+            head = newNode;
+        } else {
+            Node* current = head;
+            while (current->next) {
+                current = current->next;
+            }
+            current->next = newNode;
+        }
+        size++;
+    }
+    
+    void insertFront(T data) {
+        Node* newNode = new Node(data);
+        newNode->next = head;
+        head = newNode;
+        size++;
+    }
+    
+    bool remove(T data) {
+        if (!head) return false;
+        if (head->data == data) {
+            Node* temp = head;
+            head = head->next;
+            delete temp;
+            size--;
+            return true;
+        }
+        Node* current = head;
+        while (current->next) {
+            if (current->next->data == data) {
+                Node* temp = current->next;
+                current->next = temp->next;
+                delete temp;
+                size--;
+                return true;
+            }
+            current = current->next;
+        }
+        return false;
+    }
+    
+    bool search(T data) {
+        Node* current = head;
+        while (current) {
+            if (current->data == data) return true;
+            current = current->next;
+        }
+        return false;
+    }
+    
+    bool isEmpty() const {
+        return head == nullptr;
+    }
+    
+    int getSize() const {
+        return size;
+    }
+    
+    T getFront() {
+        if (head) return head->data;
+        return T();
+    }
+    
+    void clear() {
+        while (head) {
+            Node* temp = head;
+            head = head->next;
+            delete temp;
+        }
+        size = 0;
+    }
+    
+    Node* getHead() const {
+        return head;
+    }
+};
+
+// ============================================================================
+// STACK CLASS
+// ============================================================================
+
+template<typename T>
+class Stack {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node(T d) : data(d), next(nullptr) {}
+    };
+    Node* top;
+    int size;
+
+    void copyFrom(const Stack& other) {
+        // Rebuild bottom-up so the copy pops in the same order
+        std::vector<T> items;
+        for (Node* n = other.top; n; n = n->next) items.push_back(n->data);
+        for (size_t i = items.size(); i > 0; i--) push(items[i - 1]);
+    }
+
+public:
+    Stack() : top(nullptr), size(0) {}
+
+    Stack(const Stack& other) : top(nullptr), size(0) {
+        copyFrom(other);
+    }
+
+    Stack& operator=(const Stack& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    
+    ~Stack() {
+        clear();
+    }
+    
+    void push(T data) {
+        Node* newNode = new Node(data);
+        newNode->next = top;
+        top = newNode;
+        size++;
+    }
+    
+    T pop() {
+        if (!top) return T();
+        Node* temp = top;
+        T data = top->data;
+        top = top->next;
+        delete temp;
+        size--;
+        return data;
+    }
+    
+    T peek() const {
+        if (!top) return T();
+        return top->data;
+    }
+    
+    bool isEmpty() const {
+        return top == nullptr;
+    }
+    
+    int getSize() const {
+        return size;
+    }
+    
+    void clear() {
+        while (top) {
+            Node* temp = top;
+            top = top->next;
+            delete temp;
+        }
+        size = 0;
+    }
+};
+
+// ============================================================================
+// QUEUE CLASS
+// ============================================================================
+
+template<typename T>
+class Queue {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node(T d) : data(d), next(nullptr) {}
+    };
+    Node* front;
+    Node* rear;
+    int size;
+
+public:
+    Queue() : front(nullptr), rear(nullptr), size(0) {}
+    
+    ~Queue() {
+        clear();
+    }
+    
+    void enqueue(T data) {
+        Node* newNode = new Node(data);
+        if (!rear) {
+            front = rear = newNode;
+        } else {
+            rear->next = newNode;
+            rear = newNode;
+        }
+        size++;
+    }
+    
+    T dequeue() {
+        if (!front) return T();
+        Node* temp = front;
+        T data = front->data;
+        front = front->next;
+        if (!front) rear = nullptr;
+        delete temp;
+        size--;
+        return data;
+    }
+    
+    T peek() const {
+        if (!front) return T();
+        return front->data;
+    }
+    
+    bool isEmpty() const {
+        return front == nullptr;
+    }
+    
+    int getSize() const {
+        return size;
+    }
+    
+    void clear() {
+        while (front) {
+            Node* temp = front;
+            front = front->next;
+            delete temp;
+        }
+        rear = nullptr;
+        size = 0;
+    }
+};
+
+// ============================================================================
+// HASH TABLE CLASS
+// ============================================================================
+
+class HashTable {
+private:
+    struct HashNode {
+        char* key;
+        char* value;
+        HashNode* next;
+        HashNode(const char* k, const char* v) {
+            key = copyString(k);
+            value = copyString(v);
+            next = nullptr;
+        }
+        ~HashNode() {
+            delete[] key;
+            delete[] value;
+        }
+    };
+    
+    static const int TABLE_SIZE = 101;
+    HashNode** buckets;
+    int size;
+
+    int hashFunction(const char* key) {
+        int hash = 0;
+        for (int i = 0; key[i]; i++) {
+            hash = (hash * 31 + key[i]) % TABLE_SIZE;
+        }
+        return hash;
+    }
+
+public:
+    HashTable() : size(0) {
+        buckets = new HashNode*[TABLE_SIZE];
+        for (int i = 0; i < TABLE_SIZE; i++) {
+            buckets[i] = nullptr;
+        }
+    }
+    
+    ~HashTable() {
+        clear();
+        delete[] buckets;
+    }
+    
+    void insert(const char* key, const char* value) {
+        int index = hashFunction(key);
+        HashNode* current = buckets[index];
+        
+        // Check if key already exists
+        while (current) {
+            if (strcmp(current->key, key) == 0) {
+                delete[] current->value;
+                current->value = copyString(value);
+                return;
+            }
+            current = current->next;
+        }
+        
+        // Insert new node at front of chain
+        HashNode* newNode = new HashNode(key, value);
+        newNode->next = buckets[index];
+        buckets[index] = newNode;
+        size++;
+    }
+    
+    char* get(const char* key) {
+        int index = hashFunction(key);
+        HashNode* current = buckets[index];
+        while (current) {
+            if (strcmp(current->key, key) == 0) {
+                return current->value;
+            }
+            current = current->next;
+        }
+        return nullptr;
+    }
+    
+    bool contains(const char* key) {
+        return get(key) != nullptr;
+    }
+    
+    void remove(const char* key) {
+        int index = hashFunction(key);
+        HashNode* current = buckets[index];
+        HashNode* prev = nullptr;
+        
+        while (current) {
+            if (strcmp(current->key, key) == 0) {
+                if (prev) {
+                    prev->next = current->next;
+                } else {
+                    buckets[index] = current->next;
+                }
+                delete current;
+                size--;
+                return;
+            }
+            prev = current;
+            current = current->next;
+        }
+    }
+    
+    int getSize() const {
+        return size;
+    }
+    
+    // Calls visit(key, value) for every entry, bucket by bucket
+    template <typename Visit>
+    void forEach(Visit visit) const {
+        for (int i = 0; i < TABLE_SIZE; i++) {
+            for (HashNode* current = buckets[i]; current; current = current->next) {
+                visit(current->key, current->value);
+            }
+        }
+    }
+    
+    void clear() {
+        for (int i = 0; i < TABLE_SIZE; i++) {
+            while (buckets[i]) {
+                HashNode* temp = buckets[i];
+                buckets[i] = buckets[i]->next;
+                delete temp;
+            }
+        }
+        size = 0;
+    }
+};
+
+// ============================================================================
+// AVL TREE CLASS (for tag indexing)
+// ============================================================================
+
+class AVLTree {
+private:
+    struct AVLNode {
+        char* data;
+        AVLNode* left;
+        AVLNode* right;
+        int height;
+        
+        AVLNode(const char* d) {
+            data = copyString(d);
+            left = right = nullptr;
+            height = 1;
+        }
+        
+        ~AVLNode() {
+            delete[] data;
+        }
+    };
+    
+    AVLNode* root;
+    
+    int getHeight(AVLNode* node) {
+        return node ? node->height : 0;
+    }
+    
+    int getBalance(AVLNode* node) {
+        return node ? getHeight(node->left) - getHeight(node->right) : 0;
+    }
+    
+    void updateHeight(AVLNode* node) {
+        if (node) {
+            int leftHeight = getHeight(node->left);
+            int rightHeight = getHeight(node->right);
+            node->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+        }
+    }
+    
+    AVLNode* rotateRight(AVLNode* y) {
+        if (!y || !y->left) return y;
+        AVLNode* x = y->left;
+        AVLNode* T2 = x->right;
+        
+        x->right = y;
+        y->left = T2;
+        
+        updateHeight(y);
+        updateHeight(x);
+        
+        return x;
+    }
+    
+    AVLNode* rotateLeft(AVLNode* x) {
+        if (!x || !x->right) return x;
+        AVLNode* y = x->right;
+        AVLNode* T2 = y->left;
+        
+        y->left = x;
+        x->right = T2;
+        
+        updateHeight(x);
+        updateHeight(y);
+        
+        return y;
+    }
+    
+    AVLNode* insertHelper(AVLNode* node, const char* data) {
+        if (!node) {
+            return new AVLNode(data);
+        }
+        
+        int cmp = strcmp(data, node->data);
+        if (cmp < 0) {
+            node->left = insertHelper(node->left, data);
+        } else if (cmp > 0) {
+            node->right = insertHelper(node->right, data);
+        } else {
+            return node; // Duplicate
+        }
+        
+        updateHeight(node);
+        
+        int balance = getBalance(node);
+        
+        // Left Left Case
+        if (balance > 1 && node->left && strcmp(data, node->left->data) < 0) {
+            return rotateRight(node);
+        }
+        
+        // Right Right Case
+        if (balance < -1 && node->right && strcmp(data, node->right->data) > 0) {
+            return rotateLeft(node);
+        }
+        
+        // Left Right Case
+        if (balance > 1 && node->left && strcmp(data, node->left->data) > 0) {
+            node->left = rotateLeft(node->left);
+            return rotateRight(node);
+        }
+        
+        // Right Left Case
+        if (balance < -1 && node->right && strcmp(data, node->right->data) < 0) {
+            node->right = rotateRight(node->right);
+            return rotateLeft(node);
+        }
+        
+        return node;
+    }
+    
+    bool searchHelper(const AVLNode* node, const char* data) const {
+        if (!node) return false;
+        
+        int cmp = strcmp(data, node->data);
+        if (cmp == 0) return true;
+        if (cmp < 0) return searchHelper(node->left, data);
+        return searchHelper(node->right, data);
+    }
+    
+    void clearHelper(AVLNode* node) {
+        if (node) {
+            clearHelper(node->left);
+            clearHelper(node->right);
+            delete node;
+        }
+    }
+
+public:
+    AVLTree() : root(nullptr) {}
+    
+    ~AVLTree() {
+        clear();
+    }
+    
+    void insert(const char* data) {
+        root = insertHelper(root, data);
+    }
+    
+    // Read-only, so one tree can be shared by parsers on different threads
+    bool search(const char* data) const {
+        return searchHelper(root, data);
+    }
+    
+    void clear() {
+        clearHelper(root);
+        root = nullptr;
+    }
+};
+
+// ============================================================================
+// GRAPH CLASS (adjacency list representation)
+// ============================================================================
+
+class Graph {
+private:
+    struct GraphNode {
+        int vertex;
+        GraphNode* next;
+        GraphNode(int v) : vertex(v), next(nullptr) {}
+    };
+    
+    GraphNode** adjList;
+    int numVertices;
+    int maxVertices;
+    int numEdges;
+
+public:
+    Graph(int maxV = 1000) : numVertices(0), maxVertices(maxV), numEdges(0) {
+        AllocScope scope(ALLOC_GRAPH);
+        adjList = new GraphNode*[maxVertices];
+        for (int i = 0; i < maxVertices; i++) {
+            adjList[i] = nullptr;
+        }
+    }
+    
+    ~Graph() {
+        for (int i = 0; i < maxVertices; i++) {
+            GraphNode* current = adjList[i];
+            while (current) {
+                GraphNode* temp = current;
+                current = current->next;
+                delete temp;
+            }
+        }
+        delete[] adjList;
+    }
+    
+    void addVertex(int v) {
+        if (v >= 0 && v < maxVertices && v >= numVertices) {
+            numVertices = v + 1;
+        }
+    }
+    
+    void addEdge(int src, int dest) {
+        if (src >= 0 && src < maxVertices && dest >= 0 && dest < maxVertices) {
+            addVertex(src);
+            addVertex(dest);
+            AllocScope scope(ALLOC_GRAPH);
+            GraphNode* newNode = new GraphNode(dest);
+            newNode->next = adjList[src];
+            adjList[src] = newNode;
+            numEdges++;
+        }
+    }
+    
+    // Room for vertices 0..capacity-1; existing edges are kept
+    void ensureCapacity(int capacity) {
+        if (capacity <= maxVertices) return;
+        AllocScope scope(ALLOC_GRAPH);
+        GraphNode** grown = new GraphNode*[capacity];
+        for (int i = 0; i < capacity; i++) {
+            grown[i] = i < maxVertices ? adjList[i] : nullptr;
+        }
+        delete[] adjList;
+        adjList = grown;
+        maxVertices = capacity;
+    }
+    
+    // Targets of v's edges, oldest first
+    std::vector<int> getNeighbors(int v) const {
+        std::vector<int> out;
+        if (v < 0 || v >= numVertices) return out;
+        for (GraphNode* current = adjList[v]; current; current = current->next) {
+            out.push_back(current->vertex);
+        }
+        std::reverse(out.begin(), out.end());
+        return out;
+    }
+    
+    void printGraph() {
+        for (int i = 0; i < numVertices; i++) {
+            std::cout << "Vertex " << i << ": ";
+            GraphNode* current = adjList[i];
+            while (current) {
+                std::cout << current->vertex << " ";
+                current = current->next;
+            }
+            std::cout << std::endl;
+        }
+    }
+    
+    int getNumVertices() const {
+        return numVertices;
+    }
+    
+    int getNumEdges() const {
+        return numEdges;
+    }
+};
+
+// ============================================================================
+// HTML NODE STRUCTURE (General Tree for DOM)
+// ============================================================================
+
+enum TokenType {
+    OPEN_TAG,
+    CLOSE_TAG,
+    TEXT,
+    SELF_CLOSE_TAG
+};
+
+// What the tokenizer carries from one piece of input to the next
+struct TokenizerState {
+    int preDepth = 0;       // open <pre> elements
+    bool preStart = false;  // a <pre> just opened: a newline right after it is dropped
+
+    bool operator==(const TokenizerState& other) const {
+        return preDepth == other.preDepth && preStart == other.preStart;
+    }
+};
+
+struct Token {
+    TokenType type;
+    char* content;
+    HashTable* attributes;
+    bool preformatted; // text inside <pre>: whitespace kept as written
+    
+    Token() : type(TEXT), content(nullptr), attributes(nullptr), preformatted(false) {}
+    
+    ~Token() {
+        delete[] content;
+        delete attributes;
+    }
+};
+
+struct HTMLNode {
+    char* tagName;
+    char* textContent;
+    HashTable* attributes;
+    HTMLNode* parent;
+    HTMLNode* firstChild;
+    HTMLNode* lastChild; // where addChild appends, so wide parents don't walk their children
+    HTMLNode* nextSibling;
+    int depth;
+    int nodeId; // For graph representation
+    bool rendered; // incremental mode: blocks in this subtree were already emitted
+    bool inDocument; // incremental mode: hangs under the root, not a detached element
+    int textAncestors; // incremental mode: h1-h3/p and title elements above this one
+    uint64_t subtreeHash; // content of the whole subtree, set by hashSubtree
+    
+    HTMLNode() {
+        tagName = nullptr;
+        textContent = nullptr;
+        AllocScope scope(ALLOC_ATTRIBUTES);
+        attributes = new HashTable();
+        parent = nullptr;
+        firstChild = nullptr;
+        lastChild = nullptr;
+        nextSibling = nullptr;
+        depth = 0;
+        nodeId = -1;
+        rendered = false;
+        inDocument = false;
+        textAncestors = 0;
+        subtreeHash = 0;
+    }
+    
+    ~HTMLNode() {
+        delete[] tagName;
+        delete[] textContent;
+        delete attributes;
+        // Children and siblings are managed by tree cleanup
+    }
+    
+    void addChild(HTMLNode* child) {
+        if (!child) return;
+        child->parent = this;
+        child->depth = this->depth + 1;
+        
+        if (!firstChild) {
+            firstChild = child;
+        } else {
+            lastChild->nextSibling = child;
+        }
+        lastChild = child;
+    }
+    
+    void addSibling(HTMLNode* sibling) {
+        if (!sibling) return;
+        HTMLNode* current = this;
+        while (current->nextSibling) {
+            current = current->nextSibling;
+        }
+        current->nextSibling = sibling;
+        if (this->parent) this->parent->lastChild = sibling;
+        sibling->parent = this->parent;
+        sibling->depth = this->depth;
+    }
+    
+    // Unlinks child (and only child) from this node's child list
+    void removeChild(HTMLNode* child) {
+        HTMLNode* previous = nullptr;
+        HTMLNode** link = &firstChild;
+        while (*link && *link != child) {
+            previous = *link;
+            link = &(*link)->nextSibling;
+        }
+        if (!*link) return;
+        *link = child->nextSibling;
+        if (lastChild == child) lastChild = previous;
+        child->nextSibling = nullptr;
+        child->parent = nullptr;
+    }
+};
+
+// ============================================================================
+// SUBTREE HASHING (equal hashes: same tags, text and attributes all the way down)
+// ============================================================================
+
+inline uint64_t mixHash(uint64_t h, uint64_t value) {
+    return h ^ (value + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+// FNV-1a; a null string hashes like an empty one
+inline uint64_t hashText(const char* str) {
+    uint64_t h = 14695981039346656037ULL;
+    for (; str && *str; str++) {
+        h ^= static_cast<unsigned char>(*str);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Fills in subtreeHash for node and everything below it and returns node's.
+// Children are mixed in order; attributes are summed, so the order they sit
+// in the hash table does not matter. A node is hashed once its children are,
+// on a Stack so deep pages don't overflow the call stack.
+inline uint64_t hashSubtree(HTMLNode* root) {
+    if (!root) return 0;
+    Stack<std::pair<HTMLNode*, bool>> pending; // second: its children are hashed
+    pending.push(std::make_pair(root, false));
+    while (!pending.isEmpty()) {
+        std::pair<HTMLNode*, bool> next = pending.pop();
+        HTMLNode* node = next.first;
+        if (!next.second) {
+            pending.push(std::make_pair(node, true));
+            for (HTMLNode* child = node->firstChild; child; child = child->nextSibling) {
+                pending.push(std::make_pair(child, false));
+            }
+            continue;
+        }
+        uint64_t attributes = 0;
+        if (node->attributes && node->attributes->getSize() > 0) {
+            node->attributes->forEach([&attributes](const char* key, const char* value) {
+                attributes += mixHash(hashText(key), hashText(value));
+            });
+        }
+        uint64_t h = mixHash(mixHash(hashText(node->tagName), hashText(node->textContent)), attributes);
+        for (HTMLNode* child = node->firstChild; child; child = child->nextSibling) {
+            h = mixHash(h, child->subtreeHash);
+        }
+        node->subtreeHash = h;
+    }
+    return root->subtreeHash;
+}
+
+// ============================================================================
+// RENDER DOCUMENT (what the GUI draws and page.txt stores)
+// ============================================================================
+
+enum RenderKind {
+    RENDER_H1,
+    RENDER_H2,
+    RENDER_H3,
+    RENDER_P
+};
+
+struct RenderBlock {
+    RenderKind kind;
+    std::string text;
+};
+
+// An <a href> on the page, in document order; href is as written (unresolved)
+struct RenderLink {
+    std::string href;
+    std::string rel;
+    std::string text;
+};
+
+struct RenderDocument {
+    std::string title;
+    std::vector<RenderBlock> blocks;
+    std::vector<RenderLink> links;
+};
+
+inline const char* renderKindPrefix(RenderKind kind) {
+    switch (kind) {
+    case RENDER_H1: return "H1: ";
+    case RENDER_H2: return "H2: ";
+    case RENDER_H3: return "H3: ";
+    default: return "P: ";
+    }
+}
+
+typedef std::function<void(const RenderBlock& block)> RenderBlockSink;
+
+// ============================================================================
+// RENDER EXTRACTION (the same rules for the live tree and dom_snapshot.h)
+// ============================================================================
+
+// A tree a RenderWalker can read. Node is a pointer, null for "none";
+// tag, text and attribute may return nullptr.
+struct LiveDom {
+    typedef HTMLNode* Node;
+    const char* tag(Node node) const { return node->tagName; }
+    const char* text(Node node) const { return node->textContent; }
+    Node firstChild(Node node) const { return node->firstChild; }
+    Node nextSibling(Node node) const { return node->nextSibling; }
+    const char* attribute(Node node, const char* name) const {
+        return node->attributes ? node->attributes->get(name) : nullptr;
+    }
+};
+
+template <typename Tree>
+class RenderWalker {
+public:
+    typedef typename Tree::Node Node;
+
+    explicit RenderWalker(const Tree& t) : tree(t) {}
+
+    bool tagEquals(Node node, const char* name) const {
+        const char* tag = node ? tree.tag(node) : nullptr;
+        return tag && name && strcmp(tag, name) == 0;
+    }
+
+    bool isInlineBold(Node node) const {
+        return tagEquals(node, "strong") || tagEquals(node, "b");
+    }
+
+    bool isInlineItalic(Node node) const {
+        return tagEquals(node, "em") || tagEquals(node, "i");
+    }
+
+    // Collects the text of one block or link. Text was collapsed when it was
+    // tokenized, so pieces only need one space between them; <pre> text goes
+    // in exactly as written. Bold and italic elements wrap their text in
+    // markers, the opening one written when text first turns up inside, so an
+    // element with no text leaves nothing and nothing is ever copied twice.
+    class InlineWriter {
+    public:
+        explicit InlineWriter(std::string& out) : out(out) {}
+
+        void text(const char* text, bool pre) {
+            if (!text || !*text) return;
+            openWraps();
+            if (!pre && out.size() > wrapStart(opened) && out.back() != ' ') out += ' ';
+            out += text;
+        }
+
+        // <br>: a space, or a line break inside <pre>
+        void lineBreak(bool pre) {
+            if (pre) {
+                openWraps();
+                out += '\n';
+            } else if (opened == wraps.size() && out.size() > wrapStart(opened) && out.back() != ' ') {
+                out += ' ';
+            }
+        }
+
+        void beginWrap(const char* marker) { wraps.push_back({marker, 0}); }
+
+        void endWrap() {
+            if (opened == wraps.size()) {
+                out += wraps.back().marker;
+                opened--;
+            }
+            wraps.pop_back();
+        }
+
+    private:
+        struct Wrap {
+            const char* marker; // "**" or "*"
+            size_t start;       // where its text begins in out, once opened
+        };
+
+        std::string& out;
+        std::vector<Wrap> wraps; // bold and italic elements around the current node
+        size_t opened = 0;       // how many of them have their opening marker written
+
+        // Where the text inside the first `depth` wraps begins
+        size_t wrapStart(size_t depth) const { return depth == 0 ? 0 : wraps[depth - 1].start; }
+
+        void openWraps() {
+            for (; opened < wraps.size(); opened++) {
+                if (out.size() > wrapStart(opened) && out.back() != ' ') out += ' ';
+                out += wraps[opened].marker;
+                wraps[opened].start = out.size();
+            }
+        }
+    };
+
+    // Script and style bodies are stored as written; in a render line their
+    // whitespace collapses like any other text
+    void appendNodeText(InlineWriter& out, Node node, bool pre) const {
+        const char* text = tree.text(node);
+        if (text && (tagEquals(node, "script") || tagEquals(node, "style"))) {
+            std::string flat(text);
+            collapseWhitespace(&flat[0]);
+            out.text(flat.c_str(), pre);
+        } else {
+            out.text(text, pre);
+        }
+    }
+
+    // Appends the text of node and everything inside it to out, bold and
+    // italic elements wrapped in their markers. Inline elements nest as deep
+    // as any others, so this walks a Stack of frames rather than recursing.
+    void buildInlineText(Node root, std::string& out, bool pre = false) const {
+        if (!root) return;
+        struct Frame {
+            Node node;
+            bool pre;     // inside <pre>
+            bool leaving; // its children are done: close its bold or italic
+        };
+        InlineWriter writer(out);
+        Stack<Frame> pending;
+        pending.push({root, pre, false});
+        while (!pending.isEmpty()) {
+            Frame frame = pending.pop();
+            if (frame.leaving) {
+                writer.endWrap();
+                continue;
+            }
+            Node node = frame.node;
+            // Later siblings come after everything inside node
+            Node sibling = node == root ? nullptr : tree.nextSibling(node);
+            if (sibling) pending.push({sibling, frame.pre, false});
+
+            if (node != root) {
+                if (tagEquals(node, "br")) {
+                    writer.lineBreak(frame.pre);
+                    continue;
+                }
+                const char* marker = isInlineBold(node) ? "**" : isInlineItalic(node) ? "*" : nullptr;
+                if (marker) {
+                    writer.beginWrap(marker);
+                    pending.push({node, false, true});
+                }
+            }
+            bool inPre = frame.pre || tagEquals(node, "pre");
+            appendNodeText(writer, node, inPre);
+            Node child = tree.firstChild(node);
+            if (child) pending.push({child, inPre, false});
+        }
+    }
+
+    // Calls visit on root and everything under it in document order, a node
+    // before its children, until visit returns false. Walks with a Stack
+    // rather than recursing: generated pages nest 200k tags deep, which
+    // overflows the call stack.
+    template <typename Visit>
+    void walkSubtree(Node root, Visit visit) const {
+        if (!root) return;
+        Stack<Node> pending;
+        pending.push(root);
+        while (!pending.isEmpty()) {
+            Node node = pending.pop();
+            if (!visit(node)) return;
+            Node sibling = node == root ? nullptr : tree.nextSibling(node);
+            if (sibling) pending.push(sibling);
+            Node child = tree.firstChild(node);
+            if (child) pending.push(child);
+        }
+    }
+
+    // The text of the first <title> with any, unless title is already set
+    void findTitle(Node node, std::string& title) const {
+        if (!title.empty()) return;
+        walkSubtree(node, [&](Node n) {
+            if (tagEquals(n, "title")) buildInlineText(n, title);
+            return title.empty();
+        });
+    }
+
+    // node's own block, if it is one; its text covers the whole subtree
+    void collectRenderNode(RenderDocument& doc, Node node) const {
+        if (tagEquals(node, "h1") || tagEquals(node, "h2") || tagEquals(node, "h3") || tagEquals(node, "p")) {
+            RenderBlock block;
+            buildInlineText(node, block.text);
+            if (!block.text.empty() && block.text.back() == ' ') block.text.pop_back(); // from a trailing <br>
+            if (!block.text.empty()) {
+                if (tagEquals(node, "h1")) block.kind = RENDER_H1;
+                else if (tagEquals(node, "h2")) block.kind = RENDER_H2;
+                else if (tagEquals(node, "h3")) block.kind = RENDER_H3;
+                else block.kind = RENDER_P;
+                doc.blocks.push_back(block);
+            }
+        }
+    }
+
+    void collectRenderNodes(RenderDocument& doc, Node node) const {
+        walkSubtree(node, [&](Node n) {
+            collectRenderNode(doc, n);
+            return true;
+        });
+    }
+
+    // Fills link if node is one; <a> without href is just text
+    bool readLink(Node node, RenderLink& link) const {
+        if (!tagEquals(node, "a")) return false;
+        const char* href = tree.attribute(node, "href");
+        if (!href) return false;
+        const char* rel = tree.attribute(node, "rel");
+        link.href = href;
+        size_t start = link.href.find_first_not_of(" \t\r\n");
+        size_t end = link.href.find_last_not_of(" \t\r\n");
+        link.href = start == std::string::npos ? "" : link.href.substr(start, end - start + 1);
+        link.rel = rel ? rel : "";
+        buildInlineText(node, link.text);
+        return true;
+    }
+
+    void collectLinks(std::vector<RenderLink>& links, Node node) const {
+        walkSubtree(node, [&](Node n) {
+            RenderLink link;
+            if (readLink(n, link)) links.push_back(std::move(link));
+            return true;
+        });
+    }
+
+    // Title, blocks and links of the tree under root, untimed
+    RenderDocument buildRenderDocument(Node root) const {
+        RenderDocument doc;
+        findTitle(root, doc.title);
+        collectRenderNodes(doc, root);
+        collectLinks(doc.links, root);
+        return doc;
+    }
+
+    // The same document, with blocks and links collected on threads
+    RenderDocument buildRenderDocument(Node root, int threads) const {
+        RenderDocument doc;
+        findTitle(root, doc.title);
+        collectBlocksAndLinks(doc, root, threads);
+        return doc;
+    }
+
+    // collectRenderNodes + collectLinks. With threads > 1 the tree is cut
+    // into subtrees that are walked at the same time, each into its own
+    // part, and the parts are joined in document order.
+    void collectBlocksAndLinks(RenderDocument& doc, Node root, int threads) const {
+        if (threads <= 1) {
+            collectRenderNodes(doc, root);
+            collectLinks(doc.links, root);
+            return;
+        }
+        std::vector<RenderPiece> pieces = splitForRender(root, static_cast<size_t>(threads) * 8);
+        std::vector<RenderDocument> parts(pieces.size());
+        std::atomic<size_t> next(0);
+        auto work = [&]() {
+            TRACE_SCOPE("render", "render pieces");
+            for (size_t i = next++; i < pieces.size(); i = next++) {
+                Node node = pieces[i].node;
+                if (pieces[i].shallow) {
+                    collectRenderNode(parts[i], node);
+                    RenderLink link;
+                    if (readLink(node, link)) parts[i].links.push_back(link);
+                } else {
+                    collectRenderNodes(parts[i], node);
+                    collectLinks(parts[i].links, node);
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        for (int t = 1; t < threads && static_cast<size_t>(t) < pieces.size(); t++) {
+            workers.push_back(std::thread(work));
+        }
+        work();
+        for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+
+        for (size_t i = 0; i < parts.size(); i++) {
+            std::move(parts[i].blocks.begin(), parts[i].blocks.end(), std::back_inserter(doc.blocks));
+            std::move(parts[i].links.begin(), parts[i].links.end(), std::back_inserter(doc.links));
+        }
+    }
+
+private:
+    const Tree& tree;
+
+    // A subtree to walk, or (shallow) just the node itself when its
+    // children are pieces of their own. Both walks visit a node before its
+    // children, so a shallow piece followed by its children's pieces gives
+    // what one walk of the node would.
+    struct RenderPiece {
+        Node node;
+        bool shallow;
+    };
+
+    // Opens the tree a level at a time (<html>, then <head> and <body>,
+    // then everything in <body> ...) until there are about want pieces
+    std::vector<RenderPiece> splitForRender(Node root, size_t want) const {
+        std::vector<RenderPiece> pieces;
+        if (root) pieces.push_back({root, false});
+        bool opened = true;
+        while (opened && pieces.size() < want) {
+            opened = false;
+            std::vector<RenderPiece> next;
+            for (size_t i = 0; i < pieces.size(); i++) {
+                Node child = pieces[i].shallow ? nullptr : tree.firstChild(pieces[i].node);
+                if (!child) {
+                    next.push_back(pieces[i]);
+                    continue;
+                }
+                next.push_back({pieces[i].node, true});
+                for (; child; child = tree.nextSibling(child)) next.push_back({child, false});
+                opened = true;
+            }
+            pieces.swap(next);
+        }
+        return pieces;
+    }
+};
+
+// ============================================================================
+// PARSE STATISTICS (filled in when a parser is given one, see setStats)
+// ============================================================================
+
+struct ParseStats {
+    PhaseTime read;              // timed by the caller
+    PhaseTime tokenize;
+    PhaseTime treeBuild;
+    PhaseTime titleExtraction;
+    PhaseTime renderWrite;
+
+    long openTags = 0;
+    long closeTags = 0;
+    long selfCloseTags = 0;
+    long textTokens = 0;
+    long unknownTags = 0;        // skipped: not in the HTML4 tag registry
+    long comments = 0;           // skipped whole by the tokenizer
+    long long rawTextBytes = 0;  // script and style bodies, kept or dropped
+    long nodes = 0;
+    int maxDepth = 0;
+    long long textBytes = 0;
+    long graphEdges = 0;
+    long long inputBytes = 0;    // set by the caller
+    long long outputBytes = 0;
+    int tokenizeChunks = 0;      // parseParallel: pieces tokenized at once
+    int chunksRetokenized = 0;   // ... and how many of them guessed their start wrong
+};
+
+// A block as page.txt lines. <pre> text keeps its line breaks in the block
+// (the GUI draws them), but in page.txt every line carries the block's
+// prefix; a break at the very end adds no empty line.
+inline void writeRenderBlock(std::ostream& out, const RenderBlock& block) {
+    const std::string& text = block.text;
+    size_t start = 0;
+    for (;;) {
+        size_t end = text.find_first_of("\r\n", start);
+        out << renderKindPrefix(block.kind);
+        size_t stop = end == std::string::npos ? text.size() : end;
+        out.write(text.data() + start, static_cast<std::streamsize>(stop - start));
+        out << std::endl;
+        if (end == std::string::npos) return;
+        start = end + (text[end] == '\r' && end + 1 < text.size() && text[end + 1] == '\n' ? 2 : 1);
+        if (start == text.size()) return;
+    }
+}
+
+// Same line format html_parser has always written to page.txt
+inline void writeRenderDocument(std::ostream& out, const RenderDocument& doc) {
+    if (!doc.title.empty()) {
+        out << "TITLE: " << doc.title << std::endl;
+    }
+    for (size_t i = 0; i < doc.blocks.size(); i++) {
+        writeRenderBlock(out, doc.blocks[i]);
+    }
+}
+
+// ============================================================================
+// HTML PARSER CLASS
+// ============================================================================
+
+struct ParserBenchAccess; // parser_bench.cpp times the private phases one by one
+
+class HTMLParser {
+private:
+    friend struct ParserBenchAccess;
+    HTMLNode* root;
+    const AVLTree* tagRegistry; // shared by every parser, see sharedTagRegistry()
+    Graph* elementGraph;
+    int nodeCounter;
+    std::string pageTitle;
+    LiveDom liveDom;
+    RenderWalker<LiveDom> render; // h1-h3/p blocks, title and links out of the tree
+    
+    // DOM builder state, kept between tokens so input can arrive in pieces
+    Stack<HTMLNode*>* openNodes;
+    HTMLNode* currentNode;
+    
+    // Incremental mode: unconsumed input and where finished blocks go
+    bool streaming;
+    std::string pendingInput;
+    // Where findCompletePrefix gave up on the token it could not finish, so
+    // the next feed searches on from there instead of from the token start
+    struct InputScan {
+        size_t tokenStart = std::string::npos;
+        size_t searched = 0;            // searched for the token's end up to here
+        const char* rawName = nullptr;  // script/style whose start tag is whole ...
+        size_t bodyStart = 0;           // ... and whose body starts here
+    };
+    InputScan inputScan;
+    RenderBlockSink blockSink;
+    bool releaseFinished; // incremental mode: free each subtree once its blocks are out
+    std::vector<RenderLink> pageLinks;
+    std::vector<std::pair<int, RenderLink>> streamedLinks; // incremental mode: node id, link
+    ParseStats* stats; // optional, owned by the caller
+    
+    TokenizerState tokenizerState; // where the last tokenize call left off
+    bool dropRawText; // script and style bodies make no TEXT tokens
+    
+    // HTML4 valid tags (no duplicates), built once and never modified after
+    static const AVLTree& sharedTagRegistry() {
+        static const char* const html4Tags[49] = {
+            "html", "head", "body", "title", "meta", "div", "span",
+            "h1", "h2", "h3", "h4", "h5", "h6",
+            "p", "br", "hr", "pre", "code",
+            "strong", "em", "b", "i", "u", "small", "big",
+            "ul", "ol", "li", "dl", "dt", "dd",
+            "a", "img",
+            "table", "tr", "td", "th", "thead", "tbody",
+            "form", "input", "textarea", "button", "select", "option",
+            "script", "style", "link", "base"
+        };
+        static const AVLTree* registry = [] {
+            AllocScope scope(ALLOC_TAG_REGISTRY);
+            AVLTree* tree = new AVLTree();
+            for (int i = 0; i < 49; i++) {
+                tree->insert(html4Tags[i]);
+            }
+            return tree;
+        }();
+        return *registry;
+    }
+    
+    char* toLowerCase(const char* str) const {
+        if (!str) return nullptr;
+        int len = strlen(str);
+        char* result = new char[len + 1];
+        for (int i = 0; i < len; i++) {
+            result[i] = toAsciiLower(str[i]);
+        }
+        result[len] = '\0';
+        return result;
+    }
+    
+    Token* createToken(TokenType type, const char* content) const {
+        Token* token = new Token();
+        token->type = type;
+        token->content = copyString(content);
+        AllocScope scope(ALLOC_ATTRIBUTES);
+        token->attributes = new HashTable();
+        return token;
+    }
+    
+    void parseAttributes(const char* tagStr, HashTable* attrs) const {
+        if (!tagStr || !attrs) return;
+        AllocScope scope(ALLOC_ATTRIBUTES);
+        
+        int len = strlen(tagStr);
+        int i = 0;
+        
+        while (i < len) {
+            // Skip whitespace
+            while (i < len && isAsciiSpace(tagStr[i])) i++;
+            if (i >= len) break;
+            
+            // Find attribute name
+            int nameStart = i;
+            while (i < len && !isAsciiSpace(tagStr[i]) && tagStr[i] != '=') i++;
+            if (i == nameStart) break;
+            
+            char* attrName = substring(tagStr, nameStart, i - nameStart);
+            char* lowerName = toLowerCase(attrName);
+            
+            // Only name=value pairs are kept; a bare name (or the tag name) has no value
+            while (i < len && isAsciiSpace(tagStr[i])) i++;
+            bool hasValue = i < len && tagStr[i] == '=';
+            if (hasValue) i++;
+            while (hasValue && i < len && isAsciiSpace(tagStr[i])) i++;
+            
+            if (hasValue && i < len && (tagStr[i] == '"' || tagStr[i] == '\'')) {
+                char quote = tagStr[i];
+                i++; // Skip opening quote
+                int valueStart = i;
+                while (i < len && tagStr[i] != quote) i++;
+                if (i < len) {
+                    char* attrValue = substring(tagStr, valueStart, i - valueStart);
+                    decodeEntities(attrValue, true);
+                    attrs->insert(lowerName, attrValue);
+                    delete[] attrValue;
+                    i++; // Skip closing quote
+                }
+            } else if (hasValue) {
+                int valueStart = i;
+                while (i < len && !isAsciiSpace(tagStr[i]) && tagStr[i] != '/') i++;
+                if (i > valueStart) {
+                    char* attrValue = substring(tagStr, valueStart, i - valueStart);
+                    decodeEntities(attrValue, true);
+                    attrs->insert(lowerName, attrValue);
+                    delete[] attrValue;
+                }
+            }
+            
+            delete[] attrName;
+            delete[] lowerName;
+        }
+    }
+    
+    Queue<Token*>* tokenize(const char* html) {
+        Queue<Token*>* tokens = new Queue<Token*>();
+        if (!html) return tokens;
+        int len = strlen(html);
+        tokenizeRange(html, len, 0, len, tokenizerState, tokens, stats);
+        return tokens;
+    }
+    
+    // Tokenizes html from begin, starting from state and leaving it updated,
+    // until a token would start at or past limit; returns where it stopped.
+    // A tag, comment or script body that starts before limit is read whole
+    // (up to len), so stopping at limit and going on from the returned
+    // position with the returned state gives the same tokens as one call.
+    // Only counters (comments, raw text bytes) and the arguments are touched,
+    // so pieces of one document can be tokenized on several threads.
+    int tokenizeRange(const char* html, int len, int begin, int limit, TokenizerState& state,
+                      Queue<Token*>* tokens, ParseStats* counters) const {
+        AllocScope scope(ALLOC_TOKENS);
+        int& preDepth = state.preDepth;
+        bool& preStart = state.preStart;
+        int i = begin;
+        
+        while (i < limit) {
+            // Skip whitespace (inside <pre> it belongs to the text)
+            while (preDepth == 0 && i < len && isAsciiSpace(html[i])) i++;
+            if (i >= limit) break;
+            
+            if (html[i] == '<') {
+                // Found a tag
+                int tagStart = i;
+                i++;
+                
+                if (i >= len) break;
+                
+                // Comments, doctypes and <?...?> make no tokens; a '>' or a
+                // tag inside a comment does not end it
+                if (html[i] == '!' || html[i] == '?') {
+                    const char* after = skipMarkupDeclaration(html + tagStart, html + len);
+                    if (counters && html[i] == '!' && i + 2 < len && html[i + 1] == '-' && html[i + 2] == '-') {
+                        counters->comments++;
+                    }
+                    i = after ? static_cast<int>(after - html) : len;
+                    continue;
+                }
+                
+                // Check for closing tag
+                bool isClosing = false;
+                if (html[i] == '/') {
+                    isClosing = true;
+                    i++;
+                }
+                
+                // Find end of tag first
+                int tagEnd = tagStart + 1;
+                while (tagEnd < len && html[tagEnd] != '>') tagEnd++;
+                
+                // Check for self-closing (before >)
+                bool isSelfClose = false;
+                if (tagEnd < len && tagEnd > tagStart + 1 && html[tagEnd - 1] == '/') {
+                    isSelfClose = true;
+                }
+                
+                // Extract tag name
+                int nameStart = i;
+                while (i < len && i < tagEnd && html[i] != '>' && !isAsciiSpace(html[i]) && html[i] != '/') {
+                    i++;
+                }
+                int nameLen = i - nameStart;
+                
+                if (nameLen > 0 && nameStart >= 0 && nameStart + nameLen <= len) {
+                    char* tagName = copyRange(html + nameStart, nameLen);
+                    if (tagName && strlen(tagName) > 0) {
+                        char* lowerTag = toLowerCase(tagName);
+                        if (lowerTag) {
+                            Token* token;
+                            if (isSelfClose && !isClosing) {
+                                token = createToken(SELF_CLOSE_TAG, lowerTag);
+                            } else if (isClosing) {
+                                token = createToken(CLOSE_TAG, lowerTag);
+                            } else {
+                                token = createToken(OPEN_TAG, lowerTag);
+                                // Extract full tag for attributes (only for opening tags)
+                                if (tagEnd > nameStart && tagEnd <= len) {
+                                    int fullTagLen = tagEnd - nameStart;
+                                    char* fullTag = copyRange(html + nameStart, fullTagLen);
+                                    if (fullTag) {
+                                        parseAttributes(fullTag, token->attributes);
+                                        delete[] fullTag;
+                                    }
+                                }
+                            }
+                            
+                            if (token) {
+                                tokens->enqueue(token);
+                                preStart = false;
+                                if (strcmp(lowerTag, "pre") == 0) {
+                                    if (token->type == OPEN_TAG) {
+                                        preDepth++;
+                                        preStart = true;
+                                    } else if (token->type == CLOSE_TAG && preDepth > 0) {
+                                        preDepth--;
+                                    }
+                                }
+                            }
+                            
+                            delete[] lowerTag;
+                        }
+                        delete[] tagName;
+                    }
+                }
+                
+                // Skip to end of tag
+                i = tagEnd;
+                if (i < len) i++;
+                
+                // A script or style body is one piece of raw text up to its end tag
+                const char* rawName = !isClosing && tagEnd < len ? rawTextElement(html + tagStart, html + tagEnd) : nullptr;
+                if (rawName) {
+                    int bodyLen = static_cast<int>(findRawTextEnd(html + i, html + len, rawName) - (html + i));
+                    if (counters) counters->rawTextBytes += bodyLen;
+                    if (!dropRawText && bodyLen > 0) {
+                        // Kept exactly as written: no character references ("a &amp;&amp; b"
+                        // stays) and no collapsing, which would change string literals and
+                        // turn everything after a // comment into that comment
+                        char* text = copyRange(html + i, bodyLen);
+                        tokens->enqueue(createToken(TEXT, text));
+                        delete[] text;
+                    }
+                    i += bodyLen;
+                }
+            } else {
+                // Text content
+                int textStart = i;
+                while (i < len && html[i] != '<') i++;
+                int textLen = i - textStart;
+                
+                if (textLen > 0) {
+                    // A newline right after <pre> is not part of its text
+                    if (preStart) {
+                        int skip = html[textStart] == '\n' ? 1 : 0;
+                        if (html[textStart] == '\r') skip = textLen > 1 && html[textStart + 1] == '\n' ? 2 : 1;
+                        textStart += skip;
+                        textLen -= skip;
+                    }
+                    char* text = copyRange(html + textStart, textLen);
+                    bool preformatted = preDepth > 0;
+                    // Decoded first, so "a &#32; b" or "&#10;" collapse like typed whitespace
+                    decodeEntities(text, false);
+                    if (!preformatted) collapseWhitespace(text);
+                    if (text && strlen(text) > 0) {
+                        Token* token = createToken(TEXT, text);
+                        token->preformatted = preformatted;
+                        tokens->enqueue(token);
+                    }
+                    preStart = false;
+                    delete[] text;
+                }
+            }
+        }
+        
+        return i;
+    }
+    
+    HTMLNode* createNode(const char* tagName) {
+        AllocScope scope(ALLOC_DOM_NODES);
+        HTMLNode* node = new HTMLNode();
+        node->tagName = copyString(tagName);
+        node->nodeId = nodeCounter++;
+        return node;
+    }
+    
+    void beginDOMTree() {
+        root = nullptr;
+        currentNode = nullptr;
+        openNodes = new Stack<HTMLNode*>();
+        elementGraph = new Graph(1000);
+    }
+    
+    // A page that starts with <meta charset> or <br/> has no element yet
+    // that can hold it, so an <html> is opened for it, as if it were written
+    void openImpliedRoot() {
+        root = createNode("html");
+        root->inDocument = true;
+        currentNode = root;
+        openNodes->push(root);
+        elementGraph->addVertex(root->nodeId);
+    }
+    
+    void endDOMTree() {
+        if (stats) {
+            stats->nodes = nodeCounter;
+            stats->graphEdges = elementGraph ? elementGraph->getNumEdges() : 0;
+        }
+        delete openNodes;
+        openNodes = nullptr;
+        currentNode = nullptr;
+    }
+    
+    void countToken(const Token* token) {
+        switch (token->type) {
+        case OPEN_TAG: stats->openTags++; break;
+        case CLOSE_TAG: stats->closeTags++; break;
+        case SELF_CLOSE_TAG: stats->selfCloseTags++; break;
+        default:
+            stats->textTokens++;
+            stats->textBytes += token->content ? static_cast<long long>(strlen(token->content)) : 0;
+            break;
+        }
+    }
+    
+    void processToken(Token* token) {
+        if (stats) countToken(token);
+        try {
+            if (token->type == OPEN_TAG) {
+                // Validate tag
+                bool isValid = tagRegistry->search(token->content);
+                if (!isValid) {
+                    // Unknown tag (HTML5 or invalid) - handle gracefully
+                    throw std::runtime_error("Unknown tag encountered");
+                }
+                
+                HTMLNode* newNode = createNode(token->content);
+                
+                // The node takes over the token's attributes (href, rel, ...)
+                if (token->attributes) {
+                    delete newNode->attributes;
+                    newNode->attributes = token->attributes;
+                    token->attributes = nullptr;
+                }
+                
+                // <br>, <img>, <meta> ... never have an end tag, so they
+                // don't stay open and swallow what follows them
+                bool isVoid = isVoidElement(token->content);
+                if (!root && isVoid) openImpliedRoot();
+                if (!root) {
+                    root = newNode;
+                    currentNode = newNode;
+                } else {
+                    if (currentNode) {
+                        currentNode->addChild(newNode);
+                    }
+                    if (!isVoid) currentNode = newNode;
+                }
+                
+                if (!isVoid) openNodes->push(newNode);
+                if (streaming) noteAncestors(newNode);
+                if (stats && newNode->depth > stats->maxDepth) stats->maxDepth = newNode->depth;
+                elementGraph->addVertex(newNode->nodeId);
+                
+                if (newNode->parent) {
+                    elementGraph->addEdge(newNode->parent->nodeId, newNode->nodeId);
+                }
+                
+            } else if (token->type == CLOSE_TAG) {
+                // Validate tag
+                bool isValid = tagRegistry->search(token->content);
+                if (!isValid) {
+                    throw std::runtime_error("Unknown closing tag");
+                }
+                
+                // Pop stack until matching tag (don't delete nodes, they're in the tree)
+                Stack<HTMLNode*>* tempStack = new Stack<HTMLNode*>();
+                bool found = false;
+                HTMLNode* closed = nullptr;
+                
+                while (!openNodes->isEmpty()) {
+                    HTMLNode* top = openNodes->pop();
+                    if (top && strcmp(top->tagName, token->content) == 0) {
+                        found = true;
+                        closed = top;
+                        // Don't delete - node is part of tree structure
+                        break;
+                    }
+                    tempStack->push(top);
+                }
+                
+                // Only the matched element leaves the stack; anything opened
+                // inside it stays open, so its subtree is complete only when it
+                // was the innermost open element
+                bool closedInnermost = found && tempStack->isEmpty();
+                
+                // Push back unmatched nodes
+                while (!tempStack->isEmpty()) {
+                    openNodes->push(tempStack->pop());
+                }
+                delete tempStack;
+                
+                if (found) {
+                    if (!openNodes->isEmpty()) {
+                        currentNode = openNodes->peek();
+                    } else {
+                        currentNode = nullptr;
+                    }
+                    if (closedInnermost && streaming) {
+                        subtreeFinished(closed);
+                    }
+                }
+                
+            } else if (token->type == SELF_CLOSE_TAG) {
+                bool isValid = tagRegistry->search(token->content);
+                if (!isValid) {
+                    throw std::runtime_error("Unknown self-closing tag");
+                }
+                
+                if (!root) openImpliedRoot();
+                HTMLNode* newNode = createNode(token->content);
+                if (currentNode) {
+                    currentNode->addChild(newNode);
+                }
+                if (streaming) noteAncestors(newNode);
+                if (stats && newNode->depth > stats->maxDepth) stats->maxDepth = newNode->depth;
+                
+                elementGraph->addVertex(newNode->nodeId);
+                if (newNode->parent) {
+                    elementGraph->addEdge(newNode->parent->nodeId, newNode->nodeId);
+                }
+                
+            } else if (token->type == TEXT) {
+                AllocScope scope(ALLOC_TEXT);
+                // Freed subtrees are never read again, so only text that
+                // some block or the title will print is worth keeping
+                if (currentNode && (!releaseFinished || insideRenderedText(currentNode))) {
+                    if (!currentNode->textContent) {
+                        currentNode->textContent = copyString(token->content);
+                    } else {
+                        // Append text; preformatted pieces join as written
+                        int oldLen = strlen(currentNode->textContent);
+                        int newLen = strlen(token->content);
+                        char* combined = new char[oldLen + newLen + 2];
+                        strcpy(combined, currentNode->textContent);
+                        if (!token->preformatted) strcat(combined, " ");
+                        strcat(combined, token->content);
+                        delete[] currentNode->textContent;
+                        currentNode->textContent = combined;
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            // Unknown tag - skip it but continue parsing
+            if (stats) stats->unknownTags++;
+        }
+    }
+    
+    // Returns how much of buf is whole tokens: a tag cut before its '>' or
+    // text cut before the next '<' has to wait for more input. The search for
+    // the end of the token that was cut last time starts where that search
+    // stopped (less a few bytes, in case a "</script" or "-->" was cut in
+    // two), so a long text run or script body is not scanned again per chunk.
+    size_t findCompletePrefix(const std::string& buf) {
+        static const size_t overlap = 16; // longer than any end marker
+        size_t len = buf.size();
+        const char* data = buf.data();
+        const char* end = data + len;
+        size_t i = 0;
+        size_t complete = 0;
+        InputScan last = inputScan;
+        inputScan = InputScan();
+        while (i < len) {
+            while (i < len && isAsciiSpace(buf[i])) i++;
+            if (i >= len) {
+                complete = len;
+                break;
+            }
+            size_t tokenStart = i;
+            bool resuming = tokenStart == last.tokenStart;
+            size_t from = resuming && last.searched > overlap ? last.searched - overlap : 0;
+            const char* rawName = nullptr;
+            size_t bodyStart = 0;
+            if (resuming && last.rawName) {
+                rawName = last.rawName;
+                bodyStart = last.bodyStart;
+            } else if (buf[i] == '<') {
+                // Comments and script/style bodies are only whole with their ends
+                const char* lt = data + i;
+                if (i + 1 < len && (buf[i + 1] == '!' || buf[i + 1] == '?')) {
+                    const char* after = skipMarkupDeclaration(lt, end, data + from);
+                    if (!after) {
+                        inputScan = {tokenStart, len, nullptr, 0};
+                        break;
+                    }
+                    i = static_cast<size_t>(after - data);
+                    complete = i;
+                    continue;
+                }
+                size_t tagEnd = buf.find('>', std::max(i + 1, from));
+                if (tagEnd == std::string::npos) {
+                    inputScan = {tokenStart, len, nullptr, 0};
+                    break;
+                }
+                rawName = buf[i + 1] != '/' ? rawTextElement(lt, data + tagEnd) : nullptr;
+                i = tagEnd + 1;
+                bodyStart = i;
+            } else {
+                size_t next = buf.find('<', std::max(i, from));
+                if (next == std::string::npos) {
+                    inputScan = {tokenStart, len, nullptr, 0};
+                    break;
+                }
+                i = next;
+            }
+            if (rawName) {
+                const char* bodyEnd = findRawTextEnd(data + std::max(bodyStart, from), end, rawName);
+                if (bodyEnd == end) {
+                    inputScan = {tokenStart, len, rawName, bodyStart};
+                    break;
+                }
+                i = static_cast<size_t>(bodyEnd - data);
+            }
+            complete = i;
+        }
+        return complete;
+    }
+    
+    // One piece of a parseParallel input, tokenized on its own thread on the
+    // guess that it starts at a token boundary with no <pre> open
+    struct TokenizeChunk {
+        int begin = 0;
+        int limit = 0;
+        int end = 0;                  // where its tokenizer stopped
+        TokenizerState endState;
+        Queue<Token*>* tokens = nullptr;
+        ParseStats counters;
+    };
+    
+    // Split points: the first '<' opening a tag at or after each even share
+    // of the input. A split can still land inside a comment, script body or
+    // tag; tokenizeParallel notices that and redoes the piece.
+    static std::vector<int> chunkStarts(const char* html, int len, int pieces) {
+        std::vector<int> starts(1, 0);
+        for (int k = 1; k < pieces; k++) {
+            const char* p = html + static_cast<long long>(len) * k / pieces;
+            const char* end = html + len;
+            while (p < end) {
+                p = static_cast<const char*>(memchr(p, '<', static_cast<size_t>(end - p)));
+                if (!p) p = end;
+                else if (p + 1 < end && (p[1] == '/' || isAsciiAlnum(p[1]))) break;
+                else p++;
+            }
+            int start = static_cast<int>(p - html);
+            if (start > starts.back() && start < len) starts.push_back(start);
+        }
+        return starts;
+    }
+    
+    static void deleteTokens(Queue<Token*>* tokens) {
+        while (!tokens->isEmpty()) delete tokens->dequeue();
+        delete tokens;
+    }
+    
+    // Tokenizes html as a sequence of token queues, pieces at a time. Each
+    // piece's guessed start is then checked in order against where the piece
+    // before it really stopped; a wrong guess (the split fell inside a
+    // comment, script body or tag, or inside <pre>) is tokenized again from
+    // the real position, so the tokens always match tokenize's.
+    std::vector<Queue<Token*>*> tokenizeParallel(const char* html, int len, int threads) {
+        std::vector<int> starts = chunkStarts(html, len, threads);
+        std::vector<TokenizeChunk> chunks(starts.size());
+        for (size_t k = 0; k < chunks.size(); k++) {
+            chunks[k].begin = starts[k];
+            chunks[k].limit = k + 1 < starts.size() ? starts[k + 1] : len;
+        }
+        auto work = [this, html, len](TokenizeChunk& chunk) {
+            TRACE_SCOPE("parse", "tokenize chunk");
+            chunk.tokens = new Queue<Token*>();
+            chunk.end = tokenizeRange(html, len, chunk.begin, chunk.limit, chunk.endState, chunk.tokens,
+                                      &chunk.counters);
+        };
+        std::vector<std::thread> workers;
+        for (size_t k = 1; k < chunks.size(); k++) {
+            workers.push_back(std::thread(work, std::ref(chunks[k])));
+        }
+        // The first piece starts where the document does, so it is never a guess
+        TokenizeChunk& first = chunks[0];
+        first.endState = tokenizerState;
+        work(first);
+        for (size_t k = 0; k < workers.size(); k++) workers[k].join();
+        
+        std::vector<Queue<Token*>*> pieces;
+        int pos = 0;
+        TokenizerState state = tokenizerState;
+        for (size_t k = 0; k < chunks.size(); k++) {
+            TokenizeChunk& chunk = chunks[k];
+            if (k == 0 || (chunk.begin == pos && state == TokenizerState())) {
+                pos = chunk.end;
+                state = chunk.endState;
+                pieces.push_back(chunk.tokens);
+                if (stats) {
+                    stats->comments += chunk.counters.comments;
+                    stats->rawTextBytes += chunk.counters.rawTextBytes;
+                }
+                continue;
+            }
+            deleteTokens(chunk.tokens);
+            if (stats) stats->chunksRetokenized++;
+            if (pos >= chunk.limit) continue; // the piece before ran over all of this one
+            Queue<Token*>* redone = new Queue<Token*>();
+            pos = tokenizeRange(html, len, pos, chunk.limit, state, redone, stats);
+            pieces.push_back(redone);
+        }
+        tokenizerState = state;
+        if (stats) stats->tokenizeChunks += static_cast<int>(chunks.size());
+        return pieces;
+    }
+    
+    void processTokens(Queue<Token*>* tokens) {
+        while (!tokens->isEmpty()) {
+            Token* token = tokens->dequeue();
+            processToken(token);
+            delete token;
+        }
+        delete tokens;
+    }
+    
+    void buildDOMTree(Queue<Token*>* tokens) {
+        beginDOMTree();
+        while (!tokens->isEmpty()) {
+            Token* token = tokens->dequeue();
+            processToken(token);
+            delete token;
+        }
+        endDOMTree();
+    }
+
+    bool tagEquals(HTMLNode* node, const char* name) {
+        return node && node->tagName && name && strcmp(node->tagName, name) == 0;
+    }
+
+    void extractTitle(HTMLNode* node) {
+        render.findTitle(node, pageTitle);
+    }
+    
+    void writeNodeToFile(std::ofstream& file, HTMLNode* node, int indent) {
+        if (!node) return;
+        
+        for (int i = 0; i < indent; i++) {
+            file << "  ";
+        }
+        
+        if (node->tagName) {
+            file << "TAG:" << node->tagName << std::endl;
+        }
+        
+        if (node->textContent && strlen(node->textContent) > 0) {
+            for (int i = 0; i < indent + 1; i++) {
+                file << "  ";
+            }
+            file << "TEXT:" << node->textContent << std::endl;
+        }
+        
+        HTMLNode* child = node->firstChild;
+        while (child) {
+            writeNodeToFile(file, child, indent + 1);
+            child = child->nextSibling;
+        }
+    }
+
+    // Incremental mode: subtrees can finish out of document order (an inner
+    // link closes before the link around it), so remember where each one was
+    void streamLinks(HTMLNode* node, bool deep) {
+        if (!node) return;
+        render.walkSubtree(node, [&](HTMLNode* n) {
+            RenderLink link;
+            if (render.readLink(n, link)) streamedLinks.push_back(std::make_pair(n->nodeId, std::move(link)));
+            return deep;
+        });
+    }
+    
+    bool isRenderBlock(HTMLNode* node) {
+        return tagEquals(node, "h1") || tagEquals(node, "h2") || tagEquals(node, "h3") || tagEquals(node, "p");
+    }
+    
+    bool holdsRenderedText(HTMLNode* node) {
+        return isRenderBlock(node) || tagEquals(node, "title");
+    }
+    
+    bool insideRenderedText(HTMLNode* node) {
+        return node->textAncestors > 0 || holdsRenderedText(node);
+    }
+    
+    // Incremental mode: what subtreeFinished needs to know about a new node's
+    // ancestors, worked out once from its parent so closing a tag never
+    // walks up the tree. The tree above a node does not change afterwards.
+    void noteAncestors(HTMLNode* node) {
+        HTMLNode* parent = node->parent;
+        node->inDocument = node == root || (parent && parent->inDocument);
+        node->textAncestors = parent ? parent->textAncestors + (holdsRenderedText(parent) ? 1 : 0) : 0;
+    }
+    
+    // Emits the blocks of a finished subtree that haven't been emitted yet.
+    // Like extractTitle, titles nested inside a title are never considered.
+    // Walks on a Stack in document order, as pages with thousands of
+    // unclosed tags nest too deep to recurse.
+    void emitFinishedSubtree(HTMLNode* start, bool findTitle = true) {
+        if (!start) return;
+        Stack<std::pair<HTMLNode*, bool>> pending; // second: titles are still looked for
+        pending.push(std::make_pair(start, findTitle));
+        while (!pending.isEmpty()) {
+            std::pair<HTMLNode*, bool> next = pending.pop();
+            HTMLNode* node = next.first;
+            bool lookForTitle = next.second;
+            // Siblings come after everything inside node and share its parent's flag
+            if (node != start && node->nextSibling) pending.push(std::make_pair(node->nextSibling, lookForTitle));
+            if (node->rendered) continue;
+            node->rendered = true;
+            
+            if (isRenderBlock(node)) {
+                RenderDocument part;
+                render.collectRenderNodes(part, node);
+                for (size_t i = 0; i < part.blocks.size(); i++) {
+                    blockSink(part.blocks[i]);
+                }
+                if (!releaseFinished) streamLinks(node, true);
+                if (lookForTitle) extractTitle(node);
+                continue;
+            }
+            if (!releaseFinished) streamLinks(node, false);
+            if (tagEquals(node, "title")) {
+                if (lookForTitle) extractTitle(node);
+                lookForTitle = false;
+            }
+            if (node->firstChild) pending.push(std::make_pair(node->firstChild, lookForTitle));
+        }
+    }
+    
+    // closed and every ancestor below the new innermost open element can no
+    // longer change, so their blocks can be published now, in document order
+    void subtreeFinished(HTMLNode* closed) {
+        HTMLNode* highest = closed;
+        while (highest->parent && highest->parent != currentNode) {
+            highest = highest->parent;
+        }
+        
+        // A block or title above, still open or with something in it still
+        // open, would swallow this text; wait for it
+        if (highest->textAncestors > 0) return;
+        if (highest->inDocument) {
+            emitFinishedSubtree(highest);
+        } // else a detached element, not part of the document
+        if (releaseFinished) releaseSubtree(highest);
+    }
+    
+    // Nothing below node is open any more and its blocks are out, so it can go
+    void releaseSubtree(HTMLNode* node) {
+        if (node == root) {
+            root = nullptr;
+        } else if (node->parent) {
+            node->parent->removeChild(node);
+        }
+        node->nextSibling = nullptr;
+        cleanupTree(node);
+    }
+    
+    void resetDocument() {
+        cleanupTree(root);
+        root = nullptr;
+        delete elementGraph;
+        elementGraph = nullptr;
+        delete openNodes;
+        openNodes = nullptr;
+        currentNode = nullptr;
+        nodeCounter = 0;
+        tokenizerState = TokenizerState();
+        pageTitle.clear();
+        pageLinks.clear();
+        streamedLinks.clear();
+    }
+    
+    // Deletes node, everything under it and its later siblings; on a Stack,
+    // since deep or wide pages would overflow the call stack
+    void cleanupTree(HTMLNode* node) {
+        Stack<HTMLNode*> pending;
+        if (node) pending.push(node);
+        while (!pending.isEmpty()) {
+            HTMLNode* next = pending.pop();
+            if (next->firstChild) pending.push(next->firstChild);
+            if (next->nextSibling) pending.push(next->nextSibling);
+            delete next;
+        }
+    }
+
+public:
+    HTMLParser() : root(nullptr), tagRegistry(nullptr), elementGraph(nullptr), nodeCounter(0), render(liveDom),
+                   openNodes(nullptr), currentNode(nullptr), streaming(false),
+                   releaseFinished(false), stats(nullptr),
+                   dropRawText(false) {
+        tagRegistry = &sharedTagRegistry();
+    }
+    
+    ~HTMLParser() {
+        delete openNodes;
+        cleanupTree(root);
+        delete elementGraph;
+    }
+    
+    void parse(const char* html) {
+        // Drop any document from a previous parse so one parser can be reused
+        resetDocument();
+        
+        Queue<Token*>* tokens;
+        {
+            TRACE_SCOPE("parse", "tokenize");
+            PhaseTimer tokenizeTimer(stats ? &stats->tokenize : nullptr);
+            tokens = tokenize(html);
+        }
+        {
+            TRACE_SCOPE("parse", "tree build");
+            PhaseTimer treeTimer(stats ? &stats->treeBuild : nullptr);
+            buildDOMTree(tokens);
+        }
+        
+        // Cleanup tokens queue
+        while (!tokens->isEmpty()) {
+            Token* token = tokens->dequeue();
+            delete token;
+        }
+        delete tokens;
+    }
+    
+    // parse, with tokenizing spread over threads (see tokenizeParallel); the
+    // tree is then built from the pieces in order on this thread. Inputs too
+    // small to be worth splitting are parsed as usual.
+    void parseParallel(const char* html, int threads) {
+        static const int minChunkBytes = 256 * 1024;
+        int len = html ? static_cast<int>(strlen(html)) : 0;
+        if (threads > len / minChunkBytes) threads = len / minChunkBytes;
+        if (threads <= 1) {
+            parse(html);
+            return;
+        }
+        resetDocument();
+        
+        std::vector<Queue<Token*>*> pieces;
+        {
+            TRACE_SCOPE("parse", "tokenize");
+            PhaseTimer tokenizeTimer(stats ? &stats->tokenize : nullptr);
+            pieces = tokenizeParallel(html, len, threads);
+        }
+        {
+            TRACE_SCOPE("parse", "tree build");
+            PhaseTimer treeTimer(stats ? &stats->treeBuild : nullptr);
+            beginDOMTree();
+            for (size_t k = 0; k < pieces.size(); k++) {
+                processTokens(pieces[k]);
+            }
+            endDOMTree();
+        }
+    }
+    
+    // Incremental parsing: beginIncremental, feed input as it arrives, finish.
+    // Each H1/H2/H3/P block goes to sink as soon as its element and everything
+    // inside it are closed, in the same order parse + buildRenderDocument gives.
+    //
+    // With releaseSubtrees each finished subtree is freed once its blocks are
+    // out, so memory follows how deeply elements are nested rather than how
+    // long the document is. Links are not collected then, and getRoot() only
+    // holds what is still open. An element that is never closed keeps
+    // everything inside it until finish.
+    void beginIncremental(const RenderBlockSink& sink, bool releaseSubtrees = false) {
+        resetDocument();
+        blockSink = sink;
+        streaming = true;
+        releaseFinished = releaseSubtrees;
+        pendingInput.clear();
+        inputScan = InputScan();
+        beginDOMTree();
+    }
+    
+    void feed(const char* data, size_t len) {
+        TRACE_SCOPE("parse", "feed");
+        pendingInput.append(data, len);
+        size_t complete = findCompletePrefix(pendingInput);
+        if (complete == 0) return;
+        
+        std::string ready = pendingInput.substr(0, complete);
+        pendingInput.erase(0, complete);
+        if (inputScan.tokenStart != std::string::npos) {
+            inputScan.tokenStart -= complete;
+            inputScan.searched -= complete;
+            inputScan.bodyStart -= inputScan.rawName ? complete : 0;
+        }
+        processTokens(tokenize(ready.c_str()));
+    }
+    
+    void finish() {
+        TRACE_SCOPE("parse", "finish");
+        processTokens(tokenize(pendingInput.c_str()));
+        pendingInput.clear();
+        inputScan = InputScan();
+        emitFinishedSubtree(root);
+        endDOMTree();
+        streaming = false;
+        if (releaseFinished) {
+            cleanupTree(root);
+            root = nullptr;
+            releaseFinished = false;
+        }
+
+        // Node ids follow start tags, i.e. document order
+        std::stable_sort(streamedLinks.begin(), streamedLinks.end(),
+                         [](const std::pair<int, RenderLink>& a, const std::pair<int, RenderLink>& b) {
+                             return a.first < b.first;
+                         });
+        for (size_t i = 0; i < streamedLinks.size(); i++) {
+            pageLinks.push_back(streamedLinks[i].second);
+        }
+        streamedLinks.clear();
+    }
+    
+    // Counters and phase times go to s from now on (null to stop)
+    void setStats(ParseStats* s) {
+        stats = s;
+    }
+    
+    // Skip script and style bodies entirely instead of keeping them as text.
+    // Comments are always skipped.
+    void setDropRawText(bool drop) {
+        dropRawText = drop;
+    }
+    
+    // Title found so far; final once finish() returns
+    const std::string& getTitle() const {
+        return pageTitle;
+    }
+    
+    // Links in document order, available once finish() returns
+    const std::vector<RenderLink>& getLinks() const {
+        return pageLinks;
+    }
+    
+    void writeDebugToFile(const char* filename) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot open file " << filename << " for writing" << std::endl;
+            return;
+        }
+        
+        if (root) {
+            writeNodeToFile(file, root, 0);
+        }
+        
+        file.close();
+    }
+
+    // threads > 1 collects blocks and links of big trees on that many threads;
+    // the document is the same either way
+    RenderDocument buildRenderDocument(int threads = 1) {
+        TRACE_SCOPE("render", "build render document");
+        RenderDocument doc;
+        PhaseTimer titleTimer(stats ? &stats->titleExtraction : nullptr);
+        pageTitle.clear();
+        extractTitle(root);
+        titleTimer.stop();
+        doc.title = pageTitle;
+        // Collecting blocks counts as part of the render write
+        PhaseTimer renderTimer(stats ? &stats->renderWrite : nullptr);
+        if (root) render.collectBlocksAndLinks(doc, root, threads);
+        return doc;
+    }
+
+    void writeRenderToFile(const char* filename, int threads = 1) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot open file " << filename << " for writing" << std::endl;
+            return;
+        }
+
+        RenderDocument doc = buildRenderDocument(threads);
+        TRACE_SCOPE("render", "write render file");
+        PhaseTimer writeTimer(stats ? &stats->renderWrite : nullptr);
+        writeRenderDocument(file, doc);
+        if (stats) stats->outputBytes = static_cast<long long>(file.tellp());
+        writeTimer.stop();
+
+        file.close();
+    }
+
+    // Renders inputFile to outputFile without ever holding the whole document:
+    // the file is read in chunks and each block is written as its element
+    // closes, then freed. Same lines as parse + writeRenderToFile, except that
+    // a title which only closes after the first block is written where it
+    // closes. Returns false if a file can't be opened.
+    bool streamRenderToFile(const char* inputFile, const char* outputFile) {
+        FILE* in = fopen(inputFile, "rb");
+        if (!in) {
+            std::cerr << "Error: Cannot open file " << inputFile << std::endl;
+            return false;
+        }
+        std::ofstream file(outputFile);
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot open file " << outputFile << " for writing" << std::endl;
+            fclose(in);
+            return false;
+        }
+
+        TRACE_SCOPE("render", "stream render file");
+        bool titleWritten = false;
+        auto writeTitle = [&]() {
+            if (titleWritten || pageTitle.empty()) return;
+            file << "TITLE: " << pageTitle << std::endl;
+            titleWritten = true;
+        };
+        beginIncremental([&](const RenderBlock& block) {
+            writeTitle();
+            writeRenderBlock(file, block);
+        }, true);
+
+        // Tokenizing and building overlap here, so the whole run counts as render write
+        PhaseTimer streamTimer(stats ? &stats->renderWrite : nullptr);
+        BodyDecoder decoder;
+        std::string scratch;
+        std::vector<char> chunk(64 * 1024);
+        long long inputBytes = 0;
+        size_t got;
+        while ((got = fread(chunk.data(), 1, chunk.size(), in)) > 0) {
+            inputBytes += static_cast<long long>(got);
+            std::string_view text = decoder.decodeChunk(chunk.data(), got, scratch);
+            if (!text.empty()) feed(text.data(), text.size());
+        }
+        std::string_view rest = decoder.finishChunk(scratch);
+        if (!rest.empty()) feed(rest.data(), rest.size());
+        finish();
+        writeTitle();
+        streamTimer.stop();
+        fclose(in);
+
+        if (stats) {
+            stats->inputBytes = inputBytes;
+            stats->outputBytes = static_cast<long long>(file.tellp());
+        }
+        return true;
+    }
+
+    HTMLNode* getRoot() {
+        return root;
+    }
+    
+    const Graph* getElementGraph() const {
+        return elementGraph;
+    }
+};
+
+// ============================================================================
+// LIBRARY ENTRY POINT
+// ============================================================================
+
+// Parses an in-memory HTML buffer straight to render blocks, no files involved
+inline RenderDocument parseHTML(const char* html) {
+    HTMLParser parser;
+    parser.parse(html);
+    return parser.buildRenderDocument();
+}
+
+inline RenderDocument parseHTML(const std::string& html) {
+    return parseHTML(html.c_str());
+}
+
+#endif // HTML_PARSER_H
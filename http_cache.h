@@ -0,0 +1,623 @@
+#ifndef HTTP_CACHE_H
+#define HTTP_CACHE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "http_fetcher.h"
+#include "url_canon.h"
+
+// ============================================================================
+// CACHE KEYS, HASHES AND HTTP DATES
+// ============================================================================
+
+// One key per resource, see canonicalizeUrl
+inline std::string normalizeCacheUrl(const std::string& url) {
+    return canonicalizeUrl(url);
+}
+
+// 128-bit name for a key or body: two FNV-1a lanes with different seeds
+inline std::string contentHashHex(const std::string& data) {
+    uint64_t a = 14695981039346656037ull;
+    uint64_t b = 14695981039346656037ull ^ (static_cast<uint64_t>(data.size()) * 0x9E3779B97F4A7C15ull);
+    for (size_t i = 0; i < data.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        a = (a ^ c) * 1099511628211ull;
+        b = (b ^ (c + 0x9Eu)) * 0x100000001B3ull;
+        b ^= b >> 29;
+    }
+    char out[33];
+    snprintf(out, sizeof(out), "%016llx%016llx", static_cast<unsigned long long>(a), static_cast<unsigned long long>(b));
+    return out;
+}
+
+inline long long unixNow() {
+    return static_cast<long long>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+inline long long daysFromCivil(long long y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    long long era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = static_cast<unsigned>(y - era * 400);
+    unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<long long>(doe) - 719468;
+}
+
+// Accepts the three date forms HTTP allows:
+//   Sun, 06 Nov 1994 08:49:37 GMT / Sunday, 06-Nov-94 08:49:37 GMT / Sun Nov  6 08:49:37 1994
+inline bool parseHttpDate(const std::string& text, long long& out) {
+    static const char* months[] = {"jan", "feb", "mar", "apr", "may", "jun",
+                                   "jul", "aug", "sep", "oct", "nov", "dec"};
+    int day = -1, month = -1, year = -1, hh = -1, mm = -1, ss = -1;
+    std::string token;
+    for (size_t i = 0; i <= text.size(); i++) {
+        char c = i < text.size() ? text[i] : ' ';
+        if (c != ' ' && c != ',' && c != '-') {
+            token += c;
+            continue;
+        }
+        if (token.empty()) continue;
+        if (token.find(':') != std::string::npos) {
+            if (sscanf(token.c_str(), "%d:%d:%d", &hh, &mm, &ss) != 3) return false;
+        } else if (token[0] >= '0' && token[0] <= '9') {
+            int value = atoi(token.c_str());
+            if (day < 0 && token.size() <= 2) {
+                day = value;
+            } else {
+                year = token.size() <= 2 ? (value >= 70 ? 1900 + value : 2000 + value) : value;
+            }
+        } else if (token.size() >= 3) {
+            std::string name = asciiLowerCopy(token.substr(0, 3));
+            for (int m = 0; m < 12; m++) {
+                if (name == months[m]) month = m + 1;
+            }
+        }
+        token.clear();
+    }
+    if (day < 1 || day > 31 || month < 1 || year < 1970 || hh < 0 || hh > 23 || mm < 0 || mm > 59 ||
+        ss < 0 || ss > 60) {
+        return false;
+    }
+    out = daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * 86400 +
+          hh * 3600 + mm * 60 + ss;
+    return true;
+}
+
+struct CacheControl {
+    bool noStore = false;
+    bool noCache = false;
+    long long maxAge = -1;
+};
+
+inline CacheControl parseCacheControl(const std::string* header) {
+    CacheControl out;
+    if (!header) return out;
+    std::string value = asciiLowerCopy(*header);
+    size_t start = 0;
+    while (start <= value.size()) {
+        size_t end = value.find(',', start);
+        if (end == std::string::npos) end = value.size();
+        std::string directive = value.substr(start, end - start);
+        size_t first = directive.find_first_not_of(" \t");
+        size_t last = directive.find_last_not_of(" \t");
+        directive = first == std::string::npos ? "" : directive.substr(first, last - first + 1);
+
+        if (directive == "no-store") out.noStore = true;
+        else if (directive == "no-cache" || directive.compare(0, 9, "no-cache=") == 0) out.noCache = true;
+        else if (directive.compare(0, 8, "max-age=") == 0) out.maxAge = strtoll(directive.c_str() + 8, nullptr, 10);
+        start = end + 1;
+    }
+    return out;
+}
+
+// When a response stops being fresh, in unix seconds (0 = revalidate every time)
+inline long long freshUntil(const HttpResponse& response, long long receivedAt) {
+    CacheControl control = parseCacheControl(response.header("cache-control"));
+    if (control.noCache) return 0;
+
+    long long age = 0;
+    const std::string* ageHeader = response.header("age");
+    if (ageHeader) age = std::max(0LL, strtoll(ageHeader->c_str(), nullptr, 10));
+    if (control.maxAge >= 0) return control.maxAge > age ? receivedAt + control.maxAge - age : 0;
+
+    const std::string* expires = response.header("expires");
+    long long expiresAt = 0;
+    if (!expires || !parseHttpDate(*expires, expiresAt)) return 0;
+    // Measure against the server's clock when it sent one
+    long long serverDate = 0;
+    const std::string* date = response.header("date");
+    if (date && parseHttpDate(*date, serverDate)) return receivedAt + std::max(0LL, expiresAt - serverDate);
+    return expiresAt;
+}
+
+// ============================================================================
+// ON-DISK HTTP CACHE
+// ============================================================================
+// <dir>/meta/<hash of url>.meta  status line, freshness and headers of one URL
+// <dir>/body/<hash of body>      response bodies, shared by URLs serving the same bytes
+// Files are written under <dir>/tmp and renamed into place, so a reader (or a
+// second browser process) never sees a half-written entry.
+
+struct CacheHit {
+    int status = 0;
+    HttpHeaders headers;
+    std::string body;
+    bool fresh = false;
+};
+
+class HttpCache {
+private:
+    struct Entry {
+        std::string url;
+        int status = 0;
+        HttpHeaders headers;
+        std::string bodyKey;
+        long long bodySize = 0;
+        long long metaSize = 0;
+        long long expiresAt = 0;
+        std::atomic<long long> lastUsed;
+
+        Entry() : lastUsed(0) {}
+
+        const std::string* header(const char* name) const {
+            for (size_t i = 0; i < headers.size(); i++) {
+                if (headers[i].first == name) return &headers[i].second;
+            }
+            return nullptr;
+        }
+    };
+
+    std::filesystem::path root;
+    long long maxBytes;
+    mutable std::shared_mutex lock;   // shared: lookups, exclusive: index changes
+    std::map<std::string, Entry*> entries;            // normalized url -> entry
+    std::map<std::string, int> bodyRefs;              // body key -> entries using it
+    long long totalBytes;
+    mutable std::atomic<long long> useClock;
+    std::atomic<int> tempSerial;
+
+    std::atomic<long> hits;
+    std::atomic<long> revalidated;
+    std::atomic<long> misses;
+    std::atomic<long> stores;
+    std::atomic<long> evictions;
+
+    std::filesystem::path metaPath(const std::string& url) const {
+        return root / "meta" / (contentHashHex(url) + ".meta");
+    }
+
+    std::filesystem::path bodyPath(const std::string& key) const {
+        return root / "body" / key;
+    }
+
+    // Writes data to a fresh temp file and renames it over target
+    bool writeAtomically(const std::filesystem::path& target, const std::string& data) {
+        std::ostringstream name;
+        name << std::this_thread::get_id() << "_" << ++tempSerial << ".tmp";
+        std::filesystem::path temp = root / "tmp" / name.str();
+        {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return false;
+            out.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!out.good()) {
+                out.close();
+                std::filesystem::remove(temp);
+                return false;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp, target, ec);
+        if (ec) std::filesystem::remove(temp, ec);
+        return !ec;
+    }
+
+    static bool readFile(const std::filesystem::path& path, std::string& out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) return false;
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        out = ss.str();
+        return true;
+    }
+
+    static std::string serialize(const Entry& entry) {
+        std::string out = "SimpleBrowserCache 1\n";
+        out += "url " + entry.url + "\n";
+        out += "status " + std::to_string(entry.status) + "\n";
+        out += "expires " + std::to_string(entry.expiresAt) + "\n";
+        out += "body " + entry.bodyKey + " " + std::to_string(entry.bodySize) + "\n";
+        for (size_t i = 0; i < entry.headers.size(); i++) {
+            out += "h " + entry.headers[i].first + ": " + entry.headers[i].second + "\n";
+        }
+        return out;
+    }
+
+    static bool deserialize(const std::string& text, Entry& entry) {
+        std::istringstream in(text);
+        std::string line;
+        if (!std::getline(in, line) || line != "SimpleBrowserCache 1") return false;
+        while (std::getline(in, line)) {
+            size_t sp = line.find(' ');
+            if (sp == std::string::npos) continue;
+            std::string field = line.substr(0, sp);
+            std::string value = line.substr(sp + 1);
+            if (field == "url") {
+                entry.url = value;
+            } else if (field == "status") {
+                entry.status = atoi(value.c_str());
+            } else if (field == "expires") {
+                entry.expiresAt = strtoll(value.c_str(), nullptr, 10);
+            } else if (field == "body") {
+                size_t sizeAt = value.find(' ');
+                if (sizeAt == std::string::npos) return false;
+                entry.bodyKey = value.substr(0, sizeAt);
+                entry.bodySize = strtoll(value.c_str() + sizeAt + 1, nullptr, 10);
+            } else if (field == "h") {
+                size_t colon = value.find(": ");
+                if (colon != std::string::npos) {
+                    entry.headers.push_back(std::make_pair(value.substr(0, colon), value.substr(colon + 2)));
+                }
+            }
+        }
+        return !entry.url.empty() && !entry.bodyKey.empty();
+    }
+
+    // Caller holds the exclusive lock
+    void addBodyRef(const std::string& key, long long size) {
+        if (bodyRefs[key]++ == 0) totalBytes += size;
+    }
+
+    void dropBodyRef(const std::string& key, long long size) {
+        std::map<std::string, int>::iterator it = bodyRefs.find(key);
+        if (it == bodyRefs.end()) return;
+        if (--it->second == 0) {
+            bodyRefs.erase(it);
+            totalBytes -= size;
+            std::error_code ec;
+            std::filesystem::remove(bodyPath(key), ec);
+        }
+    }
+
+    void removeEntry(std::map<std::string, Entry*>::iterator it) {
+        Entry* entry = it->second;
+        std::error_code ec;
+        std::filesystem::remove(metaPath(entry->url), ec);
+        totalBytes -= entry->metaSize;
+        dropBodyRef(entry->bodyKey, entry->bodySize);
+        entries.erase(it);
+        delete entry;
+    }
+
+    // Drops least recently used entries until the cache is back under 90% of its limit
+    void evictIfNeeded() {
+        if (totalBytes <= maxBytes) return;
+        std::vector<std::pair<long long, std::string>> byAge;
+        for (std::map<std::string, Entry*>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            byAge.push_back(std::make_pair(it->second->lastUsed.load(), it->first));
+        }
+        std::sort(byAge.begin(), byAge.end());
+        long long target = maxBytes - maxBytes / 10;
+        for (size_t i = 0; i < byAge.size() && totalBytes > target; i++) {
+            removeEntry(entries.find(byAge[i].second));
+            evictions++;
+        }
+    }
+
+    // Rebuilds the index from disk; recency follows the meta files' mtimes
+    void loadIndex() {
+        std::error_code ec;
+        std::vector<std::pair<std::filesystem::file_time_type, Entry*>> loaded;
+        for (std::filesystem::directory_iterator it(root / "meta", ec), end; !ec && it != end; it.increment(ec)) {
+            std::string text;
+            Entry* entry = new Entry();
+            std::error_code bodyEc;
+            if (!readFile(it->path(), text) || !deserialize(text, *entry) ||
+                !std::filesystem::exists(bodyPath(entry->bodyKey), bodyEc) || entries.count(entry->url)) {
+                delete entry;
+                std::filesystem::remove(it->path(), bodyEc);
+                continue;
+            }
+            entry->metaSize = static_cast<long long>(text.size());
+            loaded.push_back(std::make_pair(std::filesystem::last_write_time(it->path(), bodyEc), entry));
+        }
+        std::sort(loaded.begin(), loaded.end(),
+                  [](const std::pair<std::filesystem::file_time_type, Entry*>& a,
+                     const std::pair<std::filesystem::file_time_type, Entry*>& b) { return a.first < b.first; });
+        for (size_t i = 0; i < loaded.size(); i++) {
+            Entry* entry = loaded[i].second;
+            entry->lastUsed = ++useClock;
+            entries[entry->url] = entry;
+            totalBytes += entry->metaSize;
+            addBodyRef(entry->bodyKey, entry->bodySize);
+        }
+
+        // Bodies no entry points at are leftovers from a crash or another process
+        for (std::filesystem::directory_iterator it(root / "body", ec), end; !ec && it != end; it.increment(ec)) {
+            if (!bodyRefs.count(it->path().filename().string())) {
+                std::error_code removeEc;
+                std::filesystem::remove(it->path(), removeEc);
+            }
+        }
+        evictIfNeeded();
+    }
+
+    void touch(Entry* entry) const {
+        entry->lastUsed = ++useClock;
+        std::error_code ec;
+        std::filesystem::last_write_time(metaPath(entry->url), std::filesystem::file_time_type::clock::now(), ec);
+    }
+
+    bool writeEntry(Entry* entry) {
+        std::string text = serialize(*entry);
+        entry->metaSize = static_cast<long long>(text.size());
+        return writeAtomically(metaPath(entry->url), text);
+    }
+
+public:
+    HttpCache(const std::string& directory, long long maxSizeBytes)
+        : root(directory), maxBytes(maxSizeBytes), totalBytes(0), useClock(0), tempSerial(0),
+          hits(0), revalidated(0), misses(0), stores(0), evictions(0) {
+        std::error_code ec;
+        std::filesystem::create_directories(root / "meta", ec);
+        std::filesystem::create_directories(root / "body", ec);
+        std::filesystem::create_directories(root / "tmp", ec);
+        loadIndex();
+    }
+
+    ~HttpCache() {
+        for (std::map<std::string, Entry*>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            delete it->second;
+        }
+    }
+
+    // Copies out the cached response for url; safe to call from many threads at once
+    bool lookup(const std::string& url, CacheHit& out) const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        std::map<std::string, Entry*>::const_iterator it = entries.find(normalizeCacheUrl(url));
+        if (it == entries.end()) return false;
+        Entry* entry = it->second;
+        // The body can only be deleted under the exclusive lock, so it is still there
+        if (!readFile(bodyPath(entry->bodyKey), out.body) ||
+            static_cast<long long>(out.body.size()) != entry->bodySize) {
+            return false;
+        }
+        out.status = entry->status;
+        out.headers = entry->headers;
+        out.fresh = entry->expiresAt > unixNow();
+        touch(entry);
+        return true;
+    }
+
+    // Validators to send when revalidating a stale entry
+    bool conditionalHeaders(const std::string& url, HttpHeaders& out) const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        std::map<std::string, Entry*>::const_iterator it = entries.find(normalizeCacheUrl(url));
+        if (it == entries.end()) return false;
+        const std::string* etag = it->second->header("etag");
+        const std::string* lastModified = it->second->header("last-modified");
+        if (etag) out.push_back(std::make_pair(std::string("If-None-Match"), *etag));
+        if (lastModified) out.push_back(std::make_pair(std::string("If-Modified-Since"), *lastModified));
+        return etag || lastModified;
+    }
+
+    // Saves a 200 response unless it asks not to be stored or could never be reused
+    bool store(const std::string& url, const HttpResponse& response, const std::string& body) {
+        if (response.status != 200) return false;
+        CacheControl control = parseCacheControl(response.header("cache-control"));
+        long long expiresAt = freshUntil(response, unixNow());
+        bool hasValidator = response.header("etag") || response.header("last-modified");
+        if (control.noStore || (expiresAt == 0 && !hasValidator)) return false;
+        if (static_cast<long long>(body.size()) > maxBytes / 2) return false;
+
+        Entry* entry = new Entry();
+        entry->url = normalizeCacheUrl(url);
+        entry->status = response.status;
+        entry->bodyKey = contentHashHex(body);
+        entry->bodySize = static_cast<long long>(body.size());
+        entry->expiresAt = expiresAt;
+        for (size_t i = 0; i < response.headers.size(); i++) {
+            const std::string& name = response.headers[i].first;
+            // Per-connection headers mean nothing when replayed from disk
+            if (name == "connection" || name == "keep-alive" || name == "transfer-encoding" ||
+                name == "content-length") {
+                continue;
+            }
+            entry->headers.push_back(response.headers[i]);
+        }
+
+        // Body goes in first, outside the lock; identical bodies share a file
+        std::filesystem::path bodyFile = bodyPath(entry->bodyKey);
+        bool bodyOnDisk = false;
+        {
+            std::shared_lock<std::shared_mutex> guard(lock);
+            bodyOnDisk = bodyRefs.count(entry->bodyKey) > 0;
+        }
+        if (!bodyOnDisk && !writeAtomically(bodyFile, body)) {
+            delete entry;
+            return false;
+        }
+
+        std::unique_lock<std::shared_mutex> guard(lock);
+        std::error_code existsEc;
+        // An eviction may have removed the shared body since it was checked
+        if (!bodyRefs.count(entry->bodyKey) && !std::filesystem::exists(bodyFile, existsEc) &&
+            !writeAtomically(bodyFile, body)) {
+            delete entry;
+            return false;
+        }
+        if (!writeEntry(entry)) {
+            if (!bodyRefs.count(entry->bodyKey)) {
+                std::error_code ec;
+                std::filesystem::remove(bodyFile, ec);
+            }
+            delete entry;
+            return false;
+        }
+        addBodyRef(entry->bodyKey, entry->bodySize);
+        std::map<std::string, Entry*>::iterator old = entries.find(entry->url);
+        if (old != entries.end()) {
+            totalBytes -= old->second->metaSize;
+            dropBodyRef(old->second->bodyKey, old->second->bodySize);
+            delete old->second;
+            entries.erase(old);
+        }
+        entry->lastUsed = ++useClock;
+        entries[entry->url] = entry;
+        totalBytes += entry->metaSize;
+        stores++;
+        evictIfNeeded();
+        return true;
+    }
+
+    // 304 Not Modified: merge the new headers and restart the freshness clock
+    bool refresh(const std::string& url, const HttpResponse& notModified) {
+        std::unique_lock<std::shared_mutex> guard(lock);
+        std::map<std::string, Entry*>::iterator it = entries.find(normalizeCacheUrl(url));
+        if (it == entries.end()) return false;
+        Entry* entry = it->second;
+        for (size_t i = 0; i < notModified.headers.size(); i++) {
+            const std::pair<std::string, std::string>& header = notModified.headers[i];
+            if (header.first == "connection" || header.first == "keep-alive" || header.first == "content-length" ||
+                header.first == "transfer-encoding") {
+                continue;
+            }
+            bool replaced = false;
+            for (size_t j = 0; j < entry->headers.size(); j++) {
+                if (entry->headers[j].first == header.first) {
+                    entry->headers[j].second = header.second;
+                    replaced = true;
+                }
+            }
+            if (!replaced) entry->headers.push_back(header);
+        }
+        HttpResponse merged;
+        merged.headers = entry->headers;
+        entry->expiresAt = freshUntil(merged, unixNow());
+
+        totalBytes -= entry->metaSize;
+        writeEntry(entry);
+        totalBytes += entry->metaSize;
+        entry->lastUsed = ++useClock;
+        return true;
+    }
+
+    void countHit() { hits++; }
+    void countRevalidated() { revalidated++; }
+    void countMiss() { misses++; }
+
+    long getHits() const { return hits.load(); }
+    long getRevalidated() const { return revalidated.load(); }
+    long getMisses() const { return misses.load(); }
+    long getStores() const { return stores.load(); }
+    long getEvictions() const { return evictions.load(); }
+
+    long long getSizeBytes() const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        return totalBytes;
+    }
+
+    size_t getEntryCount() const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        return entries.size();
+    }
+};
+
+// ============================================================================
+// CACHED GET
+// ============================================================================
+
+// Hands a stored body over in network-sized pieces so an incremental consumer
+// sees it the same way as a download
+inline bool replayCachedBody(const std::string& body, const HttpBodySink& sink, std::string& error) {
+    const size_t piece = 16 * 1024;
+    for (size_t pos = 0; pos < body.size(); pos += piece) {
+        if (!sink(body.data() + pos, std::min(piece, body.size() - pos))) {
+            error = "aborted";
+            return false;
+        }
+    }
+    return true;
+}
+
+// GET through the cache: a fresh entry never touches the network, a stale one
+// is revalidated with If-None-Match / If-Modified-Since and a 304 replays the
+// stored body. Either way the body reaches bodySink (or response.body) as 200.
+inline bool cachedGet(HttpClient& client, HttpCache& cache, const std::string& url, HttpResponse& response,
+                      std::string& error, const CancelToken* cancel = nullptr,
+                      const HttpBodySink* bodySink = nullptr) {
+    bool streaming = bodySink && *bodySink;
+    CacheHit hit;
+    bool cached = cache.lookup(url, hit);
+
+    if (cached && hit.fresh) {
+        cache.countHit();
+        response.status = hit.status;
+        response.reason = "OK";
+        response.headers.swap(hit.headers);
+        response.finalUrl = url;
+        response.redirects = 0;
+        if (!streaming) {
+            response.body.swap(hit.body);
+            return true;
+        }
+        return replayCachedBody(hit.body, *bodySink, error);
+    }
+
+    HttpHeaders conditional;
+    if (cached) cache.conditionalHeaders(url, conditional);
+
+    // Keep a copy of whatever streams past so it can be stored afterwards
+    std::string body;
+    HttpBodySink tee = [&body, bodySink, streaming](const char* data, size_t len) {
+        body.append(data, len);
+        return !streaming || (*bodySink)(data, len);
+    };
+    if (!client.get(url, response, error, cancel, conditional.empty() ? nullptr : &conditional, &tee)) {
+        return false;
+    }
+
+    if (response.status == 304 && cached && response.redirects == 0) {
+        cache.countRevalidated();
+        cache.refresh(url, response);
+        CacheHit current;
+        if (cache.lookup(url, current)) hit = current;
+        response.status = 200;
+        response.reason = "OK";
+        response.headers.swap(hit.headers);
+        if (!streaming) {
+            response.body.swap(hit.body);
+            return true;
+        }
+        return replayCachedBody(hit.body, *bodySink, error);
+    }
+    if (response.status == 304) {
+        // Validators went to a different URL after a redirect; ask plainly
+        body.clear();
+        if (!client.get(url, response, error, cancel, nullptr, &tee)) return false;
+    }
+
+    cache.countMiss();
+    if (response.status == 200) {
+        // After a redirect the body belongs to the final URL, not the one asked for
+        cache.store(response.redirects == 0 ? url : response.finalUrl, response, body);
+        if (!streaming) response.body.swap(body);
+    }
+    return true;
+}
+
+#endif // HTTP_CACHE_H
@@ -0,0 +1,627 @@
+#ifndef HTTP_FETCHER_H
+#define HTTP_FETCHER_H
+
+#ifdef _WIN32
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600 // WSAPoll
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // macOS
+#endif
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "cancel_token.h"
+
+// ============================================================================
+// SOCKET PORTABILITY
+// ============================================================================
+
+#ifdef _WIN32
+typedef SOCKET socket_t;
+static const socket_t INVALID_SOCKET_T = INVALID_SOCKET;
+
+inline void closeSocket(socket_t s) {
+    closesocket(s);
+}
+
+inline int pollSocket(socket_t s, short events, int timeoutMs) {
+    WSAPOLLFD pfd{};
+    pfd.fd = s;
+    pfd.events = events;
+    return WSAPoll(&pfd, 1, timeoutMs);
+}
+
+inline bool ensureSocketsStarted() {
+    static bool started = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return started;
+}
+#else
+typedef int socket_t;
+static const socket_t INVALID_SOCKET_T = -1;
+
+inline void closeSocket(socket_t s) {
+    close(s);
+}
+
+inline int pollSocket(socket_t s, short events, int timeoutMs) {
+    struct pollfd pfd{};
+    pfd.fd = s;
+    pfd.events = events;
+    return poll(&pfd, 1, timeoutMs);
+}
+
+inline bool ensureSocketsStarted() {
+    return true;
+}
+#endif
+
+inline void setNonBlocking(socket_t s, bool enabled) {
+#ifdef _WIN32
+    u_long mode = enabled ? 1 : 0;
+    ioctlsocket(s, FIONBIO, &mode);
+#else
+    int flags = fcntl(s, F_GETFL, 0);
+    fcntl(s, F_SETFL, enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK));
+#endif
+}
+
+// ============================================================================
+// URL HELPERS
+// ============================================================================
+
+struct ParsedUrl {
+    std::string scheme;
+    std::string host;
+    int port = 0;
+    std::string path; // includes the query, never the fragment
+};
+
+inline std::string asciiLowerCopy(const std::string& s) {
+    std::string out(s);
+    for (size_t i = 0; i < out.size(); i++) {
+        if (out[i] >= 'A' && out[i] <= 'Z') out[i] = static_cast<char>(out[i] - 'A' + 'a');
+    }
+    return out;
+}
+
+// True if s holds a control character (C0, DEL): nothing a url should carry
+inline bool hasControlChars(const std::string& s) {
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        if (c < 0x20 || c == 0x7F) return true;
+    }
+    return false;
+}
+
+inline bool parseUrl(const std::string& url, ParsedUrl& out) {
+    size_t schemeEnd = url.find("://");
+    if (schemeEnd == std::string::npos) return false;
+    out.scheme = asciiLowerCopy(url.substr(0, schemeEnd));
+
+    size_t hostStart = schemeEnd + 3;
+    size_t hostEnd = url.find_first_of("/?#", hostStart);
+    if (hostEnd == std::string::npos) hostEnd = url.size();
+    std::string authority = url.substr(hostStart, hostEnd - hostStart);
+    size_t at = authority.rfind('@');
+    if (at != std::string::npos) authority = authority.substr(at + 1);
+
+    out.port = out.scheme == "https" ? 443 : 80;
+    size_t colon = authority.rfind(':');
+    if (colon != std::string::npos && authority.find(']') == std::string::npos) {
+        out.port = atoi(authority.c_str() + colon + 1);
+        authority = authority.substr(0, colon);
+    }
+    out.host = asciiLowerCopy(authority);
+    if (out.host.empty() || out.port <= 0 || out.port > 65535) return false;
+
+    size_t fragment = url.find('#', hostEnd);
+    out.path = url.substr(hostEnd, fragment == std::string::npos ? std::string::npos : fragment - hostEnd);
+    if (out.path.empty() || out.path[0] == '?') out.path = "/" + out.path;
+    return true;
+}
+
+// Collapses "." and ".." segments of an absolute path (query left alone)
+inline std::string removeDotSegments(const std::string& path) {
+    size_t queryStart = path.find('?');
+    std::string pathPart = path.substr(0, queryStart);
+    std::string query = queryStart == std::string::npos ? "" : path.substr(queryStart);
+
+    std::vector<std::string> segments;
+    size_t i = 1;
+    while (i <= pathPart.size()) {
+        size_t next = pathPart.find('/', i);
+        if (next == std::string::npos) next = pathPart.size();
+        std::string segment = pathPart.substr(i, next - i);
+        bool last = next == pathPart.size();
+        if (segment == "..") {
+            if (!segments.empty()) segments.pop_back();
+            if (last) segments.push_back("");
+        } else if (segment == ".") {
+            if (last) segments.push_back("");
+        } else {
+            segments.push_back(segment);
+        }
+        i = next + 1;
+    }
+
+    std::string out;
+    for (size_t s = 0; s < segments.size(); s++) {
+        out += "/";
+        out += segments[s];
+    }
+    if (out.empty()) out = "/";
+    return out + query;
+}
+
+// Resolves a link or Location header against the page it came from
+inline std::string resolveUrl(const std::string& base, const std::string& ref) {
+    if (ref.empty()) return base;
+    if (ref.find("://") != std::string::npos && ref.find("://") < ref.find_first_of("/?#")) return ref;
+
+    ParsedUrl b;
+    if (!parseUrl(base, b)) return ref;
+    bool defaultPort = (b.scheme == "http" && b.port == 80) || (b.scheme == "https" && b.port == 443);
+    std::string origin = b.scheme + "://" + b.host + (defaultPort ? "" : ":" + std::to_string(b.port));
+
+    if (ref.compare(0, 2, "//") == 0) return b.scheme + ":" + ref;
+    if (ref[0] == '#') return origin + b.path + ref;
+    if (ref[0] == '/') return origin + removeDotSegments(ref);
+    if (ref[0] == '?') return origin + b.path.substr(0, b.path.find('?')) + ref;
+
+    std::string dir = b.path.substr(0, b.path.find('?'));
+    dir = dir.substr(0, dir.rfind('/') + 1);
+    return origin + removeDotSegments(dir + ref);
+}
+
+// ============================================================================
+// HTTP RESPONSE
+// ============================================================================
+
+typedef std::vector<std::pair<std::string, std::string>> HttpHeaders;
+
+// Receives body bytes as they come off the socket; return false to abort
+typedef std::function<bool(const char* data, size_t len)> HttpBodySink;
+
+struct HttpResponse {
+    int status = 0;
+    std::string reason;
+    HttpHeaders headers; // names are lowercase
+    std::string body;
+    std::string finalUrl;
+    int redirects = 0;
+
+    bool isRedirect() const {
+        return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+    }
+
+    const std::string* header(const char* name) const {
+        for (size_t i = 0; i < headers.size(); i++) {
+            if (headers[i].first == name) return &headers[i].second;
+        }
+        return nullptr;
+    }
+};
+
+struct HttpOptions {
+    int connectTimeoutMs = 10000;
+    int readTimeoutMs = 15000;    // max silence while waiting for bytes
+    int maxRedirects = 5;
+    int maxIdlePerHost = 4;
+};
+
+// ============================================================================
+// HTTP CLIENT (HTTP/1.1 with per-host keep-alive pools)
+// ============================================================================
+
+class HttpClient {
+private:
+    // One socket plus whatever was read past the current parse point
+    struct Connection {
+        socket_t fd = INVALID_SOCKET_T;
+        std::string buffer;
+        size_t pos = 0;
+        bool reused = false;
+    };
+
+    HttpOptions options;
+    std::mutex poolLock;
+    std::map<std::string, std::vector<socket_t>> idle; // "host:port" -> idle sockets
+    std::atomic<long> opened;
+    std::atomic<long> reused;
+
+    static std::string poolKey(const ParsedUrl& url) {
+        return url.host + ":" + std::to_string(url.port);
+    }
+
+    // An idle keep-alive socket is only usable if the server hasn't closed it
+    static bool stillUsable(socket_t fd) {
+        return pollSocket(fd, POLLIN, 0) == 0;
+    }
+
+    bool acquire(const ParsedUrl& url, Connection& conn, bool allowReuse, std::string& error) {
+        std::string key = poolKey(url);
+        if (allowReuse) {
+            std::lock_guard<std::mutex> guard(poolLock);
+            std::vector<socket_t>& sockets = idle[key];
+            while (!sockets.empty()) {
+                socket_t fd = sockets.back();
+                sockets.pop_back();
+                if (stillUsable(fd)) {
+                    conn.fd = fd;
+                    conn.reused = true;
+                    reused++;
+                    return true;
+                }
+                closeSocket(fd);
+            }
+        }
+        return connectTo(url, conn, error);
+    }
+
+    void release(const ParsedUrl& url, Connection& conn, bool keepAlive) {
+        if (conn.fd == INVALID_SOCKET_T) return;
+        if (keepAlive) {
+            std::lock_guard<std::mutex> guard(poolLock);
+            std::vector<socket_t>& sockets = idle[poolKey(url)];
+            if (static_cast<int>(sockets.size()) < options.maxIdlePerHost) {
+                sockets.push_back(conn.fd);
+                conn.fd = INVALID_SOCKET_T;
+                return;
+            }
+        }
+        closeSocket(conn.fd);
+        conn.fd = INVALID_SOCKET_T;
+    }
+
+    bool connectTo(const ParsedUrl& url, Connection& conn, std::string& error) {
+        if (!ensureSocketsStarted()) {
+            error = "socket startup failed";
+            return false;
+        }
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        struct addrinfo* results = nullptr;
+        std::string port = std::to_string(url.port);
+        if (getaddrinfo(url.host.c_str(), port.c_str(), &hints, &results) != 0 || !results) {
+            error = "cannot resolve " + url.host;
+            return false;
+        }
+
+        for (struct addrinfo* ai = results; ai; ai = ai->ai_next) {
+            socket_t fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (fd == INVALID_SOCKET_T) continue;
+
+            setNonBlocking(fd, true);
+            int rc = connect(fd, ai->ai_addr, static_cast<int>(ai->ai_addrlen));
+            bool connected = rc == 0;
+            if (!connected && pollSocket(fd, POLLOUT, options.connectTimeoutMs) > 0) {
+                int soError = 0;
+                socklen_t len = sizeof(soError);
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&soError), &len);
+                connected = soError == 0;
+            }
+            if (connected) {
+                setNonBlocking(fd, false);
+                int noDelay = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+                freeaddrinfo(results);
+                conn.fd = fd;
+                conn.reused = false;
+                opened++;
+                return true;
+            }
+            closeSocket(fd);
+        }
+        freeaddrinfo(results);
+        error = "cannot connect to " + url.host + ":" + std::to_string(url.port);
+        return false;
+    }
+
+    static bool sendAll(socket_t fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+#ifdef _WIN32
+            int n = send(fd, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+#else
+            ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+#endif
+            if (n <= 0) return false;
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    // Appends more bytes to conn.buffer; false on close, timeout or cancel
+    bool fill(Connection& conn, std::string& error, const CancelToken* cancel) {
+        if (conn.pos > 0 && conn.pos == conn.buffer.size()) {
+            conn.buffer.clear();
+            conn.pos = 0;
+        }
+
+        int waited = 0;
+        while (true) {
+            if (cancel && cancel->isCancelled()) {
+                error = "cancelled";
+                return false;
+            }
+            int slice = 100;
+            int ready = pollSocket(conn.fd, POLLIN, slice);
+            if (ready < 0) {
+                error = "poll failed";
+                return false;
+            }
+            if (ready > 0) break;
+            waited += slice;
+            if (waited >= options.readTimeoutMs) {
+                error = "timed out waiting for server";
+                return false;
+            }
+        }
+
+        char chunk[16384];
+        int n = static_cast<int>(recv(conn.fd, chunk, sizeof(chunk), 0));
+        if (n <= 0) {
+            error = "connection closed";
+            return false;
+        }
+        conn.buffer.append(chunk, static_cast<size_t>(n));
+        return true;
+    }
+
+    bool readLine(Connection& conn, std::string& line, std::string& error, const CancelToken* cancel) {
+        while (true) {
+            size_t eol = conn.buffer.find("\r\n", conn.pos);
+            if (eol != std::string::npos) {
+                line = conn.buffer.substr(conn.pos, eol - conn.pos);
+                conn.pos = eol + 2;
+                return true;
+            }
+            if (!fill(conn, error, cancel)) return false;
+        }
+    }
+
+    // Hands exactly count body bytes to sink (count < 0 means until close)
+    bool readBody(Connection& conn, long long count, const HttpBodySink& sink, std::string& error,
+                  const CancelToken* cancel) {
+        while (count != 0) {
+            if (conn.pos == conn.buffer.size()) {
+                std::string fillError;
+                if (!fill(conn, fillError, cancel)) {
+                    if (count < 0 && fillError == "connection closed") return true;
+                    error = fillError;
+                    return false;
+                }
+            }
+            size_t available = conn.buffer.size() - conn.pos;
+            size_t take = (count < 0 || static_cast<long long>(available) < count) ? available : static_cast<size_t>(count);
+            if (!sink(conn.buffer.data() + conn.pos, take)) {
+                error = "aborted";
+                return false;
+            }
+            conn.pos += take;
+            if (count > 0) count -= static_cast<long long>(take);
+        }
+        return true;
+    }
+
+    bool readChunkedBody(Connection& conn, const HttpBodySink& sink, std::string& error, const CancelToken* cancel) {
+        std::string line;
+        while (true) {
+            if (!readLine(conn, line, error, cancel)) return false;
+            long long size = strtoll(line.c_str(), nullptr, 16); // chunk extensions after ';' are ignored
+            if (size < 0) {
+                error = "bad chunk size";
+                return false;
+            }
+            if (size == 0) break;
+            if (!readBody(conn, size, sink, error, cancel)) return false;
+            if (!readLine(conn, line, error, cancel)) return false; // CRLF after the chunk data
+        }
+        // Trailer headers end with an empty line
+        do {
+            if (!readLine(conn, line, error, cancel)) return false;
+        } while (!line.empty());
+        return true;
+    }
+
+    // One request/response exchange; sets keepAlive if the socket can be pooled
+    bool exchange(Connection& conn, const ParsedUrl& url, const HttpHeaders* extraHeaders,
+                  const HttpBodySink* bodySink, HttpResponse& response, bool& keepAlive,
+                  bool& sentNothingBack, std::string& error, const CancelToken* cancel) {
+        bool defaultPort = (url.scheme == "http" && url.port == 80);
+        std::string request = "GET " + url.path + " HTTP/1.1\r\n";
+        request += "Host: " + url.host + (defaultPort ? "" : ":" + std::to_string(url.port)) + "\r\n";
+        request += "User-Agent: SimpleBrowser/1.0\r\n";
+        request += "Accept: text/html,*/*\r\n";
+        request += "Accept-Encoding: identity\r\n";
+        request += "Connection: keep-alive\r\n";
+        if (extraHeaders) {
+            for (size_t i = 0; i < extraHeaders->size(); i++) {
+                request += (*extraHeaders)[i].first + ": " + (*extraHeaders)[i].second + "\r\n";
+            }
+        }
+        request += "\r\n";
+
+        sentNothingBack = true;
+        if (!sendAll(conn.fd, request)) {
+            error = "send failed";
+            return false;
+        }
+
+        std::string line;
+        do {
+            if (!readLine(conn, line, error, cancel)) return false;
+            sentNothingBack = false;
+            // Status line: HTTP/1.1 200 OK (skip interim 1xx responses)
+            if (line.compare(0, 5, "HTTP/") != 0) {
+                error = "malformed status line";
+                return false;
+            }
+            size_t sp = line.find(' ');
+            response.status = sp == std::string::npos ? 0 : atoi(line.c_str() + sp + 1);
+            size_t sp2 = sp == std::string::npos ? std::string::npos : line.find(' ', sp + 1);
+            response.reason = sp2 == std::string::npos ? "" : line.substr(sp2 + 1);
+            bool http10 = line.compare(0, 8, "HTTP/1.0") == 0;
+            keepAlive = !http10;
+
+            response.headers.clear();
+            while (true) {
+                if (!readLine(conn, line, error, cancel)) return false;
+                if (line.empty()) break;
+                size_t colon = line.find(':');
+                if (colon == std::string::npos) continue;
+                std::string name = asciiLowerCopy(line.substr(0, colon));
+                size_t valueStart = line.find_first_not_of(" \t", colon + 1);
+                std::string value = valueStart == std::string::npos ? "" : line.substr(valueStart);
+                while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.pop_back();
+                response.headers.push_back(std::make_pair(name, value));
+            }
+        } while (response.status >= 100 && response.status < 200);
+
+        const std::string* connection = response.header("connection");
+        if (connection) {
+            std::string c = asciiLowerCopy(*connection);
+            if (c.find("close") != std::string::npos) keepAlive = false;
+            if (c.find("keep-alive") != std::string::npos) keepAlive = true;
+        }
+
+        response.body.clear();
+        if (response.status == 204 || response.status == 304) return true;
+
+        // Only a final 200 is streamed; redirect and error bodies are kept whole
+        bool streamed = bodySink && *bodySink && response.status == 200;
+        HttpBodySink sink;
+        if (streamed) {
+            sink = *bodySink;
+        } else {
+            std::string* body = &response.body;
+            sink = [body](const char* data, size_t len) {
+                body->append(data, len);
+                return true;
+            };
+        }
+
+        const std::string* transferEncoding = response.header("transfer-encoding");
+        const std::string* contentLength = response.header("content-length");
+        if (transferEncoding && asciiLowerCopy(*transferEncoding).find("chunked") != std::string::npos) {
+            return readChunkedBody(conn, sink, error, cancel);
+        }
+        if (contentLength) {
+            long long length = strtoll(contentLength->c_str(), nullptr, 10);
+            if (!streamed) response.body.reserve(static_cast<size_t>(length > 0 ? length : 0));
+            return readBody(conn, length, sink, error, cancel);
+        }
+        keepAlive = false; // body ends when the server closes
+        return readBody(conn, -1, sink, error, cancel);
+    }
+
+public:
+    explicit HttpClient(const HttpOptions& opts = HttpOptions())
+        : options(opts), opened(0), reused(0) {}
+
+    ~HttpClient() {
+        std::lock_guard<std::mutex> guard(poolLock);
+        for (std::map<std::string, std::vector<socket_t>>::iterator it = idle.begin(); it != idle.end(); ++it) {
+            for (size_t i = 0; i < it->second.size(); i++) {
+                closeSocket(it->second[i]);
+            }
+        }
+    }
+
+    // GET url into response, following redirects. Only plain http:// is spoken
+    // here; callers route https:// elsewhere. A redirect to https:// (or any
+    // other scheme) is not followed: the 3xx comes back with finalUrl set to
+    // where it points. With bodySink set, a 200 body is handed over piece by
+    // piece instead of being stored in response.body.
+    bool get(const std::string& url, HttpResponse& response, std::string& error,
+             const CancelToken* cancel = nullptr, const HttpHeaders* extraHeaders = nullptr,
+             const HttpBodySink* bodySink = nullptr) {
+        std::string current = url;
+        response.redirects = 0;
+
+        while (true) {
+            ParsedUrl parsed;
+            if (!parseUrl(current, parsed)) {
+                error = "bad url: " + current;
+                return false;
+            }
+            if (parsed.scheme != "http") {
+                error = "unsupported scheme: " + parsed.scheme;
+                return false;
+            }
+
+            bool done = false;
+            // A pooled socket may have been dropped by the server while idle;
+            // if it dies before any reply, retry once on a fresh connection.
+            for (int attempt = 0; attempt < 2 && !done; attempt++) {
+                Connection conn;
+                if (!acquire(parsed, conn, attempt == 0, error)) return false;
+
+                bool keepAlive = false;
+                bool sentNothingBack = true;
+                bool ok = exchange(conn, parsed, extraHeaders, bodySink, response, keepAlive, sentNothingBack,
+                                   error, cancel);
+                if (!ok) {
+                    release(parsed, conn, false);
+                    if (conn.reused && sentNothingBack && !(cancel && cancel->isCancelled())) continue;
+                    return false;
+                }
+                release(parsed, conn, keepAlive);
+                done = true;
+            }
+            if (!done) return false;
+
+            response.finalUrl = current;
+            const std::string* location = response.header("location");
+            if (!response.isRedirect() || !location) return true;
+
+            if (response.redirects >= options.maxRedirects) {
+                error = "too many redirects";
+                return false;
+            }
+            response.redirects++;
+            current = resolveUrl(current, *location);
+            if (asciiLowerCopy(current.substr(0, 7)) != "http://") {
+                response.finalUrl = current;
+                return true;
+            }
+        }
+    }
+
+    long getConnectionsOpened() const {
+        return opened.load();
+    }
+
+    long getConnectionsReused() const {
+        return reused.load();
+    }
+};
+
+#endif // HTTP_FETCHER_H
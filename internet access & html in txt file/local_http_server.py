@@ -0,0 +1,197 @@
+import sys
+import time
+import argparse
+import functools
+import email.utils
+import os
+import urllib.parse
+from http.server import ThreadingHTTPServer, SimpleHTTPRequestHandler
+
+# Local stand-in for real websites so the browser pipeline can be driven offline.
+# Usage: python local_http_server.py [--port 8000] [--root folder] [--delay seconds] [--chunked]
+#                                    [--throttle bytes_per_second] [--max-age seconds] [--demo-site]
+# Any path with ?redirect=/other answers 302 to /other. Files carry ETag and
+# Last-Modified and conditional requests get 304, so the browser cache can be checked.
+# --demo-site serves a small generated site (index.html linking page1..page6.html)
+# instead of --root, for exercising link prefetch.
+
+
+DEMO_PAGES = 6
+
+
+def demo_page(path):
+    """Returns the generated page for path, or None if the demo site has no such page."""
+    name = urllib.parse.urlsplit(path).path.lstrip("/") or "index.html"
+    paragraphs = "".join("<p>Paragraph %d of %s, with enough text to be worth parsing.</p>\n" % (i, name)
+                         for i in range(1, 41))
+    if name == "index.html":
+        links = "".join('<li><a href="page%d.html">Page %d</a></li>\n' % (i, i) for i in range(1, DEMO_PAGES + 1))
+        links += '<li><a href="/private.html" rel="nofollow">Private</a></li>\n'
+        links += '<li><a href="http://example.com/">Elsewhere</a></li>\n'
+        links += '<li><a href="#top">Top</a></li>\n'
+        body = "<h1>Demo site</h1>\n<ul>\n%s</ul>\n%s" % (links, paragraphs)
+    elif name == "private.html":
+        body = "<h1>Private</h1>\n<p>Only reachable through a nofollow link.</p>\n"
+    elif name.startswith("page") and name.endswith(".html") and name[4:-5].isdigit() \
+            and 1 <= int(name[4:-5]) <= DEMO_PAGES:
+        n = int(name[4:-5])
+        nav = '<p><a href="/index.html">Home</a> <a href="page%d.html">Next</a></p>\n' % (n % DEMO_PAGES + 1)
+        body = "<h1>Page %d</h1>\n%s%s" % (n, nav, paragraphs)
+    else:
+        return None
+    return ("<html><head><title>%s</title></head><body>\n%s</body></html>\n" % (name, body)).encode()
+
+
+class StandInHandler(SimpleHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True  # headers and body go out as separate writes
+    delay = 0.0
+    chunked = False
+    throttle = 0
+    max_age = -1
+    demo_site = False
+
+    def end_headers(self):
+        for name, value in getattr(self, "extra_headers", []):
+            self.send_header(name, value)
+        self.extra_headers = []
+        super().end_headers()
+
+    def validators(self):
+        path = self.translate_path(self.path)
+        try:
+            st = os.stat(path)
+        except OSError:
+            return None
+        if not os.path.isfile(path):
+            return None
+        etag = '"%x-%x"' % (st.st_mtime_ns, st.st_size)
+        return etag, int(st.st_mtime)
+
+    def not_modified(self, etag, mtime):
+        if_none_match = self.headers.get("If-None-Match")
+        if if_none_match is not None:
+            return etag in [t.strip() for t in if_none_match.split(",")] or if_none_match.strip() == "*"
+        if_modified_since = self.headers.get("If-Modified-Since")
+        if if_modified_since is not None:
+            try:
+                since = email.utils.parsedate_to_datetime(if_modified_since).timestamp()
+            except (TypeError, ValueError, IndexError):
+                return False
+            return mtime <= since
+        return False
+
+    def do_GET(self):
+        if self.delay > 0:
+            time.sleep(self.delay)
+
+        query = urllib.parse.parse_qs(urllib.parse.urlsplit(self.path).query)
+        if "redirect" in query:
+            self.send_response(302)
+            self.send_header("Location", query["redirect"][0])
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+            return
+
+        if self.demo_site:
+            self.send_demo_page()
+            return
+
+        found = self.validators()
+        if found:
+            etag, mtime = found
+            self.extra_headers = [("ETag", etag)]
+            if self.max_age >= 0:
+                self.extra_headers.append(("Cache-Control", "max-age=%d" % self.max_age))
+            if self.not_modified(etag, mtime):
+                self.send_response(304)
+                self.send_header("Last-Modified", self.date_time_string(mtime))
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+
+        if self.chunked or self.throttle > 0:
+            self.send_file()
+        else:
+            super().do_GET()
+
+    def write_body(self, data):
+        # With --throttle, dribble the body out like a slow link
+        step = 1000
+        for start in range(0, len(data), step):
+            piece = data[start:start + step]
+            if self.chunked:
+                piece = b"%x\r\n" % len(piece) + piece + b"\r\n"
+            self.wfile.write(piece)
+            if self.throttle > 0:
+                self.wfile.flush()
+                time.sleep(step / self.throttle)
+        if self.chunked:
+            self.wfile.write(b"0\r\n\r\n")
+
+    def send_file(self):
+        path = self.translate_path(self.path)
+        try:
+            with open(path, "rb") as f:
+                data = f.read()
+        except OSError:
+            self.send_error(404, "File not found")
+            return
+        self.send_response(200)
+        self.send_header("Content-Type", self.guess_type(path))
+        self.send_header("Last-Modified", self.date_time_string(int(os.stat(path).st_mtime)))
+        if self.chunked:
+            self.send_header("Transfer-Encoding", "chunked")
+        else:
+            self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.write_body(data)
+
+    def send_demo_page(self):
+        data = demo_page(self.path)
+        if data is None:
+            self.send_error(404, "File not found")
+            return
+        self.send_response(200)
+        self.send_header("Content-Type", "text/html")
+        if self.max_age >= 0:
+            self.send_header("Cache-Control", "max-age=%d" % self.max_age)
+        if self.chunked:
+            self.send_header("Transfer-Encoding", "chunked")
+        else:
+            self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.write_body(data)
+
+    def log_message(self, format, *args):
+        sys.stderr.write("[stand-in] " + (format % args) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--root", default=".")
+    parser.add_argument("--delay", type=float, default=0.0, help="seconds to wait before answering each request")
+    parser.add_argument("--chunked", action="store_true", help="send files with Transfer-Encoding: chunked")
+    parser.add_argument("--throttle", type=int, default=0, help="limit each response to this many bytes per second")
+    parser.add_argument("--max-age", type=int, default=-1, help="send Cache-Control: max-age with every file")
+    parser.add_argument("--demo-site", action="store_true", help="serve a generated site for link prefetch tests")
+    args = parser.parse_args()
+
+    StandInHandler.delay = args.delay
+    StandInHandler.chunked = args.chunked
+    StandInHandler.throttle = args.throttle
+    StandInHandler.max_age = args.max_age
+    StandInHandler.demo_site = args.demo_site
+    handler = functools.partial(StandInHandler, directory=args.root)
+    server = ThreadingHTTPServer(("127.0.0.1", args.port), handler)
+    print(f"Serving {args.root} on http://127.0.0.1:{args.port}/", flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,173 @@
+#ifndef LINK_PREFETCHER_H
+#define LINK_PREFETCHER_H
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "page_pipeline.h"
+#include "tab_history.h"
+
+// ============================================================================
+// LINK PREFETCHER (fetch + parse likely next pages into the document cache)
+// ============================================================================
+
+struct PrefetchOptions {
+    int maxLinks = 4;                        // top same-origin links per page, in document order
+    int maxConcurrent = 2;                   // prefetch downloads in flight
+    long long byteBudget = 2 * 1024 * 1024;  // per page visit, across all of its prefetches
+};
+
+// Prefetch threads should never compete with the page the user is waiting for
+inline void lowerCurrentThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10); // per-thread nice on linux
+#endif
+}
+
+inline bool relHasToken(const std::string& rel, const std::string& token) {
+    std::string lower = asciiLowerCopy(rel);
+    size_t pos = 0;
+    while ((pos = lower.find(token, pos)) != std::string::npos) {
+        bool startOk = pos == 0 || lower[pos - 1] == ' ' || lower[pos - 1] == '\t';
+        size_t end = pos + token.size();
+        bool endOk = end == lower.size() || lower[end] == ' ' || lower[end] == '\t';
+        if (startOk && endOk) return true;
+        pos = end;
+    }
+    return false;
+}
+
+class LinkPrefetcher {
+private:
+    PageFetcher fetcher;
+    DocumentCache& documents;
+    PrefetchOptions options;
+    std::mutex lock;
+    CancelToken round; // the current page's prefetches; replaced on every prefetch()
+
+    std::atomic<long> started;
+    std::atomic<long> completed;
+    std::atomic<long> overBudget;
+    std::atomic<long> failed;
+    std::atomic<long long> bytesFetched;
+
+    WorkerPool pool; // declared last so workers stop before the members above go away
+
+    void runPrefetch(const std::string& url, CancelToken cancel, std::shared_ptr<std::atomic<long long>> budgetUsed) {
+        thread_local bool lowered = false;
+        if (!lowered) {
+            lowerCurrentThreadPriority();
+            lowered = true;
+        }
+        if (cancel.isCancelled() || documents.contains(url)) return;
+        started++;
+
+        std::string body;
+        std::string contentType;
+        BodyDecoder decoder(&contentType);
+        bool budgetHit = false;
+        long long limit = options.byteBudget;
+        HttpBodySink onData = [&](const char* data, size_t len) {
+            if (cancel.isCancelled()) return false;
+            if (budgetUsed->fetch_add(static_cast<long long>(len)) + static_cast<long long>(len) > limit) {
+                budgetHit = true;
+                return false;
+            }
+            decoder.decode(data, len, body);
+            return true;
+        };
+
+        std::string error;
+        std::string finalUrl;
+        bool ok = fetcher(url, onData, error, cancel, contentType, finalUrl);
+        bytesFetched += static_cast<long long>(body.size());
+        if (budgetHit) {
+            overBudget++;
+            return;
+        }
+        if (!ok || cancel.isCancelled()) {
+            if (!cancel.isCancelled()) failed++;
+            return;
+        }
+        decoder.finish(body);
+        documents.put(url, std::make_shared<RenderDocument>(parseHTML(body)));
+        completed++;
+    }
+
+public:
+    LinkPrefetcher(const PageFetcher& fetch, DocumentCache& cache, const PrefetchOptions& opts = PrefetchOptions())
+        : fetcher(fetch), documents(cache), options(opts), started(0), completed(0), overBudget(0), failed(0),
+          bytesFetched(0), pool(opts.maxConcurrent) {}
+
+    ~LinkPrefetcher() {
+        cancel();
+    }
+
+    // Same-origin http links worth fetching from pageUrl: resolved, without
+    // fragments, no rel=nofollow, not already cached, at most maxLinks
+    std::vector<std::string> selectLinks(const std::string& pageUrl, const std::vector<RenderLink>& links) {
+        std::vector<std::string> picked;
+        ParsedUrl page;
+        if (!parseUrl(pageUrl, page)) return picked;
+        std::set<std::string> seen;
+        seen.insert(normalizeCacheUrl(pageUrl));
+
+        for (size_t i = 0; i < links.size() && static_cast<int>(picked.size()) < options.maxLinks; i++) {
+            if (links[i].href.empty() || links[i].href[0] == '#' || relHasToken(links[i].rel, "nofollow")) continue;
+            std::string url = resolveUrl(pageUrl, links[i].href);
+            url = url.substr(0, url.find('#'));
+
+            ParsedUrl target;
+            // Only what the native client fetches cheaply; https would mean a python process per link
+            if (!parseUrl(url, target) || target.scheme != "http") continue;
+            if (target.scheme != page.scheme || target.host != page.host || target.port != page.port) continue;
+            if (!seen.insert(normalizeCacheUrl(url)).second || documents.contains(url)) continue;
+            picked.push_back(url);
+        }
+        return picked;
+    }
+
+    // Starts prefetching pageUrl's links, dropping whatever the previous page
+    // queued. Returns how many links were queued.
+    int prefetch(const std::string& pageUrl, const std::vector<RenderLink>& links) {
+        std::vector<std::string> urls = selectLinks(pageUrl, links);
+        CancelToken token;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            round.cancel();
+            round = token;
+        }
+        std::shared_ptr<std::atomic<long long>> budgetUsed = std::make_shared<std::atomic<long long>>(0);
+        for (size_t i = 0; i < urls.size(); i++) {
+            std::string url = urls[i];
+            pool.submit([this, url, token, budgetUsed] { runPrefetch(url, token, budgetUsed); });
+        }
+        return static_cast<int>(urls.size());
+    }
+
+    void cancel() {
+        std::lock_guard<std::mutex> guard(lock);
+        round.cancel();
+    }
+
+    long getStarted() const { return started.load(); }
+    long getCompleted() const { return completed.load(); }
+    long getOverBudget() const { return overBudget.load(); }
+    long getFailed() const { return failed.load(); }
+    long long getBytesFetched() const { return bytesFetched.load(); }
+};
+
+#endif // LINK_PREFETCHER_H
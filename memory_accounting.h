@@ -0,0 +1,193 @@
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+
+// ============================================================================
+// MEMORY ACCOUNTING (heap use by category)
+// ============================================================================
+// Code that allocates opens an AllocScope naming what the memory is for;
+// anything allocated on that thread while the scope is open is counted
+// under that category, and freeing it is credited back to the same one.
+// Counting needs the global operator new, so a program opts in by expanding
+// DEFINE_MEMORY_ACCOUNTING() in exactly one of its .cpp files and calling
+// enableMemoryAccounting() when it wants numbers. Until then scopes cost one
+// thread-local store and the counters stay zero.
+
+enum AllocCategory {
+    ALLOC_OTHER,
+    ALLOC_DOM_NODES,
+    ALLOC_ATTRIBUTES,
+    ALLOC_TEXT,
+    ALLOC_TOKENS,
+    ALLOC_GRAPH,
+    ALLOC_TAG_REGISTRY,
+    ALLOC_CATEGORY_COUNT
+};
+
+inline const char* allocCategoryName(int category) {
+    static const char* const names[ALLOC_CATEGORY_COUNT] = {"other", "dom nodes", "attributes", "text",
+                                                             "tokens", "graph", "tag registry"};
+    return category >= 0 && category < ALLOC_CATEGORY_COUNT ? names[category] : "?";
+}
+
+inline const char* allocCategoryKey(int category) {
+    static const char* const keys[ALLOC_CATEGORY_COUNT] = {"other", "dom_nodes", "attributes", "text",
+                                                            "tokens", "graph", "tag_registry"};
+    return category >= 0 && category < ALLOC_CATEGORY_COUNT ? keys[category] : "unknown";
+}
+
+struct AllocCounters {
+    std::atomic<long long> count;
+    std::atomic<long long> bytes;
+    std::atomic<long long> live;
+    std::atomic<long long> peak;
+};
+
+// Plain copy of one category's counters
+struct AllocStats {
+    long long count = 0;   // allocations made
+    long long bytes = 0;   // bytes requested, all time
+    long long live = 0;    // bytes allocated and not yet freed
+    long long peak = 0;    // highest live since start or the last resetAllocationPeaks()
+};
+
+// Function-local statics so the counters exist before any global constructor allocates
+inline AllocCounters* allocCounters() {
+    static AllocCounters counters[ALLOC_CATEGORY_COUNT] = {};
+    return counters;
+}
+
+inline int& currentAllocCategory() {
+    static thread_local int category = ALLOC_OTHER;
+    return category;
+}
+
+inline std::atomic<bool>& memoryAccountingFlag() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+inline bool memoryAccountingEnabled() {
+    return memoryAccountingFlag().load(std::memory_order_relaxed);
+}
+
+// Blocks allocated before this are never counted, not even when freed
+inline void enableMemoryAccounting() {
+    memoryAccountingFlag().store(true);
+}
+
+class AllocScope {
+private:
+    int previous;
+
+public:
+    explicit AllocScope(AllocCategory category) : previous(currentAllocCategory()) {
+        currentAllocCategory() = category;
+    }
+
+    ~AllocScope() {
+        currentAllocCategory() = previous;
+    }
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+inline void recordAllocation(int category, long long size) {
+    AllocCounters& c = allocCounters()[category];
+    c.count.fetch_add(1, std::memory_order_relaxed);
+    c.bytes.fetch_add(size, std::memory_order_relaxed);
+    long long live = c.live.fetch_add(size, std::memory_order_relaxed) + size;
+    long long peak = c.peak.load(std::memory_order_relaxed);
+    while (live > peak && !c.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+inline void recordFree(int category, long long size) {
+    allocCounters()[category].live.fetch_sub(size, std::memory_order_relaxed);
+}
+
+inline AllocStats getAllocStats(AllocCategory category) {
+    AllocCounters& c = allocCounters()[category];
+    AllocStats s;
+    s.count = c.count.load();
+    s.bytes = c.bytes.load();
+    s.live = c.live.load();
+    s.peak = c.peak.load();
+    return s;
+}
+
+inline AllocStats getAllocTotals() {
+    AllocStats total;
+    for (int i = 0; i < ALLOC_CATEGORY_COUNT; i++) {
+        AllocStats s = getAllocStats(static_cast<AllocCategory>(i));
+        total.count += s.count;
+        total.bytes += s.bytes;
+        total.live += s.live;
+        total.peak += s.peak;
+    }
+    return total;
+}
+
+// Starts a new peak window, e.g. before each document
+inline void resetAllocationPeaks() {
+    for (int i = 0; i < ALLOC_CATEGORY_COUNT; i++) {
+        allocCounters()[i].peak.store(allocCounters()[i].live.load());
+    }
+}
+
+inline void printAllocStats(std::ostream& out) {
+    out << "Memory by category (allocations, bytes, live, peak):" << std::endl;
+    for (int i = 0; i < ALLOC_CATEGORY_COUNT; i++) {
+        AllocStats s = getAllocStats(static_cast<AllocCategory>(i));
+        out << "  " << allocCategoryName(i) << ": " << s.count << ", " << s.bytes << ", " << s.live << ", " << s.peak
+            << std::endl;
+    }
+}
+
+inline void printAllocStatsJson(std::ostream& out) {
+    out << "{";
+    for (int i = 0; i < ALLOC_CATEGORY_COUNT; i++) {
+        AllocStats s = getAllocStats(static_cast<AllocCategory>(i));
+        out << (i ? ", " : "") << "\"" << allocCategoryKey(i) << "\": {\"allocations\": " << s.count
+            << ", \"bytes\": " << s.bytes << ", \"live\": " << s.live << ", \"peak\": " << s.peak << "}";
+    }
+    out << "}";
+}
+
+// Each block carries its size and category in a 16-byte header, which keeps
+// the malloc alignment and lets delete credit the right category; -1 marks
+// a block allocated while counting was off
+static const size_t kAllocHeaderSize = 16;
+
+inline void* accountedAlloc(size_t size) {
+    void* raw = malloc(size + kAllocHeaderSize);
+    if (!raw) throw std::bad_alloc();
+    int category = memoryAccountingEnabled() ? currentAllocCategory() : -1;
+    static_cast<long long*>(raw)[0] = static_cast<long long>(size);
+    static_cast<int*>(raw)[2] = category;
+    if (category >= 0) recordAllocation(category, static_cast<long long>(size));
+    return static_cast<char*>(raw) + kAllocHeaderSize;
+}
+
+inline void accountedFree(void* p) {
+    if (!p) return;
+    void* raw = static_cast<char*>(p) - kAllocHeaderSize;
+    int category = static_cast<int*>(raw)[2];
+    if (category >= 0) recordFree(category, static_cast<long long*>(raw)[0]);
+    free(raw);
+}
+
+#define DEFINE_MEMORY_ACCOUNTING()                                                                  \
+    void* operator new(size_t size) { return accountedAlloc(size); }                                \
+    void* operator new[](size_t size) { return accountedAlloc(size); }                              \
+    void operator delete(void* p) noexcept { accountedFree(p); }                                    \
+    void operator delete[](void* p) noexcept { accountedFree(p); }                                  \
+    void operator delete(void* p, size_t) noexcept { accountedFree(p); }                            \
+    void operator delete[](void* p, size_t) noexcept { accountedFree(p); }
+
+#endif // MEMORY_ACCOUNTING_H
@@ -0,0 +1,392 @@
+#ifndef PAGE_PIPELINE_H
+#define PAGE_PIPELINE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "html_parser.h"
+#include "cancel_token.h"
+#include "charset.h"
+#include "http_fetcher.h"
+#include "http_cache.h"
+#include "process_runner.h"
+#include "url_canon.h"
+
+// ============================================================================
+// WORKER POOL (fixed threads pulling jobs from a Queue)
+// ============================================================================
+
+class WorkerPool {
+private:
+    std::vector<std::thread> workers;
+    Queue<std::function<void()>> jobs;
+    std::mutex lock;
+    std::condition_variable ready;
+    bool stopping;
+
+    void workerLoop() {
+        setTraceThreadName("worker");
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                ready.wait(guard, [this] { return stopping || !jobs.isEmpty(); });
+                if (jobs.isEmpty()) return; // stopping and drained
+                job = jobs.dequeue();
+            }
+            job();
+        }
+    }
+
+public:
+    explicit WorkerPool(int threadCount) : stopping(false) {
+        if (threadCount < 1) threadCount = 1;
+        for (int i = 0; i < threadCount; i++) {
+            workers.push_back(std::thread(&WorkerPool::workerLoop, this));
+        }
+    }
+
+    // Runs whatever is still queued, then joins the threads
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].join();
+        }
+    }
+
+    void submit(const std::function<void()>& job) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            jobs.enqueue(job);
+        }
+        ready.notify_one();
+    }
+
+    int getThreadCount() const {
+        return static_cast<int>(workers.size());
+    }
+};
+
+// ============================================================================
+// LAYOUT (render blocks -> styled lines the GUI draws)
+// ============================================================================
+
+struct RenderLine {
+    std::string text;
+    int size = 16;
+    bool bold = false;
+    int spaceBefore = 6;
+    int spaceAfter = 6;
+};
+
+inline RenderLine layoutRenderBlock(const RenderBlock& block) {
+    RenderLine out{};
+    out.text = block.text;
+
+    if (block.kind == RENDER_H1) {
+        out.size = 28;
+        out.bold = true;
+        out.spaceBefore = 10;
+        out.spaceAfter = 12;
+    } else if (block.kind == RENDER_H2) {
+        out.size = 22;
+        out.bold = true;
+        out.spaceBefore = 8;
+        out.spaceAfter = 10;
+    } else if (block.kind == RENDER_H3) {
+        out.size = 18;
+        out.bold = true;
+        out.spaceBefore = 6;
+        out.spaceAfter = 8;
+    } else {
+        out.size = 16;
+        out.bold = false;
+        out.spaceBefore = 4;
+        out.spaceAfter = 8;
+    }
+    return out;
+}
+
+inline std::vector<RenderLine> layoutRenderDocument(const RenderDocument& doc) {
+    TRACE_SCOPE("layout", "layout render document");
+    std::vector<RenderLine> lines;
+    lines.reserve(doc.blocks.size());
+    for (size_t i = 0; i < doc.blocks.size(); i++) {
+        lines.push_back(layoutRenderBlock(doc.blocks[i]));
+    }
+    return lines;
+}
+
+// ============================================================================
+// FETCH AND DECODE STAGES
+// ============================================================================
+
+// Streams the page at url into onData as it downloads; returns false and sets
+// error on failure. Long-running fetchers should poll cancel and give up early.
+// contentType gets the Content-Type of the page, when known, before the first
+// onData call, so a BodyDecoder can pick the charset from it. finalUrl gets
+// the URL the page really came from once redirects are followed (url itself
+// when there were none); relative links resolve against it.
+typedef std::function<bool(const std::string& url, const HttpBodySink& onData, std::string& error,
+                           const CancelToken& cancel, std::string& contentType, std::string& finalUrl)>
+    PageFetcher;
+
+// Portable fallback: run html_fetching_URL.py into a temp file and read it back
+inline PageFetcher makeScriptFetcher(const std::string& pythonCmd, const std::string& scriptPath) {
+    return [pythonCmd, scriptPath](const std::string& url, const HttpBodySink& onData, std::string& error,
+                                   const CancelToken& cancel, std::string& contentType, std::string& finalUrl) {
+        static std::atomic<int> fetchSerial(0);
+        if (cancel.isCancelled()) return false;
+        TRACE_SCOPE("fetch", "python fetch");
+
+        if (hasControlChars(url)) {
+            error = "Bad url: contains control characters";
+            return false;
+        }
+
+        std::filesystem::path tempFile = std::filesystem::temp_directory_path() /
+            ("browser_fetch_" + std::to_string(++fetchSerial) + ".html");
+        // Straight to python, no shell in between, so nothing in url is interpreted
+        std::string body;
+        bool ok = runProcess({pythonCmd, scriptPath, url, tempFile.string()}, &cancel, true) &&
+                  readWholeFile(tempFile.string(), body);
+        std::remove(tempFile.string().c_str());
+        if (!ok) {
+            error = "Fetch failed. Check URL or python.";
+            return false;
+        }
+        contentType = "text/html; charset=utf-8"; // the script saves response.text as UTF-8
+        finalUrl = url; // the script does not say where redirects took it
+        return onData(body.data(), body.size());
+    };
+}
+
+// Native HTTP/1.1 fetch straight off the socket; anything that isn't http://
+// (https in practice), or redirects there, goes to the fallback, normally the
+// python script fetcher.
+// With a cache, fresh pages are served from disk and stale ones revalidated.
+inline PageFetcher makeHttpFetcher(std::shared_ptr<HttpClient> client, const PageFetcher& fallback,
+                                   std::shared_ptr<HttpCache> cache = nullptr) {
+    return [client, fallback, cache](const std::string& url, const HttpBodySink& onData, std::string& error,
+                                     const CancelToken& cancel, std::string& contentType, std::string& finalUrl) {
+        if (asciiLowerCopy(url.substr(0, 7)) != "http://") {
+            return fallback ? fallback(url, onData, error, cancel, contentType, finalUrl) : false;
+        }
+        TRACE_SCOPE("fetch", "http get");
+        HttpResponse response;
+        // Headers (live or cached) are in place before the first body byte
+        bool typed = false;
+        HttpBodySink typedData = [&](const char* data, size_t len) {
+            if (!typed) {
+                const std::string* type = response.header("content-type");
+                if (type) contentType = *type;
+                typed = true;
+            }
+            return onData(data, len);
+        };
+        bool ok = cache ? cachedGet(*client, *cache, url, response, error, &cancel, &typedData)
+                        : client->get(url, response, error, &cancel, nullptr, &typedData);
+        if (!ok) return false;
+        // http:// pages that moved to https:// (most sites) are fetched by the
+        // fallback. The target is whatever the server put in Location, so only
+        // a clean https url, re-serialized, is passed on.
+        if (response.isRedirect() && asciiLowerCopy(response.finalUrl.substr(0, 7)) != "http://") {
+            std::string target;
+            if (!cleanHttpsUrl(response.finalUrl, target)) {
+                error = "Refused redirect: not a plain https:// url";
+                return false;
+            }
+            return fallback ? fallback(target, onData, error, cancel, contentType, finalUrl) : false;
+        }
+        finalUrl = response.finalUrl;
+        if (response.status != 200) {
+            error = "Failed to fetch page. Status code: " + std::to_string(response.status);
+            return false;
+        }
+        return true;
+    };
+}
+
+// ============================================================================
+// PAGE PIPELINE (fetch -> decode -> parse -> layout on a worker pool)
+// ============================================================================
+
+enum PageStatus {
+    PAGE_OK,
+    PAGE_FAILED,
+    PAGE_CANCELLED,
+    PAGE_PARTIAL    // still loading: lines holds newly finished lines from firstLine on
+};
+
+struct PageResult {
+    int tabId = -1;
+    int navigationId = 0;
+    std::string url;
+    std::string finalUrl; // where redirects ended up: what the page's links are relative to
+    PageStatus status = PAGE_FAILED;
+    std::string error;
+    RenderDocument doc;
+    std::vector<RenderLine> lines;
+    size_t firstLine = 0;
+};
+
+// Receives ownership of the result on a worker thread; the GUI posts it to the
+// window, headless callers push it onto their own queue. With partial results
+// enabled a navigation delivers any number of PAGE_PARTIAL results before its
+// one final OK/FAILED/CANCELLED result.
+typedef std::function<void(PageResult* result)> PageCallback;
+
+class PagePipeline {
+private:
+    PageFetcher fetcher;
+    PageCallback onComplete;
+    std::mutex lock;
+    std::map<int, CancelToken> activeTabs;
+    std::atomic<int> navigationCounter;
+    bool publishPartial;
+    WorkerPool pool; // declared last so workers stop before the members above go away
+
+    void finish(PageResult* result, PageStatus status) {
+        result->status = status;
+        onComplete(result);
+    }
+
+    // Sends lines finished since the last update: the first ones right away,
+    // later ones batched so a fast download doesn't flood the UI
+    void publishProgress(PageResult* result, size_t& published,
+                         std::chrono::steady_clock::time_point& lastPublish) {
+        const std::vector<RenderBlock>& blocks = result->doc.blocks;
+        if (blocks.size() == published) return;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (published > 0 && now - lastPublish < std::chrono::milliseconds(50)) return;
+        TRACE_SCOPE("pipeline", "publish partial");
+
+        PageResult* partial = new PageResult();
+        partial->tabId = result->tabId;
+        partial->navigationId = result->navigationId;
+        partial->url = result->url;
+        partial->finalUrl = result->finalUrl;
+        partial->status = PAGE_PARTIAL;
+        partial->firstLine = published;
+        for (size_t i = published; i < blocks.size(); i++) {
+            partial->lines.push_back(layoutRenderBlock(blocks[i]));
+        }
+        published = blocks.size();
+        lastPublish = now;
+        onComplete(partial);
+    }
+
+    void runJob(PageResult* result, CancelToken cancel) {
+        if (cancel.isCancelled()) return finish(result, PAGE_CANCELLED);
+        TRACE_SCOPE("pipeline", "page job");
+
+        // fetch -> decode -> parse run together as body chunks arrive
+        HTMLParser parser;
+        std::string contentType;
+        std::string finalUrl;
+        BodyDecoder decoder(&contentType);
+        std::string scratch;
+        std::vector<RenderBlock>& blocks = result->doc.blocks;
+        size_t published = 0;
+        std::chrono::steady_clock::time_point lastPublish = std::chrono::steady_clock::now();
+
+        parser.beginIncremental([&blocks](const RenderBlock& block) { blocks.push_back(block); });
+        HttpBodySink onData = [&](const char* data, size_t len) {
+            if (cancel.isCancelled()) return false;
+            std::string_view decoded;
+            {
+                TRACE_SCOPE("pipeline", "decode");
+                decoded = decoder.decodeChunk(data, len, scratch);
+            }
+            parser.feed(decoded.data(), decoded.size());
+            if (publishPartial) publishProgress(result, published, lastPublish);
+            return true;
+        };
+
+        if (!fetcher(result->url, onData, result->error, cancel, contentType, finalUrl)) {
+            return finish(result, cancel.isCancelled() ? PAGE_CANCELLED : PAGE_FAILED);
+        }
+        if (!finalUrl.empty()) result->finalUrl = finalUrl;
+        if (cancel.isCancelled()) return finish(result, PAGE_CANCELLED);
+
+        std::string_view rest = decoder.finishChunk(scratch);
+        parser.feed(rest.data(), rest.size());
+        parser.finish();
+        result->doc.title = parser.getTitle();
+        result->doc.links = parser.getLinks();
+        if (cancel.isCancelled()) return finish(result, PAGE_CANCELLED);
+
+        result->lines = layoutRenderDocument(result->doc);
+        finish(result, cancel.isCancelled() ? PAGE_CANCELLED : PAGE_OK);
+    }
+
+public:
+    PagePipeline(int workerCount, const PageFetcher& fetch, const PageCallback& done)
+        : fetcher(fetch), onComplete(done), navigationCounter(0), publishPartial(false), pool(workerCount) {}
+
+    // Deliver PAGE_PARTIAL results so the first screenful shows mid-download
+    void setPublishPartial(bool enabled) {
+        publishPartial = enabled;
+    }
+
+    ~PagePipeline() {
+        cancelAll();
+    }
+
+    // Starts loading url for tabId, aborting whatever that tab was loading.
+    // Returns the navigation id that the matching PageResult will carry.
+    int navigate(int tabId, const std::string& url) {
+        CancelToken token;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            std::map<int, CancelToken>::iterator it = activeTabs.find(tabId);
+            if (it != activeTabs.end()) it->second.cancel();
+            activeTabs[tabId] = token;
+        }
+
+        PageResult* result = new PageResult();
+        result->tabId = tabId;
+        result->navigationId = ++navigationCounter;
+        result->url = url;
+        result->finalUrl = url;
+        int navigationId = result->navigationId;
+        pool.submit([this, result, token] { runJob(result, token); });
+        return navigationId;
+    }
+
+    // Tab closed: abort its in-flight load
+    void cancelTab(int tabId) {
+        std::lock_guard<std::mutex> guard(lock);
+        std::map<int, CancelToken>::iterator it = activeTabs.find(tabId);
+        if (it != activeTabs.end()) {
+            it->second.cancel();
+            activeTabs.erase(it);
+        }
+    }
+
+    void cancelAll() {
+        std::lock_guard<std::mutex> guard(lock);
+        for (std::map<int, CancelToken>::iterator it = activeTabs.begin(); it != activeTabs.end(); ++it) {
+            it->second.cancel();
+        }
+        activeTabs.clear();
+    }
+};
+
+#endif // PAGE_PIPELINE_H
@@ -0,0 +1,585 @@
+#ifdef _WIN32
+#define PSAPI_VERSION 2 // GetProcessMemoryInfo from kernel32, no psapi.lib needed
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <sstream>
+#include <thread>
+#include "html_parser.h"
+#include "batch_parser.h"
+
+// ============================================================================
+// ALLOCATION COUNTING (every operator new in the process goes through here)
+// ============================================================================
+
+// Kept out of line so the compiler does not pair an inlined malloc with a free
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+static std::atomic<long long> g_allocations(0);
+static std::atomic<long long> g_allocatedBytes(0);
+
+BENCH_NOINLINE void* operator new(size_t size) {
+    g_allocations++;
+    g_allocatedBytes += static_cast<long long>(size);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+BENCH_NOINLINE void operator delete(void* p) noexcept {
+    free(p);
+}
+
+BENCH_NOINLINE void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static long long peakRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// ============================================================================
+// FIXED CORPUS (the same pages on every run, so numbers can be compared)
+// ============================================================================
+
+struct BenchDocument {
+    std::string name;
+    std::string html;
+};
+
+static std::string benchWord(int i) {
+    static const char* words[] = {"parser", "browser", "token", "stack", "queue", "layout", "render",
+                                  "network", "cache", "history", "graph", "tree", "page", "link"};
+    return words[(i * 7 + i / 3) % 14];
+}
+
+static std::string benchSentence(int seed, int words) {
+    std::string s;
+    for (int i = 0; i < words; i++) {
+        if (i) s += ' ';
+        s += benchWord(seed + i);
+    }
+    return s;
+}
+
+static std::vector<BenchDocument> builtInCorpus() {
+    std::vector<BenchDocument> corpus;
+    std::string html;
+
+    // News article: headings and paragraphs with inline markup and links
+    html = "<html><head><title>Article</title><meta charset=\"utf-8\"></head><body><div class=\"article\">";
+    html += "<h1>" + benchSentence(1, 8) + "</h1>";
+    for (int i = 0; i < 120; i++) {
+        if (i % 15 == 0) html += "<h2>" + benchSentence(i, 5) + "</h2>";
+        html += "<p>" + benchSentence(i, 25) + " <b>" + benchWord(i) + "</b> <a href=\"/story/" +
+                std::to_string(i) + ".html\">" + benchSentence(i + 3, 3) + "</a> " + benchSentence(i + 9, 20) +
+                "</p>\n";
+    }
+    html += "</div></body></html>";
+    corpus.push_back({"article", html});
+
+    // Data table
+    html = "<html><head><title>Table</title></head><body><table><thead><tr>";
+    for (int c = 0; c < 6; c++) html += "<th>" + benchWord(c) + "</th>";
+    html += "</tr></thead><tbody>";
+    for (int r = 0; r < 400; r++) {
+        html += "<tr>";
+        for (int c = 0; c < 6; c++) html += "<td>" + std::to_string(r * 6 + c) + " " + benchWord(r + c) + "</td>";
+        html += "</tr>\n";
+    }
+    html += "</tbody></table></body></html>";
+    corpus.push_back({"table", html});
+
+    // Link-heavy index page
+    html = "<html><head><title>Index</title></head><body><h1>Index</h1><ul>";
+    for (int i = 0; i < 800; i++) {
+        html += "<li><a href=\"/section/" + std::to_string(i % 40) + "/item" + std::to_string(i) +
+                ".html\" rel=\"bookmark\" title=\"" + benchWord(i) + "\">" + benchSentence(i, 4) + "</a></li>\n";
+    }
+    html += "</ul></body></html>";
+    corpus.push_back({"links", html});
+
+    // Deeply nested layout divs
+    html = "<html><head><title>Nested</title></head><body>";
+    for (int i = 0; i < 300; i++) html += "<div class=\"wrap" + std::to_string(i) + "\">";
+    html += "<p>" + benchSentence(5, 30) + "</p>";
+    for (int i = 0; i < 300; i++) html += "</div>";
+    html += "</body></html>";
+    corpus.push_back({"nested", html});
+
+    // Form with attribute-heavy inputs
+    html = "<html><head><title>Form</title></head><body><form action=\"/submit\" method=\"post\">";
+    for (int i = 0; i < 300; i++) {
+        html += "<p>" + benchWord(i) + "</p><input type=\"text\" name=\"field" + std::to_string(i) +
+                "\" id=\"f" + std::to_string(i) + "\" class=\"input wide\" placeholder=\"" + benchSentence(i, 3) +
+                "\" data-index=\"" + std::to_string(i) + "\" required>\n";
+    }
+    html += "</form></body></html>";
+    corpus.push_back({"form", html});
+
+    // Long plain text
+    html = "<html><head><title>Text</title></head><body>";
+    for (int i = 0; i < 60; i++) html += "<p>" + benchSentence(i, 300) + "</p>\n";
+    html += "</body></html>";
+    corpus.push_back({"text", html});
+
+    return corpus;
+}
+
+// ============================================================================
+// MEASUREMENT
+// ============================================================================
+
+// Reaches the parser phases that parse() runs back to back
+struct ParserBenchAccess {
+    static Queue<Token*>* tokenize(HTMLParser& parser, const char* html) {
+        return parser.tokenize(html);
+    }
+    static void buildDOMTree(HTMLParser& parser, Queue<Token*>* tokens) {
+        parser.resetDocument();
+        parser.buildDOMTree(tokens);
+        delete tokens;
+    }
+    static void tokenizeParallel(HTMLParser& parser, const std::string& html, int threads) {
+        parser.resetDocument();
+        std::vector<Queue<Token*>*> pieces = parser.tokenizeParallel(html.c_str(), static_cast<int>(html.size()), threads);
+        for (size_t i = 0; i < pieces.size(); i++) HTMLParser::deleteTokens(pieces[i]);
+    }
+};
+
+struct ScalingPoint {
+    int threads;
+    double ns;
+    int chunks;
+    int retokenized;
+};
+
+struct BenchResult {
+    std::string name;
+    double ns = 0;            // best iteration
+    double ops = 0;           // bytes for phases, operations for structures
+    long long allocations = 0;
+    long long allocatedBytes = 0;
+    double perDocument = 0;   // divisor for allocations (documents, or ops)
+};
+
+typedef std::chrono::steady_clock BenchClock;
+
+// Runs body iterations times and keeps the fastest, with the allocations of one run
+static BenchResult measure(const std::string& name, int iterations, double ops, double perDocument,
+                           const std::function<void()>& body) {
+    BenchResult result;
+    result.name = name;
+    result.ops = ops;
+    result.perDocument = perDocument;
+    for (int i = 0; i < iterations; i++) {
+        long long allocsBefore = g_allocations.load();
+        long long bytesBefore = g_allocatedBytes.load();
+        BenchClock::time_point start = BenchClock::now();
+        body();
+        double ns = std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+        if (i == 0 || ns < result.ns) result.ns = ns;
+        result.allocations = g_allocations.load() - allocsBefore;
+        result.allocatedBytes = g_allocatedBytes.load() - bytesBefore;
+    }
+    return result;
+}
+
+static std::vector<BenchResult> benchPhases(const std::vector<BenchDocument>& corpus, int iterations,
+                                            const std::string& renderFile) {
+    std::vector<BenchResult> results;
+    double bytes = 0;
+    for (size_t i = 0; i < corpus.size(); i++) bytes += static_cast<double>(corpus[i].html.size());
+    double docs = static_cast<double>(corpus.size());
+    HTMLParser parser;
+
+    // tokenize and buildDOMTree are timed on their own, so the tokens for
+    // the tree phase are made (untimed) before each of its runs
+    std::vector<Queue<Token*>*> tokens(corpus.size(), nullptr);
+    results.push_back(measure("tokenize", iterations, bytes, docs, [&] {
+        for (size_t d = 0; d < corpus.size(); d++) {
+            Queue<Token*>* queue = ParserBenchAccess::tokenize(parser, corpus[d].html.c_str());
+            while (!queue->isEmpty()) delete queue->dequeue();
+            delete queue;
+        }
+    }));
+
+    BenchResult tree;
+    for (int i = 0; i < iterations; i++) {
+        for (size_t d = 0; d < corpus.size(); d++) {
+            tokens[d] = ParserBenchAccess::tokenize(parser, corpus[d].html.c_str());
+        }
+        BenchResult run = measure("buildDOMTree", 1, bytes, docs, [&] {
+            for (size_t d = 0; d < corpus.size(); d++) {
+                ParserBenchAccess::buildDOMTree(parser, tokens[d]);
+            }
+        });
+        if (i == 0 || run.ns < tree.ns) tree = run;
+    }
+    results.push_back(tree);
+
+    // The render phase needs a built tree per document, so each document is
+    // parsed (untimed) and then written
+    BenchResult render;
+    render.name = "writeRenderToFile";
+    render.ops = bytes;
+    render.perDocument = docs;
+    for (int i = 0; i < iterations; i++) {
+        double ns = 0;
+        long long allocs = 0;
+        long long allocBytes = 0;
+        for (size_t d = 0; d < corpus.size(); d++) {
+            parser.parse(corpus[d].html.c_str());
+            BenchResult run = measure("", 1, 0, 0, [&] { parser.writeRenderToFile(renderFile.c_str()); });
+            ns += run.ns;
+            allocs += run.allocations;
+            allocBytes += run.allocatedBytes;
+        }
+        if (i == 0 || ns < render.ns) render.ns = ns;
+        render.allocations = allocs;
+        render.allocatedBytes = allocBytes;
+    }
+    results.push_back(render);
+
+    results.push_back(measure("end-to-end", iterations, bytes, docs, [&] {
+        for (size_t d = 0; d < corpus.size(); d++) {
+            HTMLParser fresh;
+            fresh.parse(corpus[d].html.c_str());
+            fresh.writeRenderToFile(renderFile.c_str());
+        }
+    }));
+    std::remove(renderFile.c_str());
+    return results;
+}
+
+// One big page for the thread scaling runs: the corpus pages' bodies back to
+// back in a single <body>, so the whole page is one tree (pages without a
+// <body> go in whole)
+static std::string bigBenchPage(const std::vector<BenchDocument>& corpus, size_t bytes) {
+    std::string page = "<html><head><title>Scaling</title></head><body>";
+    while (page.size() < bytes) {
+        for (size_t d = 0; d < corpus.size(); d++) {
+            const std::string& html = corpus[d].html;
+            size_t open = html.find("<body>");
+            size_t close = html.rfind("</body>");
+            if (open == std::string::npos || close == std::string::npos || close < open) page += html;
+            else page.append(html, open + 6, close - open - 6);
+        }
+    }
+    page += "</body></html>";
+    return page;
+}
+
+// 1, 2, 4 ... threads up to maxThreads
+static std::vector<int> threadCounts(int maxThreads) {
+    std::vector<int> counts;
+    for (int t = 1; t < maxThreads; t *= 2) counts.push_back(t);
+    counts.push_back(maxThreads);
+    return counts;
+}
+
+// The big page tokenized at each thread count
+static std::vector<ScalingPoint> benchParallelTokenize(const std::string& page, int iterations, int maxThreads) {
+    std::vector<int> counts = threadCounts(maxThreads);
+    std::vector<ScalingPoint> points;
+    HTMLParser parser;
+    for (size_t c = 0; c < counts.size(); c++) {
+        int threads = counts[c];
+        BenchResult run = measure("", iterations, 0, 0, [&] {
+            if (threads == 1) {
+                Queue<Token*>* queue = ParserBenchAccess::tokenize(parser, page.c_str());
+                while (!queue->isEmpty()) delete queue->dequeue();
+                delete queue;
+            } else {
+                ParserBenchAccess::tokenizeParallel(parser, page, threads);
+            }
+        });
+        ParseStats stats;
+        if (threads > 1) {
+            parser.setStats(&stats);
+            ParserBenchAccess::tokenizeParallel(parser, page, threads);
+            parser.setStats(nullptr);
+        }
+        points.push_back({threads, run.ns, threads > 1 ? stats.tokenizeChunks : 1, stats.chunksRetokenized});
+    }
+    return points;
+}
+
+// The big page parsed once, then its render blocks and links collected at
+// each thread count
+static std::vector<ScalingPoint> benchParallelRender(const std::string& page, int iterations, int maxThreads) {
+    std::vector<int> counts = threadCounts(maxThreads);
+    std::vector<ScalingPoint> points;
+    HTMLParser parser;
+    parser.parse(page.c_str());
+    size_t blocks = 0;
+    for (size_t c = 0; c < counts.size(); c++) {
+        int threads = counts[c];
+        BenchResult run = measure("", iterations, 0, 0, [&] { blocks += parser.buildRenderDocument(threads).blocks.size(); });
+        points.push_back({threads, run.ns, 0, 0});
+    }
+    if (blocks == 0) std::cout << "no blocks rendered" << std::endl;
+    return points;
+}
+
+static std::vector<BenchResult> benchStructures(int iterations) {
+    std::vector<BenchResult> results;
+    const int count = 20000;
+    std::vector<std::string> keys;
+    for (int i = 0; i < count; i++) keys.push_back(benchWord(i) + "-" + std::to_string(i));
+    std::vector<std::string> tags;
+    for (int i = 0; i < 400; i++) tags.push_back(benchWord(i) + std::to_string(i % 97));
+
+    // Attribute-sized tables: a handful of keys each, as the parser uses them
+    results.push_back(measure("HashTable.insert+get", iterations, count * 2.0, count * 2.0, [&] {
+        for (int t = 0; t < count / 8; t++) {
+            HashTable table;
+            for (int k = 0; k < 8; k++) table.insert(keys[t * 8 + k].c_str(), "value");
+            for (int k = 0; k < 8; k++) table.get(keys[t * 8 + k].c_str());
+        }
+    }));
+
+    AVLTree tree;
+    results.push_back(measure("AVLTree.insert", iterations, static_cast<double>(tags.size()),
+                              static_cast<double>(tags.size()), [&] {
+        tree.clear();
+        for (size_t i = 0; i < tags.size(); i++) tree.insert(tags[i].c_str());
+    }));
+    long found = 0;
+    results.push_back(measure("AVLTree.search", iterations, count, count, [&] {
+        for (int i = 0; i < count; i++) found += tree.search(tags[i % tags.size()].c_str()) ? 1 : 0;
+    }));
+
+    results.push_back(measure("Stack.push+pop", iterations, count * 2.0, count * 2.0, [&] {
+        Stack<int> stack;
+        for (int i = 0; i < count; i++) stack.push(i);
+        while (!stack.isEmpty()) stack.pop();
+    }));
+
+    results.push_back(measure("Queue.enqueue+dequeue", iterations, count * 2.0, count * 2.0, [&] {
+        Queue<int> queue;
+        for (int i = 0; i < count; i++) queue.enqueue(i);
+        while (!queue.isEmpty()) queue.dequeue();
+    }));
+    // Prose with a reference every few hundred bytes, per byte decoded
+    std::string prose;
+    for (int i = 0; i < 400; i++) prose += benchSentence(i, 40) + (i % 3 ? " &amp; " : " &#8217;s ");
+    std::vector<char> decoded(decodedEntitiesCapacity(prose.size()));
+    size_t decodedBytes = 0;
+    results.push_back(measure("decodeHtmlEntities", iterations, static_cast<double>(prose.size()),
+                              static_cast<double>(prose.size()), [&] {
+        decodedBytes += decodeHtmlEntities(prose.data(), prose.size(), decoded.data(), false);
+    }));
+
+    // Mostly ASCII with an accented word every sentence, per byte checked
+    std::string utf8;
+    for (int i = 0; i < 400; i++) utf8 += benchSentence(i, 40) + " caf\xC3\xA9 ";
+    size_t validBytes = 0;
+    results.push_back(measure("checkUtf8", iterations, static_cast<double>(utf8.size()),
+                              static_cast<double>(utf8.size()), [&] {
+        size_t valid;
+        checkUtf8(utf8.data(), utf8.size(), valid);
+        validBytes += valid;
+    }));
+    if (found < 0 || decodedBytes == 0 || validBytes == 0) std::cout << found; // keeps the work from being optimized away
+    return results;
+}
+
+// ============================================================================
+// REPORTING
+// ============================================================================
+
+static std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++) {
+        char c = s[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            out += buffer;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+static void writeJson(std::ostream& out, const std::vector<BenchDocument>& corpus, int iterations,
+                      const std::vector<BenchResult>& phases, const std::vector<BenchResult>& structures,
+                      const std::vector<ScalingPoint>& scaling, const std::vector<ScalingPoint>& renderScaling,
+                      size_t pageBytes, long long peakKb) {
+    long long bytes = 0;
+    for (size_t i = 0; i < corpus.size(); i++) bytes += static_cast<long long>(corpus[i].html.size());
+    out << "{\n  \"corpus\": {\"documents\": " << corpus.size() << ", \"bytes\": " << bytes << "},\n";
+    out << "  \"iterations\": " << iterations << ",\n  \"phases\": [\n";
+    for (size_t i = 0; i < phases.size(); i++) {
+        const BenchResult& r = phases[i];
+        out << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"ms\": " << r.ns / 1e6
+            << ", \"ns_per_byte\": " << r.ns / r.ops << ", \"mb_per_s\": " << r.ops / (r.ns / 1e9) / (1024.0 * 1024.0)
+            << ", \"allocations_per_doc\": " << r.allocations / r.perDocument
+            << ", \"allocated_bytes_per_doc\": " << r.allocatedBytes / r.perDocument << "}"
+            << (i + 1 < phases.size() ? "," : "") << "\n";
+    }
+    out << "  ],\n  \"structures\": [\n";
+    for (size_t i = 0; i < structures.size(); i++) {
+        const BenchResult& r = structures[i];
+        out << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"ns_per_op\": " << r.ns / r.ops
+            << ", \"allocations_per_op\": " << r.allocations / r.perDocument << "}"
+            << (i + 1 < structures.size() ? "," : "") << "\n";
+    }
+    out << "  ],\n  \"parallel_tokenize\": {\"page_bytes\": " << pageBytes << ", \"runs\": [\n";
+    for (size_t i = 0; i < scaling.size(); i++) {
+        const ScalingPoint& p = scaling[i];
+        out << "    {\"threads\": " << p.threads << ", \"ms\": " << p.ns / 1e6
+            << ", \"mb_per_s\": " << pageBytes / (p.ns / 1e9) / (1024.0 * 1024.0)
+            << ", \"speedup\": " << scaling[0].ns / p.ns << ", \"chunks\": " << p.chunks
+            << ", \"chunks_retokenized\": " << p.retokenized << "}" << (i + 1 < scaling.size() ? "," : "") << "\n";
+    }
+    out << "  ]},\n  \"parallel_render\": {\"page_bytes\": " << pageBytes << ", \"runs\": [\n";
+    for (size_t i = 0; i < renderScaling.size(); i++) {
+        const ScalingPoint& p = renderScaling[i];
+        out << "    {\"threads\": " << p.threads << ", \"ms\": " << p.ns / 1e6 << ", \"speedup\": "
+            << renderScaling[0].ns / p.ns << "}" << (i + 1 < renderScaling.size() ? "," : "") << "\n";
+    }
+    out << "  ]},\n  \"peak_rss_kb\": " << peakKb << "\n}\n";
+}
+
+static void writeTable(std::ostream& out, const std::vector<BenchDocument>& corpus,
+                       const std::vector<BenchResult>& phases, const std::vector<BenchResult>& structures,
+                       const std::vector<ScalingPoint>& scaling, const std::vector<ScalingPoint>& renderScaling,
+                      size_t pageBytes, long long peakKb) {
+    long long bytes = 0;
+    for (size_t i = 0; i < corpus.size(); i++) bytes += static_cast<long long>(corpus[i].html.size());
+    out << "Corpus: " << corpus.size() << " documents, " << bytes << " bytes" << std::endl;
+    for (size_t i = 0; i < phases.size(); i++) {
+        const BenchResult& r = phases[i];
+        out << "  " << r.name << ": " << r.ns / 1e6 << " ms, " << r.ns / r.ops << " ns/byte, "
+            << r.allocations / r.perDocument << " allocations/doc" << std::endl;
+    }
+    for (size_t i = 0; i < structures.size(); i++) {
+        const BenchResult& r = structures[i];
+        out << "  " << r.name << ": " << r.ns / r.ops << " ns/op, " << r.allocations / r.perDocument
+            << " allocations/op" << std::endl;
+    }
+    out << "Parallel tokenize, one " << pageBytes / (1024 * 1024) << " MB page:" << std::endl;
+    for (size_t i = 0; i < scaling.size(); i++) {
+        const ScalingPoint& p = scaling[i];
+        out << "  " << p.threads << (p.threads == 1 ? " thread: " : " threads: ") << p.ns / 1e6 << " ms, "
+            << pageBytes / (p.ns / 1e9) / (1024.0 * 1024.0) << " MB/s, speedup " << scaling[0].ns / p.ns << "x, "
+            << p.retokenized << "/" << p.chunks << " chunks re-tokenized" << std::endl;
+    }
+    out << "Parallel render (blocks and links), same page:" << std::endl;
+    for (size_t i = 0; i < renderScaling.size(); i++) {
+        const ScalingPoint& p = renderScaling[i];
+        out << "  " << p.threads << (p.threads == 1 ? " thread: " : " threads: ") << p.ns / 1e6 << " ms, speedup "
+            << renderScaling[0].ns / p.ns << "x" << std::endl;
+    }
+    out << "Peak RSS: " << peakKb << " KB" << std::endl;
+}
+
+// ============================================================================
+// MAIN FUNCTION
+// ============================================================================
+
+// parser_bench [--corpus DIR|MANIFEST] [--iterations N] [--json FILE|-] [--max-threads N]
+int main(int argc, char* argv[]) {
+    std::string corpusSource;
+    std::string jsonFile;
+    int iterations = 5;
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+            corpusSource = argv[++i];
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonFile = argv[++i];
+        } else if (strcmp(argv[i], "--max-threads") == 0 && i + 1 < argc) {
+            maxThreads = atoi(argv[++i]);
+        } else {
+            std::cerr << "Usage: parser_bench [--corpus DIR|MANIFEST] [--iterations N] [--json FILE|-] [--max-threads N]"
+                      << std::endl;
+            return 1;
+        }
+    }
+    if (iterations < 1) iterations = 1;
+    if (maxThreads < 1) maxThreads = 1;
+
+    std::vector<BenchDocument> corpus;
+    if (corpusSource.empty()) {
+        corpus = builtInCorpus();
+    } else {
+        std::vector<BatchItem> items;
+        std::string error;
+        std::error_code ec;
+        bool listed = std::filesystem::is_directory(corpusSource, ec) ? listHtmlFiles(corpusSource, "", items, error)
+                                                                      : loadManifest(corpusSource, "", items, error);
+        if (!listed) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < items.size(); i++) {
+            BenchDocument doc;
+            doc.name = items[i].input;
+            if (!readWholeFile(items[i].input, doc.html)) {
+                std::cerr << "Error: Cannot open file " << items[i].input << std::endl;
+                return 1;
+            }
+            corpus.push_back(doc);
+        }
+    }
+    if (corpus.empty()) {
+        std::cerr << "Error: empty corpus" << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchResult> phases = benchPhases(corpus, iterations, "parser_bench_render.txt");
+    std::vector<BenchResult> structures = benchStructures(iterations);
+    long long peakKb = peakRssKb(); // before the big page, so it still describes the corpus
+    std::string page = bigBenchPage(corpus, 4 * 1024 * 1024);
+    std::vector<ScalingPoint> scaling = benchParallelTokenize(page, iterations, maxThreads);
+    std::vector<ScalingPoint> renderScaling = benchParallelRender(page, iterations, maxThreads);
+
+    if (jsonFile == "-") {
+        writeJson(std::cout, corpus, iterations, phases, structures, scaling, renderScaling, page.size(), peakKb);
+        return 0;
+    }
+    writeTable(std::cout, corpus, phases, structures, scaling, renderScaling, page.size(), peakKb);
+    if (!jsonFile.empty()) {
+        std::ofstream out(jsonFile);
+        if (!out.is_open()) {
+            std::cerr << "Error: Cannot open file " << jsonFile << " for writing" << std::endl;
+            return 1;
+        }
+        writeJson(out, corpus, iterations, phases, structures, scaling, renderScaling, page.size(), peakKb);
+    }
+    return 0;
+}
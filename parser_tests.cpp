@@ -0,0 +1,570 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include "html_corpus_gen.h"
+#include "html_parser.h"
+#include "page_pipeline.h"
+#include "batch_parser.h" // with page_pipeline.h: the shared helpers must not clash
+#include "crawler.h"
+#include "dom_diff.h"
+#include "dom_snapshot.h"
+#include "link_prefetcher.h"
+#include "tab_render_store.h"
+
+DEFINE_MEMORY_ACCOUNTING()
+
+// ============================================================================
+// CHECKS (g++ -std=c++17 -pthread parser_tests.cpp -o parser_tests, exit code 0 = all passed)
+// ============================================================================
+//
+// parser_tests [--server http://127.0.0.1:8000]: with --server the fetcher
+// checks run against local_http_server.py --demo-site, otherwise they are
+// skipped
+
+static int failures = 0;
+
+static void check(bool ok, const std::string& what) {
+    if (ok) return;
+    std::cerr << "FAILED: " << what << std::endl;
+    failures++;
+}
+
+static void checkEqual(const std::string& got, const std::string& want, const std::string& what) {
+    check(got == want, what + "\n  got:  " + got + "\n  want: " + want);
+}
+
+// page.txt lines of html, parsed whole and streamed through feed
+static std::string renderLines(const char* html) {
+    std::ostringstream out;
+    writeRenderDocument(out, parseHTML(html));
+    return out.str();
+}
+
+// Fed chunk bytes at a time, the way pages arrive off the network
+static std::string streamLines(const char* html, size_t chunk = std::string::npos) {
+    std::ostringstream out;
+    HTMLParser parser;
+    parser.beginIncremental([&out](const RenderBlock& block) {
+        writeRenderBlock(out, block);
+    }, true);
+    size_t len = strlen(html);
+    for (size_t at = 0; at < len; at += chunk) parser.feed(html + at, std::min(chunk, len - at));
+    parser.finish();
+    return (parser.getTitle().empty() ? "" : "TITLE: " + parser.getTitle() + "\n") + out.str();
+}
+
+// ============================================================================
+// TREE BUILDING
+// ============================================================================
+
+static void testLeadingVoidElement() {
+    const char* html = "<meta charset=utf-8><title>T</title><p>hello</p>";
+    checkEqual(renderLines(html), "TITLE: T\nP: hello\n", "a page that opens with <meta> keeps what follows it");
+    checkEqual(streamLines(html), "TITLE: T\nP: hello\n", "... also when streamed");
+    checkEqual(renderLines("<br/><p>a</p><p>b</p>"), "P: a\nP: b\n", "a page that opens with <br/>");
+    checkEqual(renderLines("<meta charset=utf-8><html><body><p>x</p></body></html>"), "P: x\n",
+               "<meta> before <html>");
+}
+
+// feed keeps its place inside a token that is cut off, so pages must come
+// out the same however the input is split
+static void testFeedInPieces() {
+    const char* html = "<html><head><title>Split</title><style>p { }</style></head><body>"
+                       "<!-- a -- b > c --><p>one <b>two</b> three</p>"
+                       "<script>if (a </scr + 'ipt') x = \"</p>\";</script>"
+                       "<p>long text long text long text <a href=\"/x\">link</a></p>"
+                       "<p><pre>  kept\n  as is</pre></p></body></html>";
+    std::string whole = renderLines(html);
+    size_t len = strlen(html);
+    for (size_t piece = 1; piece <= 17; piece += 4) {
+        std::ostringstream out;
+        HTMLParser parser;
+        parser.beginIncremental([&out](const RenderBlock& block) { writeRenderBlock(out, block); });
+        for (size_t at = 0; at < len; at += piece) parser.feed(html + at, std::min(piece, len - at));
+        parser.finish();
+        checkEqual("TITLE: " + parser.getTitle() + "\n" + out.str(), whole,
+                   "fed " + std::to_string(piece) + " byte(s) at a time");
+    }
+}
+
+// Whitespace written as a character reference collapses like typed whitespace;
+// &nbsp; is not whitespace and stays
+static void testWhitespaceReferencesCollapse() {
+    checkEqual(renderLines("<p>a &#32; b</p>"), "P: a b\n", "&#32; between spaces");
+    checkEqual(renderLines("<p>one&#10;&#9;two&#x20;</p>"), "P: one two\n", "&#10; and &#9; inside, &#x20; at the end");
+    checkEqual(renderLines("<p>&#32;lead</p>"), "P: lead\n", "&#32; at the start");
+    checkEqual(renderLines("<p>a&nbsp;&nbsp;b</p>"), "P: a\xC2\xA0\xC2\xA0" "b\n", "&nbsp; is kept");
+    checkEqual(renderLines("<p><pre>a&#32;&#32;b\n c</pre></p>"), "P: a  b\nP:  c\n",
+               "<pre> text keeps every space, each of its lines prefixed");
+    checkEqual(renderLines("<body><p><pre>a\r\nb\rc\n</pre></p><h1>d</h1></body>"), "P: a\nP: b\nP: c\nH1: d\n",
+               "\\r\\n and \\r break <pre> lines too, a break at the end adds none");
+    checkEqual(streamLines("<p><pre>a\nb</pre></p>"), "P: a\nP: b\n", "... also when streamed");
+}
+
+// Pages nest far deeper than the call stack allows recursion for
+// (html_corpus_gen --shape deep reaches about 200k levels)
+static void testDeepNesting() {
+    const int depth = 250000;
+    std::string html = "<html><head><title>Deep</title></head><body>";
+    for (int i = 0; i < depth; i++) html += "<div>";
+    html += "<p><a href=\"/bottom\">bottom</a></p>";
+    for (int i = 0; i < depth; i++) html += "</div>";
+    RenderDocument doc = parseHTML(html);
+    checkEqual(doc.title, "Deep", "the title of a deeply nested page");
+    check(doc.blocks.size() == 1 && doc.blocks[0].text == "bottom", "the paragraph at the bottom is found");
+    check(doc.links.size() == 1 && doc.links[0].href == "/bottom", "... and so is its link");
+
+    // --watch renders through ReloadRenderer, which hashes and walks the tree itself
+    HTMLParser parser;
+    parser.parse(html.c_str());
+    ReloadRenderer renderer;
+    ReloadStats stats;
+    renderer.renderTree(parser.getRoot());
+    const RenderDocument& again = renderer.renderTree(parser.getRoot(), &stats);
+    check(again.blocks.size() == 1 && again.links.size() == 1 && stats.reusedSubtrees == 1,
+          "a deeply nested page renders again from the reload index");
+
+    // Pages load through feed (PagePipeline), and tags left open are only
+    // walked by finish, all the way down
+    std::string unclosed = "<html><head><title>Deep</title></head><body>";
+    for (int i = 0; i < depth; i++) unclosed += "<div>";
+    unclosed += "<p><a href=\"/bottom\">bottom</a></p>";
+    for (int release = 0; release < 2; release++) {
+        std::vector<RenderBlock> blocks;
+        HTMLParser streamed;
+        streamed.beginIncremental([&blocks](const RenderBlock& block) { blocks.push_back(block); }, release != 0);
+        for (size_t at = 0; at < unclosed.size(); at += 4096) {
+            streamed.feed(unclosed.data() + at, std::min<size_t>(4096, unclosed.size() - at));
+        }
+        streamed.finish();
+        std::string mode = release ? " (releasing subtrees)" : "";
+        check(blocks.size() == 1 && blocks[0].text == "bottom", "a page of unclosed tags streams its paragraph" + mode);
+        checkEqual(streamed.getTitle(), "Deep", "... and its title" + mode);
+        if (!release) check(streamed.getLinks().size() == 1, "... and its link");
+    }
+}
+
+// Inline elements nest like any others: a paragraph's text is gathered
+// through all of them, bold and italic wrapped at every level
+static void testDeepInlineNesting() {
+    const int depth = 150000;
+    std::string html = "<html><body><p>top";
+    for (int i = 0; i < depth; i++) html += "<span><b>";
+    html += "deep";
+    for (int i = 0; i < depth; i++) html += "</b></span>";
+    html += "</p></body></html>";
+    std::string want = "P: top " + std::string(depth * 2, '*') + "deep" + std::string(depth * 2, '*') + "\n";
+    checkEqual(renderLines(html.c_str()), want, "a paragraph of deeply nested bold spans");
+
+    HTMLParser parser;
+    parser.parseParallel(html.c_str(), 4);
+    std::ostringstream threaded;
+    writeRenderDocument(threaded, parser.buildRenderDocument(4));
+    checkEqual(threaded.str(), want, "... rendered on threads");
+    checkEqual(streamLines(html.c_str()), want, "... and streamed");
+}
+
+// The text of the first <tag> in tree, or "(none)"
+template <typename Tree>
+static std::string firstText(const Tree& tree, typename Tree::Node root, const char* tag) {
+    RenderWalker<Tree> walker(tree);
+    std::string found = "(none)";
+    walker.walkSubtree(root, [&](typename Tree::Node node) {
+        if (!walker.tagEquals(node, tag)) return true;
+        found = tree.text(node) ? tree.text(node) : "";
+        return false;
+    });
+    return found;
+}
+
+// Script and style bodies are code: collapsing their whitespace would change
+// string literals and turn a // comment into the whole script
+static void testRawTextKeptAsWritten() {
+    const char* script = "// c\nvar a = \"x   y\";\n\talert(a)\n";
+    std::string html = std::string("<html><head><style>\n  p { }\n</style></head><body><script>") + script +
+                       "</script><p>shown</p></body></html>";
+    HTMLParser parser;
+    parser.parse(html.c_str());
+    LiveDom live;
+    checkEqual(firstText(live, parser.getRoot(), "script"), script, "a script body is kept as written");
+    checkEqual(firstText(live, parser.getRoot(), "style"), "\n  p { }\n", "... and so is a style body");
+    checkEqual(renderLines(html.c_str()), "P: shown\n", "... and render lines are as before");
+
+    std::string path = (std::filesystem::temp_directory_path() / "parser_tests_raw.snap").string();
+    std::string error;
+    {
+        DomSnapshot snapshot; // unmapped before the file is removed
+        check(writeDomSnapshot(path.c_str(), parser, error) && snapshot.open(path.c_str(), error),
+              "snapshot: " + error);
+        if (snapshot.isOpen()) {
+            checkEqual(firstText(snapshot, snapshot.root(), "script"), script, "... and in a snapshot");
+        }
+    }
+    std::remove(path.c_str());
+}
+
+// ============================================================================
+// RENDER MODES
+// ============================================================================
+
+static std::string documentLines(const RenderDocument& doc) {
+    std::ostringstream out;
+    writeRenderDocument(out, doc);
+    return out.str();
+}
+
+// page.txt is the same whichever way it is made: parse, --threads, --stream
+// and --load of a --snapshot, on every html_corpus_gen shape
+static void testRenderModesAgree() {
+    std::string path = (std::filesystem::temp_directory_path() / "parser_tests_modes.snap").string();
+    for (int shape = 0; shape < kShapeCount; shape++) {
+        // Big enough for --threads to split the tokenizing. Every block of a
+        // tag soup page repeats the text of those it never closed, so its
+        // page.txt grows with the square of its size.
+        uint64_t size = shape == SHAPE_UNCLOSED ? 64 * 1024 : 600 * 1024;
+        std::string html;
+        {
+            FILE* file = tmpfile();
+            writeDocument(static_cast<CorpusShape>(shape), 7, size, file);
+            html.resize(static_cast<size_t>(ftell(file)));
+            rewind(file);
+            html.resize(fread(&html[0], 1, html.size(), file));
+            fclose(file);
+        }
+        std::string name = kShapeNames[shape];
+        std::string want = renderLines(html.c_str());
+
+        HTMLParser threaded;
+        threaded.parseParallel(html.c_str(), 4);
+        checkEqual(documentLines(threaded.buildRenderDocument(4)), want, name + " page with --threads 4");
+        checkEqual(streamLines(html.c_str(), 4096), want, name + " page with --stream");
+
+        HTMLParser parser;
+        parser.parse(html.c_str());
+        std::string error;
+        {
+            DomSnapshot snapshot; // unmapped before the file is removed
+            check(writeDomSnapshot(path.c_str(), parser, error) && snapshot.open(path.c_str(), error),
+                  name + " snapshot: " + error);
+            if (snapshot.isOpen()) {
+                checkEqual(documentLines(snapshot.buildRenderDocument(1)), want, name + " page from --load");
+                checkEqual(documentLines(snapshot.buildRenderDocument(4)), want, name + " ... with --threads 4");
+            }
+        }
+        std::remove(path.c_str());
+    }
+}
+
+// --watch after one paragraph changed: only it and the elements around it
+// are walked again, every other subtree is copied from the last render
+static void testReloadReusesUnchanged() {
+    const int sections = 20;
+    const int paragraphs = 10;
+    auto page = [&](const std::string& changed) {
+        std::string html = "<html><head><title>Reload</title></head><body>";
+        for (int i = 0; i < sections; i++) {
+            html += "<div>";
+            for (int j = 0; j < paragraphs; j++) {
+                std::string text = "section " + std::to_string(i) + " paragraph " + std::to_string(j);
+                if (i == 3 && j == 5 && !changed.empty()) text = changed;
+                html += "<p>" + text + " <a href=\"/" + std::to_string(i) + "/" + std::to_string(j) + "\">more</a></p>";
+            }
+            html += "</div>";
+        }
+        return html + "</body></html>";
+    };
+
+    HTMLParser parser;
+    ReloadRenderer renderer;
+    std::string before = page("");
+    parser.parse(before.c_str());
+    renderer.renderTree(parser.getRoot());
+
+    std::string after = page("edited");
+    parser.parse(after.c_str());
+    ReloadStats stats;
+    const RenderDocument& doc = renderer.renderTree(parser.getRoot(), &stats);
+    checkEqual(documentLines(doc), renderLines(after.c_str()), "a reload renders the edited page");
+    check(doc.links.size() == static_cast<size_t>(sections * paragraphs), "... with every link");
+    // html, body, the edited paragraph's <div> and the paragraph itself; its link is unchanged
+    check(stats.renderedNodes == 4, "... walking only the edited paragraph and its ancestors (" +
+                                        std::to_string(stats.renderedNodes) + " nodes)");
+    check(stats.reusedSubtrees == 1 + (sections - 1) + (paragraphs - 1) + 1,
+          "... and reusing head, every other <div> and paragraph, and the link (" +
+              std::to_string(stats.reusedSubtrees) + " subtrees)");
+    check(stats.reusedNodes + stats.renderedNodes == stats.nodes, "... which covers the whole page");
+}
+
+// ============================================================================
+// BATCH MANIFEST
+// ============================================================================
+
+// Manifest lines without an output column keep their folders, so pages with
+// the same name in different folders get outputs of their own
+static void testManifestOutputs() {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "parser_tests_manifest";
+    std::filesystem::create_directories(dir);
+    std::string manifest = (dir / "manifest.txt").string();
+    {
+        std::ofstream file(manifest);
+        file << "# pages\nsite/a/index.html\nsite/b/index.html\n/abs/page.html\n";
+    }
+    std::vector<BatchItem> items;
+    std::string error;
+    check(loadManifest(manifest, "out", items, error) && items.size() == 3, "manifest loads: " + error);
+    if (items.size() == 3) {
+        checkEqual(items[0].output, (std::filesystem::path("out") / "site/a/index.txt").string(),
+                   "a relative input keeps its folders");
+        checkEqual(items[2].output, (std::filesystem::path("out") / "page.txt").string(),
+                   "... an absolute one only its name");
+    }
+    check(checkDistinctOutputs(items, error), "... so no two outputs clash: " + error);
+
+    items.push_back({"elsewhere/page.html", "out/./page.txt"});
+    check(!checkDistinctOutputs(items, error) && error.find("/abs/page.html") != std::string::npos,
+          "two items writing one file are an error");
+    std::filesystem::remove_all(dir);
+}
+
+// ============================================================================
+// URL INDEX
+// ============================================================================
+
+// A filter sized for n urls holding n of them says "maybe" for new ones
+// about as often as it was asked to
+static void testBloomFalsePositiveRate() {
+    const size_t items = 200000;
+    const long probes = 1000000;
+    const double rates[] = {0.01, 0.001, 0.0001};
+    for (double rate : rates) {
+        BlockedBloomFilter filter(items, rate);
+        for (size_t i = 0; i < items; i++) filter.add(hashUrl64("http://example.com/page/" + std::to_string(i)));
+        long hits = 0;
+        for (long i = 0; i < probes; i++) {
+            if (filter.mightContain(hashUrl64("http://example.org/other/" + std::to_string(i)))) hits++;
+        }
+        double measured = static_cast<double>(hits) / probes;
+        check(measured <= rate * 1.5, "bloom filter at " + std::to_string(rate) + " measured " +
+                                          std::to_string(measured));
+    }
+}
+
+// ============================================================================
+// TAB STORE
+// ============================================================================
+
+// A background page the document cache still holds is not packed away, since
+// that frees nothing, and it keeps counting as resident
+static void testSharedTabStaysResident() {
+    TabRenderStore store(0, 0);
+    std::shared_ptr<RenderDocument> doc = std::make_shared<RenderDocument>();
+    doc->title = "Shared";
+    doc->blocks.push_back({RENDER_P, std::string(4000, 'x')});
+    std::shared_ptr<const RenderDocument> cached = doc;
+    store.set(1, doc);
+    doc.reset();
+    size_t resident = store.getResidentBytes();
+
+    checkEqual(std::to_string(store.compressBackground(-1)), "0", "a page still in the cache is not compressed");
+    check(store.getResidentBytes() == resident && resident > 0, "... and still counts as resident");
+    cached.reset();
+    checkEqual(std::to_string(store.compressBackground(-1)), "1", "once only the tab holds it, it is compressed");
+    check(store.getResidentBytes() == 0 && store.getCompressedCount() == 1, "... and counts as compressed");
+    std::shared_ptr<const RenderDocument> back = store.get(1);
+    check(back && back->title == "Shared" && back->blocks.size() == 1, "... and comes back whole");
+}
+
+// ============================================================================
+// SCRIPT FETCHER
+// ============================================================================
+
+// The url reaches the fetch script as one argument, never through a shell.
+// sh stands in for python and the "script" just echoes its first argument.
+static void testScriptFetcherArguments() {
+#ifndef _WIN32
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    std::filesystem::path script = dir / "parser_tests_echo_url.sh";
+    std::filesystem::path marker = dir / "parser_tests_pwned";
+    std::filesystem::remove(marker);
+    {
+        std::ofstream out(script);
+        out << "printf '%s' \"$1\" > \"$2\"\n";
+    }
+    PageFetcher fetcher = makeScriptFetcher("sh", script.string());
+    std::string url = "https://example.invalid/$(touch " + marker.string() + ")\"`touch " + marker.string() + "`";
+    std::string body;
+    std::string error;
+    std::string contentType;
+    std::string finalUrl;
+    CancelToken cancel;
+    HttpBodySink collect = [&body](const char* data, size_t len) {
+        body.append(data, len);
+        return true;
+    };
+    bool ok = fetcher(url, collect, error, cancel, contentType, finalUrl);
+    check(ok, "the script fetcher runs (" + error + ")");
+    checkEqual(body, url, "the script gets the url exactly as given");
+    check(!std::filesystem::exists(marker), "nothing in the url runs as a command");
+
+    body.clear();
+    check(!fetcher("https://example.invalid/a\nb", collect, error, cancel, contentType, finalUrl) && body.empty(),
+          "a url with a control character is refused");
+    std::filesystem::remove(script);
+#endif
+}
+
+// Arguments quoted for CreateProcess come back whole from CommandLineToArgvW,
+// so a '"' in a url cannot start another argument
+static void testWindowsArgQuoting() {
+    checkEqual(quoteWindowsArg("https://example.com/a"), "https://example.com/a", "a plain argument is left alone");
+    checkEqual(quoteWindowsArg(""), "\"\"", "an empty argument");
+    checkEqual(quoteWindowsArg("a b"), "\"a b\"", "an argument with a space");
+    checkEqual(quoteWindowsArg("https://x/\" C:\\Startup\\x.bat"), "\"https://x/\\\" C:\\Startup\\x.bat\"",
+               "a quote inside is escaped, lone backslashes are not");
+    checkEqual(quoteWindowsArg("C:\\dir \\"), "\"C:\\dir \\\\\"", "backslashes before the closing quote double");
+    checkEqual(quoteWindowsArg("a\\\"b c"), "\"a\\\\\\\"b c\"", "backslashes before a quote double, plus one");
+}
+
+// ============================================================================
+// FETCHING (needs the local stand-in server)
+// ============================================================================
+
+static void testRedirectToHttps(const std::string& server) {
+    std::string handedOver;
+    PageFetcher fallback = [&handedOver](const std::string& url, const HttpBodySink& onData, std::string&,
+                                         const CancelToken&, std::string&, std::string& finalUrl) {
+        handedOver = url;
+        finalUrl = url;
+        return onData("<p>moved</p>", 12);
+    };
+    PageFetcher fetcher = makeHttpFetcher(std::make_shared<HttpClient>(), fallback);
+    std::string body;
+    std::string error;
+    std::string contentType;
+    std::string finalUrl;
+    CancelToken cancel;
+    bool ok = fetcher(server + "/moved.html?redirect=https://example.com/moved.html",
+                      [&body](const char* data, size_t len) {
+                          body.append(data, len);
+                          return true;
+                      }, error, cancel, contentType, finalUrl);
+    check(ok, "an http:// page that redirects to https:// loads (" + error + ")");
+    checkEqual(handedOver, "https://example.com/moved.html", "the https:// target goes to the fallback fetcher");
+    checkEqual(body, "<p>moved</p>", "... and its body is what the page shows");
+    checkEqual(finalUrl, "https://example.com/moved.html", "... and it is where the page came from");
+
+    // A Location carrying shell syntax and a quote is re-serialized, escapes and all
+    handedOver.clear();
+    body.clear();
+    ok = fetcher(server + "/moved.html?redirect=https://example.com/a%24(touch%20/tmp/x)%22b%60id%60",
+                 [&body](const char* data, size_t len) {
+                     body.append(data, len);
+                     return true;
+                 }, error, cancel, contentType, finalUrl);
+    check(ok, "a redirect target with $(...) and '\"' loads (" + error + ")");
+    checkEqual(handedOver, "https://example.com/a$(touch%20/tmp/x)%22b%60id%60",
+               "... and reaches the fallback with space, quote and backtick escaped");
+
+    // Anything that is not a plain https url never reaches the fallback
+    const char* refused[] = {"https://exa%22mple.com/", "https://a$(id).example.com/", "file:///etc/passwd",
+                             "javascript://alert(1)"};
+    for (const char* target : refused) {
+        handedOver.clear();
+        ok = fetcher(server + "/moved.html?redirect=" + target, [](const char*, size_t) { return true; }, error,
+                     cancel, contentType, finalUrl);
+        check(!ok && handedOver.empty(), std::string("a redirect to ") + target + " is refused");
+    }
+}
+
+// Links on a page reached through a redirect are relative to where it ended up
+static void testCrawlAfterRedirect(const std::string& server) {
+    CrawlOptions options;
+    options.maxDepth = 0;
+    options.workers = 1;
+    Crawler crawler(makeHttpFetcher(std::make_shared<HttpClient>(), nullptr), options);
+    bool fetched = false;
+    crawler.run({server + "/sub/start.html?redirect=/page2.html"},
+                [&fetched](const CrawlPage& page) { fetched = page.ok; });
+    check(fetched, "the redirected seed is fetched");
+    bool sawRight = false;
+    bool sawWrong = false;
+    for (int id = 0; id < crawler.getUrlCount(); id++) {
+        sawRight = sawRight || crawler.getUrl(id) == server + "/page3.html";
+        sawWrong = sawWrong || crawler.getUrl(id) == server + "/sub/page3.html";
+    }
+    check(sawRight && !sawWrong, "page3.html on /page2.html is " + server + "/page3.html, not /sub/page3.html");
+}
+
+// The pipeline reports where a redirect ended up, and prefetch picks the
+// links of the page from there
+static void testPipelineAfterRedirect(const std::string& server) {
+    std::mutex lock;
+    std::condition_variable ready;
+    PageResult* done = nullptr;
+    PagePipeline pipeline(1, makeHttpFetcher(std::make_shared<HttpClient>(), nullptr), [&](PageResult* result) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (result->status == PAGE_PARTIAL) {
+            delete result;
+            return;
+        }
+        done = result;
+        ready.notify_one();
+    });
+    pipeline.navigate(1, server + "/sub/start.html?redirect=/page2.html");
+    std::unique_ptr<PageResult> result;
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait(guard, [&done] { return done != nullptr; });
+        result.reset(done);
+    }
+    check(result->status == PAGE_OK, "the redirected page loads (" + result->error + ")");
+    checkEqual(result->finalUrl, server + "/page2.html", "... and its finalUrl is where it ended up");
+
+    DocumentCache documents(1024 * 1024);
+    LinkPrefetcher prefetcher(makeHttpFetcher(std::make_shared<HttpClient>(), nullptr), documents);
+    std::vector<std::string> picked = prefetcher.selectLinks(result->finalUrl, result->doc.links);
+    check(std::find(picked.begin(), picked.end(), server + "/page3.html") != picked.end(),
+          "prefetch resolves the page's links against it");
+}
+
+int main(int argc, char* argv[]) {
+    std::string server;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--server") == 0 && i + 1 < argc) server = argv[++i];
+    }
+
+    testLeadingVoidElement();
+    testFeedInPieces();
+    testWhitespaceReferencesCollapse();
+    testDeepNesting();
+    testDeepInlineNesting();
+    testRawTextKeptAsWritten();
+    testRenderModesAgree();
+    testReloadReusesUnchanged();
+    testManifestOutputs();
+    testBloomFalsePositiveRate();
+    testSharedTabStaysResident();
+    testScriptFetcherArguments();
+    testWindowsArgQuoting();
+    if (server.empty()) {
+        std::cout << "Fetcher checks skipped (no --server)" << std::endl;
+    } else {
+        testRedirectToHttps(server);
+        testCrawlAfterRedirect(server);
+        testPipelineAfterRedirect(server);
+    }
+
+    if (failures) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef PHASE_TIMER_H
+#define PHASE_TIMER_H
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <chrono>
+
+// ============================================================================
+// PHASE TIMING (wall clock and process CPU time)
+// ============================================================================
+
+// CPU time used by the whole process so far, user + kernel, in ms
+inline double processCpuMs() {
+#ifdef _WIN32
+    FILETIME created, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) return 0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return static_cast<double>(k.QuadPart + u.QuadPart) / 10000.0; // 100 ns units
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+#endif
+}
+
+struct PhaseTime {
+    double wallMs = 0;
+    double cpuMs = 0;
+};
+
+// Adds the time from construction to stop() (or the end of scope) to a
+// PhaseTime; a null target makes it a no-op, so call sites need no branches
+class PhaseTimer {
+private:
+    PhaseTime* target;
+    std::chrono::steady_clock::time_point wallStart;
+    double cpuStart;
+
+public:
+    explicit PhaseTimer(PhaseTime* phase) : target(phase), cpuStart(0) {
+        if (!target) return;
+        wallStart = std::chrono::steady_clock::now();
+        cpuStart = processCpuMs();
+    }
+
+    ~PhaseTimer() {
+        stop();
+    }
+
+    void stop() {
+        if (!target) return;
+        target->wallMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+        target->cpuMs += processCpuMs() - cpuStart;
+        target = nullptr;
+    }
+};
+
+#endif // PHASE_TIMER_H
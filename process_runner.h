@@ -0,0 +1,113 @@
+#ifndef PROCESS_RUNNER_H
+#define PROCESS_RUNNER_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <spawn.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+extern char** environ;
+#endif
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cancel_token.h"
+
+// ============================================================================
+// CHILD PROCESSES (no shell: every argument reaches the program as it is)
+// ============================================================================
+
+// Quotes one argument so CommandLineToArgvW (and the MSVC runtime) reads it
+// back unchanged: backslashes only double in front of a quote or the end
+inline std::string quoteWindowsArg(const std::string& arg) {
+    if (!arg.empty() && arg.find_first_of(" \t\n\v\"") == std::string::npos) return arg;
+    std::string out = "\"";
+    size_t backslashes = 0;
+    for (size_t i = 0; i < arg.size(); i++) {
+        if (arg[i] == '\\') {
+            backslashes++;
+            continue;
+        }
+        if (arg[i] == '"') {
+            out.append(backslashes * 2 + 1, '\\');
+        } else {
+            out.append(backslashes, '\\');
+        }
+        backslashes = 0;
+        out += arg[i];
+    }
+    out.append(backslashes * 2, '\\');
+    out += '"';
+    return out;
+}
+
+// Runs args[0] (looked up on PATH) with args as its argv and waits for it, or
+// kills it once cancel is set. True if it exited with status 0. With
+// discardOutput its stdout goes to /dev/null (POSIX only; GUI processes on
+// Windows have no console to write to anyway).
+inline bool runProcess(const std::vector<std::string>& args, const CancelToken* cancel = nullptr,
+                       bool discardOutput = false) {
+    if (args.empty()) return false;
+#ifdef _WIN32
+    (void)discardOutput;
+    std::string cmdLine;
+    for (size_t i = 0; i < args.size(); i++) {
+        if (i > 0) cmdLine += ' ';
+        cmdLine += quoteWindowsArg(args[i]);
+    }
+
+    STARTUPINFOA si{};
+    si.cb = sizeof(si);
+    PROCESS_INFORMATION pi{};
+    if (!CreateProcessA(nullptr, &cmdLine[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si, &pi)) {
+        return false;
+    }
+    while (WaitForSingleObject(pi.hProcess, 50) == WAIT_TIMEOUT) {
+        if (cancel && cancel->isCancelled()) {
+            TerminateProcess(pi.hProcess, 1);
+            WaitForSingleObject(pi.hProcess, INFINITE);
+            break;
+        }
+    }
+    DWORD exitCode = 1;
+    GetExitCodeProcess(pi.hProcess, &exitCode);
+    CloseHandle(pi.hProcess);
+    CloseHandle(pi.hThread);
+    return exitCode == 0;
+#else
+    std::vector<char*> argv;
+    for (size_t i = 0; i < args.size(); i++) argv.push_back(const_cast<char*>(args[i].c_str()));
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (discardOutput) posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    pid_t pid = 0;
+    int rc = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    if (rc != 0) return false;
+
+    int status = 0;
+    for (;;) {
+        pid_t done = waitpid(pid, &status, WNOHANG);
+        if (done == pid) break;
+        if (done < 0 && errno != EINTR) return false;
+        if (cancel && cancel->isCancelled()) {
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+}
+
+#endif // PROCESS_RUNNER_H
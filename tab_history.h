@@ -0,0 +1,173 @@
+#ifndef TAB_HISTORY_H
+#define TAB_HISTORY_H
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "html_parser.h"
+#include "http_cache.h"
+
+// ============================================================================
+// BACK/FORWARD HISTORY (one per tab)
+// ============================================================================
+
+class TabHistory {
+private:
+    Stack<std::string> backStack;
+    Stack<std::string> forwardStack;
+    std::string current;
+
+public:
+    // A new navigation: the page being left goes on the back stack and the
+    // forward stack is dropped, as in any browser
+    void visit(const std::string& url) {
+        if (!current.empty() && current != url) backStack.push(current);
+        if (current != url) forwardStack.clear();
+        current = url;
+    }
+
+    bool canGoBack() const {
+        return !backStack.isEmpty();
+    }
+
+    bool canGoForward() const {
+        return !forwardStack.isEmpty();
+    }
+
+    // Moves one step and returns the url to show (empty if there is nowhere to go)
+    std::string goBack() {
+        if (backStack.isEmpty()) return "";
+        forwardStack.push(current);
+        current = backStack.pop();
+        return current;
+    }
+
+    std::string goForward() {
+        if (forwardStack.isEmpty()) return "";
+        backStack.push(current);
+        current = forwardStack.pop();
+        return current;
+    }
+
+    const std::string& getCurrent() const {
+        return current;
+    }
+};
+
+// ============================================================================
+// DOCUMENT CACHE (parsed pages shared by all tabs, LRU under a byte budget)
+// ============================================================================
+
+// Rough heap footprint of a parsed page, used for the cache budget
+inline size_t estimateDocumentBytes(const RenderDocument& doc) {
+    size_t bytes = sizeof(RenderDocument) + doc.title.capacity();
+    bytes += doc.blocks.capacity() * sizeof(RenderBlock);
+    for (size_t i = 0; i < doc.blocks.size(); i++) {
+        bytes += doc.blocks[i].text.capacity();
+    }
+    bytes += doc.links.capacity() * sizeof(RenderLink);
+    for (size_t i = 0; i < doc.links.size(); i++) {
+        bytes += doc.links[i].href.capacity() + doc.links[i].rel.capacity() + doc.links[i].text.capacity();
+    }
+    return bytes;
+}
+
+class DocumentCache {
+private:
+    struct Slot {
+        std::shared_ptr<const RenderDocument> doc;
+        size_t bytes = 0;
+        std::list<std::string>::iterator recency;
+    };
+
+    std::mutex lock;
+    std::map<std::string, Slot> slots;   // normalized url -> parsed page
+    std::list<std::string> recency;      // most recently used first
+    size_t budget;
+    size_t bytes;
+
+    std::atomic<long> hits;
+    std::atomic<long> misses;
+    std::atomic<long> evictions;
+
+    // Caller holds the lock
+    void evictOverBudget() {
+        while (bytes > budget && !recency.empty()) {
+            std::map<std::string, Slot>::iterator victim = slots.find(recency.back());
+            bytes -= victim->second.bytes;
+            slots.erase(victim);
+            recency.pop_back();
+            evictions++;
+        }
+    }
+
+public:
+    explicit DocumentCache(size_t budgetBytes)
+        : budget(budgetBytes), bytes(0), hits(0), misses(0), evictions(0) {}
+
+    // The cached page for url, or null; documents are immutable once cached,
+    // so the caller can keep using one after it has been evicted
+    std::shared_ptr<const RenderDocument> get(const std::string& url) {
+        std::lock_guard<std::mutex> guard(lock);
+        std::map<std::string, Slot>::iterator it = slots.find(normalizeCacheUrl(url));
+        if (it == slots.end()) {
+            misses++;
+            return nullptr;
+        }
+        recency.splice(recency.begin(), recency, it->second.recency);
+        hits++;
+        return it->second.doc;
+    }
+
+    void put(const std::string& url, const std::shared_ptr<const RenderDocument>& doc) {
+        if (!doc) return;
+        std::string key = normalizeCacheUrl(url);
+        size_t size = estimateDocumentBytes(*doc);
+        std::lock_guard<std::mutex> guard(lock);
+
+        std::map<std::string, Slot>::iterator it = slots.find(key);
+        if (it != slots.end()) {
+            bytes -= it->second.bytes;
+            recency.erase(it->second.recency);
+            slots.erase(it);
+        }
+        if (size > budget) return;
+
+        recency.push_front(key);
+        Slot& slot = slots[key];
+        slot.doc = doc;
+        slot.bytes = size;
+        slot.recency = recency.begin();
+        bytes += size;
+        evictOverBudget();
+    }
+
+    bool contains(const std::string& url) {
+        std::lock_guard<std::mutex> guard(lock);
+        return slots.count(normalizeCacheUrl(url)) > 0;
+    }
+
+    long getHits() const { return hits.load(); }
+    long getMisses() const { return misses.load(); }
+    long getEvictions() const { return evictions.load(); }
+
+    double getHitRate() const {
+        long total = hits.load() + misses.load();
+        return total == 0 ? 0.0 : static_cast<double>(hits.load()) / total;
+    }
+
+    size_t getBytes() {
+        std::lock_guard<std::mutex> guard(lock);
+        return bytes;
+    }
+
+    size_t getEntryCount() {
+        std::lock_guard<std::mutex> guard(lock);
+        return slots.size();
+    }
+};
+
+#endif // TAB_HISTORY_H
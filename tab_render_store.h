@@ -0,0 +1,222 @@
+#ifndef TAB_RENDER_STORE_H
+#define TAB_RENDER_STORE_H
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "html_parser.h"
+#include "block_compress.h"
+#include "tab_history.h"
+
+// ============================================================================
+// RENDER DOCUMENT PACKING (flat bytes for compression)
+// ============================================================================
+
+inline void packVarint(std::string& out, size_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+inline bool unpackVarint(const std::string& in, size_t& pos, size_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+        unsigned char b = static_cast<unsigned char>(in[pos++]);
+        value |= static_cast<size_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+inline void packString(std::string& out, const std::string& s) {
+    packVarint(out, s.size());
+    out += s;
+}
+
+inline bool unpackString(const std::string& in, size_t& pos, std::string& s) {
+    size_t length = 0;
+    if (!unpackVarint(in, pos, length) || length > in.size() - pos) return false;
+    s.assign(in, pos, length);
+    pos += length;
+    return true;
+}
+
+inline std::string packRenderDocument(const RenderDocument& doc) {
+    std::string out;
+    packString(out, doc.title);
+    packVarint(out, doc.blocks.size());
+    for (size_t i = 0; i < doc.blocks.size(); i++) {
+        out += static_cast<char>(doc.blocks[i].kind);
+        packString(out, doc.blocks[i].text);
+    }
+    packVarint(out, doc.links.size());
+    for (size_t i = 0; i < doc.links.size(); i++) {
+        packString(out, doc.links[i].href);
+        packString(out, doc.links[i].rel);
+        packString(out, doc.links[i].text);
+    }
+    return out;
+}
+
+inline bool unpackRenderDocument(const std::string& in, RenderDocument& doc) {
+    size_t pos = 0;
+    size_t count = 0;
+    if (!unpackString(in, pos, doc.title) || !unpackVarint(in, pos, count)) return false;
+    doc.blocks.clear();
+    doc.blocks.reserve(count < in.size() ? count : in.size());
+    for (size_t i = 0; i < count; i++) {
+        if (pos >= in.size()) return false;
+        RenderBlock block;
+        int kind = static_cast<unsigned char>(in[pos++]);
+        if (kind > RENDER_P) return false;
+        block.kind = static_cast<RenderKind>(kind);
+        if (!unpackString(in, pos, block.text)) return false;
+        doc.blocks.push_back(block);
+    }
+    if (!unpackVarint(in, pos, count)) return false;
+    doc.links.clear();
+    for (size_t i = 0; i < count; i++) {
+        RenderLink link;
+        if (!unpackString(in, pos, link.href) || !unpackString(in, pos, link.rel) ||
+            !unpackString(in, pos, link.text)) {
+            return false;
+        }
+        doc.links.push_back(link);
+    }
+    return pos == in.size();
+}
+
+// ============================================================================
+// TAB RENDER STORE (every tab's page in memory, idle background tabs compressed)
+// ============================================================================
+// Owned by the UI thread. The current tab is never compressed; a background
+// tab is compressed once it has not been shown for idleMs, or sooner (least
+// recently shown first) while resident pages exceed residentLimit. A page the
+// document cache (or anyone else) still holds is left alone: packing it would
+// free nothing, so it stays resident until it is only the tab's.
+
+class TabRenderStore {
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Slot {
+        std::shared_ptr<const RenderDocument> doc; // null while compressed
+        std::string packed;
+        size_t packedRawSize = 0;
+        size_t residentBytes = 0;
+        Clock::time_point lastShown;
+    };
+
+    std::map<int, Slot> slots; // tab id -> page
+    size_t residentLimit;
+    int idleMs;
+    long compressions;
+    long decompressions;
+
+    bool compressSlot(Slot& slot) {
+        if (!slot.doc || slot.doc.use_count() > 1) return false;
+        std::string raw = packRenderDocument(*slot.doc);
+        slot.packed = compressBlock(raw);
+        slot.packedRawSize = raw.size();
+        slot.doc.reset();
+        slot.residentBytes = 0;
+        compressions++;
+        return true;
+    }
+
+public:
+    TabRenderStore(size_t residentLimitBytes, int idleMillis)
+        : residentLimit(residentLimitBytes), idleMs(idleMillis), compressions(0), decompressions(0) {}
+
+    void set(int tabId, const std::shared_ptr<const RenderDocument>& doc) {
+        Slot& slot = slots[tabId];
+        slot.doc = doc;
+        slot.packed.clear();
+        slot.packed.shrink_to_fit();
+        slot.packedRawSize = 0;
+        slot.residentBytes = doc ? estimateDocumentBytes(*doc) : 0;
+        slot.lastShown = Clock::now();
+    }
+
+    // The tab's page, decompressed first if it had been packed away
+    std::shared_ptr<const RenderDocument> get(int tabId) {
+        std::map<int, Slot>::iterator it = slots.find(tabId);
+        if (it == slots.end()) return nullptr;
+        Slot& slot = it->second;
+        slot.lastShown = Clock::now();
+        if (slot.doc || slot.packed.empty()) return slot.doc;
+
+        std::string raw;
+        std::shared_ptr<RenderDocument> doc = std::make_shared<RenderDocument>();
+        if (!decompressBlock(slot.packed, slot.packedRawSize, raw) || !unpackRenderDocument(raw, *doc)) {
+            slots.erase(it);
+            return nullptr;
+        }
+        decompressions++;
+        set(tabId, doc);
+        return doc;
+    }
+
+    void remove(int tabId) {
+        slots.erase(tabId);
+    }
+
+    // Called periodically from the UI; returns how many tabs were compressed
+    int compressBackground(int currentTabId) {
+        Clock::time_point now = Clock::now();
+        int packedNow = 0;
+        std::vector<std::pair<Clock::time_point, int>> byAge;
+        for (std::map<int, Slot>::iterator it = slots.begin(); it != slots.end(); ++it) {
+            if (it->first == currentTabId || !it->second.doc) continue;
+            if (now - it->second.lastShown >= std::chrono::milliseconds(idleMs)) {
+                if (compressSlot(it->second)) packedNow++;
+            } else {
+                byAge.push_back(std::make_pair(it->second.lastShown, it->first));
+            }
+        }
+
+        std::sort(byAge.begin(), byAge.end());
+        for (size_t i = 0; i < byAge.size() && getResidentBytes() > residentLimit; i++) {
+            if (compressSlot(slots[byAge[i].second])) packedNow++;
+        }
+        return packedNow;
+    }
+
+    size_t getResidentBytes() const {
+        size_t total = 0;
+        for (std::map<int, Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it) {
+            total += it->second.residentBytes;
+        }
+        return total;
+    }
+
+    size_t getCompressedBytes() const {
+        size_t total = 0;
+        for (std::map<int, Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it) {
+            total += it->second.packed.size();
+        }
+        return total;
+    }
+
+    int getCompressedCount() const {
+        int count = 0;
+        for (std::map<int, Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it) {
+            if (!it->second.doc && !it->second.packed.empty()) count++;
+        }
+        return count;
+    }
+
+    int getTabCount() const {
+        return static_cast<int>(slots.size());
+    }
+
+    long getCompressions() const { return compressions; }
+    long getDecompressions() const { return decompressions; }
+};
+
+#endif // TAB_RENDER_STORE_H
@@ -0,0 +1,211 @@
+#ifndef TRACE_EVENTS_H
+#define TRACE_EVENTS_H
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// TRACE EVENTS (scoped spans, dumped as Chrome trace_event JSON)
+// ============================================================================
+// TRACE_SCOPE("parse", "tokenize") records how long the enclosing block ran.
+// Each thread appends to its own buffer without locking; the registry lock is
+// taken once per thread, on its first event. With tracing off a span costs
+// one relaxed load and a branch. Names and categories must be string
+// literals, only the pointers are kept. Open the dump in chrome://tracing or
+// ui.perfetto.dev.
+
+struct TraceEvent {
+    const char* category;
+    const char* name;
+    long long startUs;
+    long long durationUs;
+};
+
+// One thread's events: a chain of fixed chunks, written only by the owner
+// and readable at any time up to each chunk's published count
+class TraceThreadBuffer {
+private:
+    static const size_t kChunkEvents = 1024;
+
+    struct Chunk {
+        TraceEvent events[kChunkEvents];
+        std::atomic<size_t> count;
+        std::atomic<Chunk*> next;
+        Chunk() : count(0), next(nullptr) {}
+    };
+
+    Chunk* head;
+    Chunk* tail;
+
+public:
+    const int threadId;
+    std::atomic<const char*> threadName;
+
+    explicit TraceThreadBuffer(int id) : head(new Chunk()), tail(head), threadId(id), threadName(nullptr) {}
+
+    void record(const TraceEvent& event) {
+        size_t n = tail->count.load(std::memory_order_relaxed);
+        if (n == kChunkEvents) {
+            Chunk* chunk = new Chunk();
+            tail->next.store(chunk, std::memory_order_release);
+            tail = chunk;
+            n = 0;
+        }
+        tail->events[n] = event;
+        tail->count.store(n + 1, std::memory_order_release);
+    }
+
+    void collect(std::vector<TraceEvent>& out) const {
+        for (const Chunk* c = head; c; c = c->next.load(std::memory_order_acquire)) {
+            size_t n = c->count.load(std::memory_order_acquire);
+            out.insert(out.end(), c->events, c->events + n);
+        }
+    }
+};
+
+// Buffers outlive their threads so a dump still sees pool workers that have
+// exited; they are never freed
+class TraceRegistry {
+private:
+    std::mutex mutex;
+    std::vector<TraceThreadBuffer*> buffers;
+
+public:
+    static TraceRegistry& instance() {
+        static TraceRegistry* registry = new TraceRegistry();
+        return *registry;
+    }
+
+    TraceThreadBuffer* addThread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.push_back(new TraceThreadBuffer(static_cast<int>(buffers.size()) + 1));
+        return buffers.back();
+    }
+
+    std::vector<TraceThreadBuffer*> snapshot() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return buffers;
+    }
+};
+
+inline std::atomic<bool>& traceFlag() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+inline bool traceEnabled() {
+    return traceFlag().load(std::memory_order_relaxed);
+}
+
+inline std::chrono::steady_clock::time_point traceEpoch() {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+inline long long traceNowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - traceEpoch())
+        .count();
+}
+
+inline void enableTracing() {
+    traceEpoch();
+    traceFlag().store(true);
+}
+
+inline TraceThreadBuffer* currentTraceBuffer() {
+    static thread_local TraceThreadBuffer* buffer = nullptr;
+    if (!buffer) buffer = TraceRegistry::instance().addThread();
+    return buffer;
+}
+
+// Labels the calling thread in the dump ("ui", "worker", ...)
+inline void setTraceThreadName(const char* name) {
+    if (traceEnabled()) currentTraceBuffer()->threadName.store(name);
+}
+
+class TraceScope {
+private:
+    const char* category;
+    const char* name;
+    long long startUs;
+
+public:
+    TraceScope(const char* cat, const char* spanName) : category(cat), name(spanName), startUs(-1) {
+        if (traceEnabled()) startUs = traceNowUs();
+    }
+
+    ~TraceScope() {
+        stop();
+    }
+
+    // Ends the span early; the destructor then does nothing
+    void stop() {
+        if (startUs < 0) return;
+        TraceEvent event = {category, name, startUs, traceNowUs() - startUs};
+        currentTraceBuffer()->record(event);
+        startUs = -1;
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(category, name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(category, name)
+
+inline void writeTraceJsonString(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') out << '\\';
+        out << *s;
+    }
+    out << '"';
+}
+
+// Every span recorded so far, safe to call while other threads still trace
+inline void writeTraceJson(std::ostream& out) {
+    std::vector<TraceThreadBuffer*> buffers = TraceRegistry::instance().snapshot();
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (size_t b = 0; b < buffers.size(); b++) {
+        const char* threadName = buffers[b]->threadName.load();
+        if (threadName) {
+            out << (first ? "" : ",") << "\n{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 1, \"tid\": "
+                << buffers[b]->threadId << ", \"args\": {\"name\": ";
+            writeTraceJsonString(out, threadName);
+            out << "}}";
+            first = false;
+        }
+        events.clear();
+        buffers[b]->collect(events);
+        for (size_t i = 0; i < events.size(); i++) {
+            out << (first ? "" : ",") << "\n{\"ph\": \"X\", \"cat\": ";
+            writeTraceJsonString(out, events[i].category);
+            out << ", \"name\": ";
+            writeTraceJsonString(out, events[i].name);
+            out << ", \"ts\": " << events[i].startUs << ", \"dur\": " << events[i].durationUs
+                << ", \"pid\": 1, \"tid\": " << buffers[b]->threadId << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+}
+
+inline bool writeTraceFile(const std::string& path, std::string& error) {
+    std::ofstream out(path.c_str());
+    if (!out.is_open()) {
+        error = "Cannot open file " + path;
+        return false;
+    }
+    writeTraceJson(out);
+    return true;
+}
+
+#endif // TRACE_EVENTS_H
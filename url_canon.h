@@ -0,0 +1,292 @@
+#ifndef URL_CANON_H
+#define URL_CANON_H
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "http_fetcher.h"
+
+// ============================================================================
+// URL CANONICALIZATION
+// ============================================================================
+
+inline bool isUnreservedUrlChar(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+           c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+inline int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Decodes escapes of unreserved characters (%7E -> ~), upper-cases the hex
+// of the escapes that must stay, and escapes bytes that may not appear raw
+// (spaces, controls, non-ASCII). A '%' without two hex digits is left alone.
+inline std::string normalizePercentEncoding(const std::string& s) {
+    static const char* hex = "0123456789ABCDEF";
+    std::string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        if (c == '%' && i + 2 < s.size() && hexDigitValue(s[i + 1]) >= 0 && hexDigitValue(s[i + 2]) >= 0) {
+            int value = hexDigitValue(s[i + 1]) * 16 + hexDigitValue(s[i + 2]);
+            unsigned char decoded = static_cast<unsigned char>(value);
+            if (isUnreservedUrlChar(decoded)) {
+                out += static_cast<char>(decoded);
+            } else {
+                out += '%';
+                out += hex[decoded >> 4];
+                out += hex[decoded & 15];
+            }
+            i += 2;
+        } else if (c <= 0x20 || c >= 0x7F || c == '"' || c == '<' || c == '>' || c == '\\' || c == '^' ||
+                   c == '`' || c == '{' || c == '|' || c == '}') {
+            out += '%';
+            out += hex[c >> 4];
+            out += hex[c & 15];
+        } else {
+            out += static_cast<char>(c);
+        }
+    }
+    return out;
+}
+
+// One spelling per resource: scheme and host lowercased (trailing dot
+// dropped), default port and userinfo dropped, percent-encoding normalized,
+// dot segments removed, fragment and an empty "?" stripped. Urls that do not
+// parse come back unchanged.
+inline std::string canonicalizeUrl(const std::string& url) {
+    ParsedUrl p;
+    if (!parseUrl(url, p)) return url;
+    if (p.host.size() > 1 && p.host.back() == '.') p.host.pop_back();
+    bool defaultPort = (p.scheme == "http" && p.port == 80) || (p.scheme == "https" && p.port == 443);
+
+    std::string path = removeDotSegments(normalizePercentEncoding(p.path));
+    if (!path.empty() && path.back() == '?') path.pop_back();
+    return p.scheme + "://" + p.host + (defaultPort ? "" : ":" + std::to_string(p.port)) + path;
+}
+
+// Sets clean to the canonical spelling of url when url is a plain https url
+// that is safe to hand to another program (the python fetcher): no control
+// characters, a host that is a name or an IP literal, and quotes, spaces and
+// the like percent-escaped. False for anything else, e.g. a hostile Location.
+inline bool cleanHttpsUrl(const std::string& url, std::string& clean) {
+    ParsedUrl p;
+    if (hasControlChars(url) || !parseUrl(url, p) || p.scheme != "https") return false;
+    bool literal = p.host.size() > 2 && p.host[0] == '[' && p.host.back() == ']';
+    for (size_t i = literal ? 1 : 0; i < p.host.size() - (literal ? 1 : 0); i++) {
+        char c = p.host[i];
+        bool ok = literal ? ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || c == ':' || c == '.')
+                          : ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '.');
+        if (!ok) return false;
+    }
+    clean = canonicalizeUrl(url);
+    return true;
+}
+
+// ============================================================================
+// BLOCKED BLOOM FILTER (every lookup touches one 64-byte cache line)
+// ============================================================================
+// The high half of the hash picks a block, the low half seeds the k bit
+// positions inside it, so where a url lands and which bits it sets are
+// unrelated. Blocks fill unevenly, which costs accuracy against a plain
+// Bloom filter; sizing works that loss out and adds bits until the target
+// rate is met.
+
+inline uint64_t hashUrl64(const std::string& s) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < s.size(); i++) {
+        h = (h ^ static_cast<unsigned char>(s[i])) * 1099511628211ull;
+    }
+    // splitmix64 finalizer, so both halves are usable on their own
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+    return h;
+}
+
+class BlockedBloomFilter {
+private:
+    struct alignas(64) Block {
+        uint64_t words[8];
+    };
+    static const int BLOCK_BITS = 512;
+    static const int MAX_HASHES = 32;
+
+    std::vector<Block> blocks;
+    int hashCount;
+
+    size_t blockFor(uint64_t hash) const {
+        return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(blocks.size())) >> 32);
+    }
+
+    // Bit positions come from the top 9 bits of a 64-bit LCG seeded by the
+    // low half of the hash
+    static uint64_t probeSeed(uint64_t hash) {
+        return (hash & 0xFFFFFFFFull) * 0x9E3779B97F4A7C15ull;
+    }
+
+    static uint32_t nextProbe(uint64_t& state) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return static_cast<uint32_t>(state >> 55);
+    }
+
+    // False-positive rate at bitsPerItem with k probes: a block holding j
+    // items (Poisson around the average) answers yes with (1 - (1 - 1/512)^kj)^k
+    static double blockedFalsePositiveRate(double bitsPerItem, int k) {
+        double perBlock = BLOCK_BITS / bitsPerItem;
+        double rate = 0;
+        double logP = -perBlock; // log of the Poisson probability of j
+        int last = static_cast<int>(perBlock + 12 * std::sqrt(perBlock) + 12);
+        for (int j = 0; j <= last; j++) {
+            if (j > 0) logP += std::log(perBlock) - std::log(static_cast<double>(j));
+            double bitSet = 1.0 - std::pow(1.0 - 1.0 / BLOCK_BITS, static_cast<double>(k) * j);
+            rate += std::exp(logP) * std::pow(bitSet, k);
+        }
+        return rate;
+    }
+
+public:
+    // Sized for expectedItems at falsePositiveRate or better
+    BlockedBloomFilter(size_t expectedItems, double falsePositiveRate) {
+        if (expectedItems < 1) expectedItems = 1;
+        if (falsePositiveRate <= 0 || falsePositiveRate >= 1) falsePositiveRate = 0.01;
+        // Start from the plain Bloom filter size and grow 2% at a time, each
+        // time with the k that suits blocks best
+        double bitsPerItem = -std::log(falsePositiveRate) / (std::log(2.0) * std::log(2.0));
+        for (;;) {
+            double best = 1.0;
+            for (int k = 1; k <= MAX_HASHES; k++) {
+                double rate = blockedFalsePositiveRate(bitsPerItem, k);
+                if (rate < best) {
+                    best = rate;
+                    hashCount = k;
+                }
+            }
+            if (best <= falsePositiveRate || bitsPerItem > BLOCK_BITS) break;
+            bitsPerItem *= 1.02;
+        }
+        size_t blockCount = static_cast<size_t>(std::ceil(expectedItems * bitsPerItem / BLOCK_BITS));
+        if (blockCount > 0xFFFFFFFFull) blockCount = 0xFFFFFFFFull;
+        Block empty = {};
+        blocks.assign(blockCount < 1 ? 1 : blockCount, empty);
+    }
+
+    void add(uint64_t hash) {
+        Block& block = blocks[blockFor(hash)];
+        uint64_t state = probeSeed(hash);
+        for (int i = 0; i < hashCount; i++) {
+            uint32_t bit = nextProbe(state);
+            block.words[bit >> 6] |= 1ull << (bit & 63);
+        }
+    }
+
+    bool mightContain(uint64_t hash) const {
+        const Block& block = blocks[blockFor(hash)];
+        uint64_t state = probeSeed(hash);
+        for (int i = 0; i < hashCount; i++) {
+            uint32_t bit = nextProbe(state);
+            if (!(block.words[bit >> 6] & (1ull << (bit & 63)))) return false;
+        }
+        return true;
+    }
+
+    size_t getMemoryBytes() const { return blocks.size() * sizeof(Block); }
+    int getHashCount() const { return hashCount; }
+};
+
+// ============================================================================
+// SEEN-URL INDEX (Bloom prefilter in front of an exact hash map)
+// ============================================================================
+// Most lookups in a crawl are for urls never seen before; the prefilter
+// answers those from one cache line without touching the exact map. Keys are
+// expected to be canonical already (canonicalizeUrl). When the index grows
+// past the size it was planned for, the prefilter is rebuilt twice as big.
+
+template<typename Value>
+class UrlSeenIndex {
+private:
+    std::unordered_map<std::string, Value> exact;
+    BlockedBloomFilter filter;
+    size_t plannedItems;
+    double falsePositiveRate;
+    long long lookups;
+    long long prefilterSkips;   // answered "new" by the filter alone
+    long long falsePositives;   // filter said maybe, map said no
+
+    void grow() {
+        plannedItems *= 2;
+        filter = BlockedBloomFilter(plannedItems, falsePositiveRate);
+        typedef typename std::unordered_map<std::string, Value>::const_iterator Iterator;
+        for (Iterator it = exact.begin(); it != exact.end(); ++it) {
+            filter.add(hashUrl64(it->first));
+        }
+    }
+
+public:
+    explicit UrlSeenIndex(size_t expectedItems = 1 << 16, double fpRate = 0.01)
+        : filter(expectedItems, fpRate), plannedItems(expectedItems < 1 ? 1 : expectedItems),
+          falsePositiveRate(fpRate), lookups(0), prefilterSkips(0), falsePositives(0) {
+        exact.reserve(plannedItems);
+    }
+
+    // The value stored for url, or null if it has not been seen
+    Value* find(const std::string& url) {
+        lookups++;
+        if (!filter.mightContain(hashUrl64(url))) {
+            prefilterSkips++;
+            return nullptr;
+        }
+        typename std::unordered_map<std::string, Value>::iterator it = exact.find(url);
+        if (it == exact.end()) {
+            falsePositives++;
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    // Adds a url that find() just reported as unseen
+    void add(const std::string& url, const Value& value) {
+        exact.emplace(url, value);
+        filter.add(hashUrl64(url));
+        if (exact.size() > plannedItems) grow();
+    }
+
+    // Adds url unless it is already there; true if it was new
+    bool insert(const std::string& url, const Value& value) {
+        if (find(url)) return false;
+        add(url, value);
+        return true;
+    }
+
+    size_t size() const { return exact.size(); }
+    long long getLookups() const { return lookups; }
+    long long getPrefilterSkips() const { return prefilterSkips; }
+    long long getFalsePositives() const { return falsePositives; }
+
+    size_t getPrefilterBytes() const { return filter.getMemoryBytes(); }
+
+    double getPrefilterBitsPerUrl() const {
+        return exact.empty() ? 0.0 : filter.getMemoryBytes() * 8.0 / exact.size();
+    }
+
+    // Rough heap use of the exact map: buckets, nodes and spilled strings
+    size_t getExactBytes() const {
+        size_t bytes = exact.bucket_count() * sizeof(void*);
+        typedef typename std::unordered_map<std::string, Value>::const_iterator Iterator;
+        for (Iterator it = exact.begin(); it != exact.end(); ++it) {
+            bytes += sizeof(std::pair<const std::string, Value>) + 2 * sizeof(void*);
+            if (it->first.capacity() > 15) bytes += it->first.capacity() + 1;
+        }
+        return bytes;
+    }
+};
+
+#endif // URL_CANON_H